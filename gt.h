@@ -36,6 +36,7 @@ extern "C" {
 #include "src/core/gt_mem.h"
 #include "src/core/gt_style.h"
 #include "src/core/gt_obj_pos.h"
+#include "src/core/gt_hit_grid.h"
 #include "src/core/gt_timer.h"
 #include "src/core/gt_draw.h"
 #include "src/core/gt_scr_stack.h"
@@ -18,6 +18,7 @@
 #include "./gt_draw.h"
 #include "./gt_obj_pos.h"
 #include "../others/gt_area.h"
+#include "../others/gt_math.h"
 #include "../others/gt_anim.h"
 #include "./gt_mem.h"
 #include "./gt_indev.h"
@@ -25,6 +26,7 @@
 #include "../others/gt_gc.h"
 
 #include "./gt_obj_scroll.h"
+#include "./gt_hit_grid.h"
 
 /* private define -------------------------------------------------------*/
 
@@ -121,6 +123,10 @@ static GT_ATTRIBUTE_RAM_TEXT inline bool gt_check_obj_visible_and_copy(gt_obj_st
     if (false == gt_area_is_intersect_screen(&param->disp->area_disp, &obj->area)) {
         return false;
     }
+#if GT_USE_OBJ_HIT_GRID
+    /** Some widgets set their default size inside the draw callback */
+    gt_area_st area_prev = obj->area;
+#endif
 
 #if _GT_DISP_USE_MALLOC_DRAW_CTX
     obj->draw_ctx = gt_mem_malloc(sizeof(struct _gt_draw_ctx_s));
@@ -144,6 +150,12 @@ static GT_ATTRIBUTE_RAM_TEXT inline bool gt_check_obj_visible_and_copy(gt_obj_st
     obj->classes->_init_cb(obj);
 #endif
     obj->draw_ctx = NULL;
+#if GT_USE_OBJ_HIT_GRID
+    if (area_prev.x != obj->area.x || area_prev.y != obj->area.y ||
+        area_prev.w != obj->area.w || area_prev.h != obj->area.h) {
+        _gt_hit_grid_update(obj);
+    }
+#endif
     return true;
 }
 
@@ -768,6 +780,55 @@ static GT_ATTRIBUTE_RAM_TEXT inline void _flush_scr_by_direct(_flush_scr_param_s
     }
 }
 
+#if GT_USE_DISP_COPY_AREA
+/**
+ * @brief Only the container which background is an opaque rectangle can be
+ *      moved by pixels, the content behind it is not scrolled together.
+ *      Such as: gt_obj_set_radius(obj, 0); gt_obj_set_reduce(obj, 0);
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _is_scroll_blit_enabled(gt_obj_st * obj) {
+    if (false == gt_obj_is_type(obj, GT_TYPE_OBJ)) {
+        return false;
+    }
+    if (false == gt_obj_is_show_bg(obj) || obj->opa < GT_OPA_COVER) {
+        return false;
+    }
+    if (obj->radius || obj->reduce || obj->focus || obj->mask_effect) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief The widgets drawn above the container are not scrolled, but their
+ *      pixels are moved by the blit, join the source and moved area together.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _join_scroll_blit_overlap(gt_obj_st * obj, gt_area_st const * view,
+    gt_size_t dx, gt_size_t dy, gt_area_st * dirty, bool * is_dirty) {
+    gt_area_st area = obj->area;
+    gt_area_st res;
+
+    if (GT_INVISIBLE == gt_obj_get_visible(obj)) {
+        return;
+    }
+    for (uint8_t i = 0; i < 2; i++) {
+        if (gt_area_cover_screen(view, &area, &res) && res.w && res.h) {
+            if (*is_dirty) {
+                gt_area_join(dirty, dirty, &res);
+            } else {
+                *dirty = res;
+                *is_dirty = true;
+            }
+        }
+        area.x += dx;
+        area.y += dy;
+    }
+    for (uint16_t i = 0, cnt = obj->cnt_child; i < cnt; i++) {
+        _join_scroll_blit_overlap(obj->child[i], view, dx, dy, dirty, is_dirty);
+    }
+}
+#endif
+
 static GT_ATTRIBUTE_RAM_TEXT inline gt_scr_anim_type_et _get_anti_anim_type(gt_scr_anim_type_et type) {
 #if GT_USE_SCREEN_ANIM
     if (GT_SCR_ANIM_TYPE_MOVE_LEFT == type) { type = GT_SCR_ANIM_TYPE_MOVE_RIGHT; }
@@ -806,6 +867,26 @@ static GT_ATTRIBUTE_RAM_TEXT void _layer_top_destroy_handler_cb(struct _gt_timer
     }
 }
 
+static void _invalid_obj_area(gt_obj_st * scr, gt_obj_st * obj, gt_area_st const * area) {
+    gt_area_st invalid = *area;
+#if GT_USE_LAYER_TOP
+    gt_obj_st * top = gt_disp_get_layer_top();
+
+    if (top && gt_obj_is_child(obj, top)) {
+        invalid.x += gt_obj_get_x(scr);
+        invalid.y += gt_obj_get_y(scr);
+    }
+    else if (!gt_obj_check_scr(obj)) {
+        return;
+    }
+#else
+    if( !gt_obj_check_scr(obj)){
+        return;
+    }
+#endif
+    _gt_disp_refr_append_area(&invalid);
+}
+
 /* global functions / API interface -------------------------------------*/
 gt_scr_id_t gt_disp_stack_go_back(gt_stack_size_t step)
 {
@@ -1361,23 +1442,121 @@ void gt_disp_invalid_area(gt_obj_st * obj)
         obj->area.w = gt_disp_get_res_hor(NULL);
         obj->area.h = gt_disp_get_res_ver(NULL);
     }
-    gt_area_st invalid = obj->area;
-#if GT_USE_LAYER_TOP
-    gt_obj_st * top = gt_disp_get_layer_top();
+#if GT_USE_OBJ_HIT_GRID
+    _gt_hit_grid_update(obj);
+#endif
+    _invalid_obj_area(scr, obj, &obj->area);
+}
 
-    if (top && gt_obj_is_child(obj, top)) {
-        invalid.x += gt_obj_get_x(scr);
-        invalid.y += gt_obj_get_y(scr);
-    }
-    else if (!gt_obj_check_scr(obj)) {
+void gt_disp_invalid_sub_area(gt_obj_st * obj, gt_area_st const * area)
+{
+    gt_obj_st * scr = gt_disp_get_scr();
+    if (NULL == scr || NULL == obj || NULL == area) {
         return;
     }
-#else
-    if( !gt_obj_check_scr(obj)){
+    gt_area_st invalid = {0};
+    if (false == gt_area_is_intersect_screen(&obj->area, area)) {
         return;
     }
+    gt_area_intersect_get(&invalid, &obj->area, area);
+    _invalid_obj_area(scr, obj, &invalid);
+}
+
+#if GT_USE_DISP_COPY_AREA
+bool _gt_disp_scroll_blit(gt_obj_st * obj, gt_size_t dx, gt_size_t dy)
+{
+    GT_CHECK_BACK_VAL(obj, false);
+    if (false == _is_scroll_blit_enabled(obj)) {
+        return false;
+    }
+    return _gt_disp_scroll_blit_area(obj, &obj->area, dx, dy);
+}
+
+bool _gt_disp_scroll_blit_area(gt_obj_st * obj, gt_area_st const * area, gt_size_t dx, gt_size_t dy)
+{
+    gt_disp_st * disp = gt_disp_get_default();
+    gt_area_st screen = {0}, view, src, exposed, dirty;
+    gt_point_st dst;
+    bool is_dirty = false;
+
+    GT_CHECK_BACK_VAL(obj, false);
+    GT_CHECK_BACK_VAL(area, false);
+    if (NULL == disp || NULL == disp->drv || NULL == disp->drv->copy_area_cb) {
+        return false;
+    }
+    if (GT_ROTATED_0 != disp->drv->rotated || gt_disp_drv_check_flushing(disp->drv)) {
+        return false;
+    }
+    if (disp->scr_prev || disp->area_act.x || disp->area_act.y) {
+        /** screen animation or screen scrolled, the pixels are not fixed */
+        return false;
+    }
+    if (GT_INVISIBLE == gt_obj_get_visible(obj)) {
+        return false;
+    }
+    if (obj->parent && gt_obj_within_which_scr(obj) != disp->scr_act) {
+        return false;
+    }
+    screen.w = gt_disp_get_res_hor(disp);
+    screen.h = gt_disp_get_res_ver(disp);
+    if (false == gt_area_cover_screen(&screen, area, &view)) {
+        return true;
+    }
+    /** Only the part within the object and the visible area of the parent chain is moved */
+    for (gt_obj_st * ptr = obj; ptr; ptr = ptr->parent) {
+        src = view;
+        if (false == gt_area_cover_screen(&src, &ptr->area, &view)) {
+            return true;
+        }
+    }
+    if (gt_abs(dx) >= view.w || gt_abs(dy) >= view.h) {
+        return false;
+    }
+    if (_gt_disp_refr_is_pending(&view)) {
+        /** The displayed pixels are out of date */
+        return false;
+    }
+
+    src = view;
+    if (dx > 0) { src.w -= dx; }
+    else        { src.x -= dx; src.w += dx; }
+    if (dy > 0) { src.h -= dy; }
+    else        { src.y -= dy; src.h += dy; }
+    dst.x = src.x + dx;
+    dst.y = src.y + dy;
+    disp->drv->copy_area_cb(disp->drv, &src, &dst);
+
+    if (dx) {
+        exposed = view;
+        exposed.w = gt_abs(dx);
+        if (dx < 0) { exposed.x = view.x + view.w + dx; }
+        _gt_disp_refr_append_area(&exposed);
+    }
+    if (dy) {
+        exposed = view;
+        exposed.h = gt_abs(dy);
+        if (dy < 0) { exposed.y = view.y + view.h + dy; }
+        _gt_disp_refr_append_area(&exposed);
+    }
+    /** The widgets above the container: later siblings of itself and ancestors */
+    for (gt_obj_st * ptr = obj; ptr->parent; ptr = ptr->parent) {
+        uint16_t idx = gt_obj_get_child_index(ptr->parent, ptr);
+        for (uint16_t i = idx + 1; i < ptr->parent->cnt_child; i++) {
+            _join_scroll_blit_overlap(ptr->parent->child[i], &view, dx, dy, &dirty, &is_dirty);
+        }
+    }
+#if GT_USE_LAYER_TOP
+    if (disp->layer_top) {
+        for (uint16_t i = 0; i < disp->layer_top->cnt_child; i++) {
+            _join_scroll_blit_overlap(disp->layer_top->child[i], &view, dx, dy, &dirty, &is_dirty);
+        }
+    }
 #endif
-    _gt_disp_refr_append_area(&invalid);
+    if (is_dirty) {
+        _gt_disp_refr_append_area(&dirty);
+    }
+    return true;
 }
+#endif  /** GT_USE_DISP_COPY_AREA */
 
 /* end ------------------------------------------------------------------*/
@@ -201,6 +201,46 @@ void gt_disp_scroll_area_act(gt_size_t dist_x, gt_size_t dist_y);
  */
 void gt_disp_invalid_area(gt_obj_st * obj);
 
+/**
+ * @brief Sets part of the control to be redrawn, such as a few glyphs
+ *      of a text which have been changed.
+ *
+ * @param obj
+ * @param area The area to be redrawn, clipped by the object area
+ */
+void gt_disp_invalid_sub_area(gt_obj_st * obj, gt_area_st const * area);
+
+#if GT_USE_DISP_COPY_AREA
+/**
+ * @brief [only kernel calling] The childs of the container have been moved
+ *      by (dx, dy), move the displayed pixels by the display driver and set
+ *      the newly exposed strip and the overlapped widgets to be redrawn.
+ *      Both of them are clipped by the visible area of the parent chain.
+ *
+ * @param obj The scrolled container
+ * @param dx
+ * @param dy
+ * @return true The container is handled by scroll blit
+ * @return false Not supported, container need to be redrawn entirely
+ */
+bool _gt_disp_scroll_blit(gt_obj_st * obj, gt_size_t dx, gt_size_t dy);
+
+/**
+ * @brief [only kernel calling] The contents of the object within area have been
+ *      moved by (dx, dy), such as a scrolling chart. The caller makes sure that the
+ *      pixels of the area are only changed by the contents, the rest of the object
+ *      which is not moved is redrawn by the caller.
+ *
+ * @param obj
+ * @param area The absolute area to be moved, clipped by the object
+ * @param dx
+ * @param dy
+ * @return true The area is handled by scroll blit
+ * @return false Not supported, the area need to be redrawn
+ */
+bool _gt_disp_scroll_blit_area(gt_obj_st * obj, gt_area_st const * area, gt_size_t dx, gt_size_t dy);
+#endif
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -21,17 +21,41 @@
 #include "../others/gt_gc.h"
 #include "../others/gt_anim.h"
 #include "../hal/gt_hal_indev.h"
+#include "../hal/gt_hal_tick.h"
 
 /* private define -------------------------------------------------------*/
 
 
 
 /* private typedef ------------------------------------------------------*/
+#if GT_USE_EVENT_QUEUE
+/**
+ * @brief The pending event posted by gt_event_post()
+ */
+typedef struct _gt_event_post_s {
+    struct gt_obj_s * obj;
+    void * param;
+    uint32_t timestamp;         /** The first posted time, coalesced event is not changed */
+    gt_event_type_et code_type;
+}_gt_event_post_st;
 
+/**
+ * @brief The bounded ring of the same priority pending events
+ */
+typedef struct _gt_event_ring_s {
+    _gt_event_post_st node[GT_EVENT_QUEUE_SIZE];
+    uint16_t head;
+    uint16_t count;
+}_gt_event_ring_st;
+#endif
 
 
 /* static variables -----------------------------------------------------*/
+#if GT_USE_EVENT_QUEUE
+static GT_ATTRIBUTE_LARGE_RAM_ARRAY _gt_event_ring_st _event_queue[_GT_EVENT_PRIORITY_COUNT];
 
+static GT_ATTRIBUTE_LARGE_RAM_ARRAY gt_event_queue_info_st _event_queue_info;
+#endif
 
 
 /* macros ---------------------------------------------------------------*/
@@ -151,6 +175,35 @@ static GT_ATTRIBUTE_RAM_TEXT inline gt_res_t _common_event_send(gt_event_st * e)
     return res;
 }
 
+#if GT_USE_EVENT_QUEUE
+static GT_ATTRIBUTE_RAM_TEXT inline gt_event_priority_et _get_priority_by_code(gt_event_type_et event) {
+    if (event >= _GT_EVENT_TYPE_INPUT_BEGIN && event < _GT_EVENT_TYPE_INPUT_END) {
+        return GT_EVENT_PRIORITY_INPUT;
+    }
+    if (event >= GT_EVENT_TYPE_DRAW_START && event <= GT_EVENT_TYPE_DRAW_REDRAW) {
+        return GT_EVENT_PRIORITY_DRAW;
+    }
+    return GT_EVENT_PRIORITY_NORMAL;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline _gt_event_post_st * _ring_get(_gt_event_ring_st * ring, uint16_t i) {
+    return &ring->node[(ring->head + i) % GT_EVENT_QUEUE_SIZE];
+}
+
+static GT_ATTRIBUTE_RAM_TEXT _gt_event_ring_st * _get_highest_pending_ring(void) {
+    for (uint8_t i = 0; i < _GT_EVENT_PRIORITY_COUNT; i++) {
+        if (_event_queue[i].count) {
+            return &_event_queue[i];
+        }
+    }
+    return NULL;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _event_queue_task_cb(struct _gt_timer_s * timer) {
+    gt_event_queue_flush();
+}
+#endif  /** GT_USE_EVENT_QUEUE */
+
 /* global functions / API interface -------------------------------------*/
 #if GT_USE_SCREEN_ANIM
 void gt_event_set_enabled(bool enabled)
@@ -294,6 +347,143 @@ gt_res_t gt_event_send_by_id(gt_id_t widget_id, gt_event_type_et event, void * p
     return gt_event_send(target, event, parms);
 }
 
+#if GT_USE_EVENT_QUEUE
+gt_res_t gt_event_post(struct gt_obj_s * obj, gt_event_type_et event, void * parms)
+{
+    return gt_event_post_with_priority(obj, event, parms, _get_priority_by_code(event));
+}
+
+gt_res_t gt_event_post_with_priority(struct gt_obj_s * obj, gt_event_type_et event, void * parms, gt_event_priority_et priority)
+{
+    _gt_event_ring_st * ring = NULL;
+    _gt_event_post_st * node = NULL;
+    GT_CHECK_BACK_VAL(obj, GT_RES_FAIL);
+    if (priority >= _GT_EVENT_PRIORITY_COUNT) {
+        priority = GT_EVENT_PRIORITY_NORMAL;
+    }
+    ++_event_queue_info.posted;
+
+    ring = &_event_queue[priority];
+    /**
+     * Coalesce only into the latest pending event of the object, such as:
+     *  PRESSED, RELEASED, PRESSED must be kept in order.
+     */
+    for (uint16_t i = ring->count; i > 0; i--) {
+        node = _ring_get(ring, i - 1);
+        if (node->obj != obj) {
+            continue;
+        }
+        if (node->code_type == event) {
+            node->param = parms;
+            ++_event_queue_info.coalesced;
+            return GT_RES_OK;
+        }
+        break;
+    }
+
+    if (GT_EVENT_QUEUE_SIZE == ring->count) {
+        ++_event_queue_info.dropped;
+#if GT_EVENT_QUEUE_OVERFLOW_DROP_OLDEST
+        ring->head = (ring->head + 1) % GT_EVENT_QUEUE_SIZE;
+        --ring->count;
+        --_event_queue_info.depth;
+#else
+        GT_LOGW(GT_LOG_TAG_GUI, "event queue is full, priority: %d, event: %d", priority, event);
+        return GT_RES_FAIL;
+#endif
+    }
+    node = _ring_get(ring, ring->count++);
+    node->obj = obj;
+    node->param = parms;
+    node->code_type = event;
+    node->timestamp = gt_tick_get();
+
+    if (++_event_queue_info.depth > _event_queue_info.depth_max) {
+        _event_queue_info.depth_max = _event_queue_info.depth;
+    }
+    return GT_RES_OK;
+}
+
+void gt_event_queue_flush(void)
+{
+    _gt_event_ring_st * ring = NULL;
+    _gt_event_post_st node;
+    uint32_t latency = 0;
+    /** Avoid to dispatch forever, if the callback keeps posting new events */
+    uint16_t budget = GT_EVENT_QUEUE_SIZE * _GT_EVENT_PRIORITY_COUNT;
+
+#if GT_USE_SCREEN_ANIM
+    if (false == gt_event_is_enabled()) {
+        /** Keep pending until the screen animation finish */
+        return;
+    }
+#endif
+    while (budget--) {
+        /** Always re-check, the higher priority events may be posted by callback */
+        ring = _get_highest_pending_ring();
+        if (NULL == ring) {
+            break;
+        }
+        node = ring->node[ring->head];
+        ring->head = (ring->head + 1) % GT_EVENT_QUEUE_SIZE;
+        --ring->count;
+        --_event_queue_info.depth;
+
+        latency = gt_tick_elapse(node.timestamp);
+        _event_queue_info.latency_total += latency;
+        if (latency > _event_queue_info.latency_max) {
+            _event_queue_info.latency_max = latency;
+        }
+        ++_event_queue_info.dispatched;
+
+        gt_event_send(node.obj, node.code_type, node.param);
+    }
+}
+
+void _gt_event_queue_remove_obj(struct gt_obj_s * obj)
+{
+    _gt_event_ring_st * ring = NULL;
+    uint16_t keep = 0;
+
+    for (uint8_t p = 0; p < _GT_EVENT_PRIORITY_COUNT; p++) {
+        ring = &_event_queue[p];
+        keep = 0;
+        for (uint16_t i = 0; i < ring->count; i++) {
+            if (_ring_get(ring, i)->obj == obj) {
+                continue;
+            }
+            if (keep != i) {
+                *_ring_get(ring, keep) = *_ring_get(ring, i);
+            }
+            ++keep;
+        }
+        _event_queue_info.depth -= ring->count - keep;
+        ring->count = keep;
+    }
+}
+
+void gt_event_queue_get_info(gt_event_queue_info_st * info)
+{
+    GT_CHECK_BACK(info);
+    *info = _event_queue_info;
+}
+
+void gt_event_queue_reset_info(void)
+{
+    uint16_t depth = _event_queue_info.depth;
+    gt_memset_0(&_event_queue_info, sizeof(gt_event_queue_info_st));
+    _event_queue_info.depth = depth;
+    _event_queue_info.depth_max = depth;
+}
+
+void _gt_event_queue_init(void)
+{
+    gt_memset_0(_event_queue, sizeof(_event_queue));
+    gt_memset_0(&_event_queue_info, sizeof(gt_event_queue_info_st));
+    _gt_timer_create(_event_queue_task_cb, GT_TASK_PERIOD_TIME_EVENT, NULL);
+}
+#endif  /** GT_USE_EVENT_QUEUE */
+
 #if GT_USE_LAYER_TOP
 void gt_global_add_event_cb(gt_event_cb_t event, gt_event_type_et filter, void * user_data)
 {
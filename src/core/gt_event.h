@@ -113,6 +113,33 @@ typedef struct _gt_event_s {
  */
 typedef void (* gt_event_cb_t)(gt_event_st * e);
 
+#if GT_USE_EVENT_QUEUE
+/**
+ * @brief The dispatch priority of the posted event, the higher priority
+ *      pending events are always dispatched first.
+ */
+typedef enum gt_event_priority_e {
+    GT_EVENT_PRIORITY_INPUT = 0,    /** Input device events */
+    GT_EVENT_PRIORITY_NORMAL,       /** Value update, change and notify events */
+    GT_EVENT_PRIORITY_DRAW,         /** Redraw related events */
+    _GT_EVENT_PRIORITY_COUNT,
+}gt_event_priority_et;
+
+/**
+ * @brief The statistics of the deferred event queue
+ */
+typedef struct gt_event_queue_info_s {
+    uint32_t posted;            /** The count of gt_event_post() called */
+    uint32_t coalesced;         /** The count of merged into pending event */
+    uint32_t dropped;           /** The count of discarded by overflow */
+    uint32_t dispatched;        /** The count of dispatched events */
+    uint32_t latency_total;     /** ms, from first post to dispatch, average: latency_total / dispatched */
+    uint32_t latency_max;       /** ms */
+    uint16_t depth;             /** The current pending events count */
+    uint16_t depth_max;         /** The maximum pending events count */
+}gt_event_queue_info_st;
+#endif  /** GT_USE_EVENT_QUEUE */
+
 /* macros ---------------------------------------------------------------*/
 
 
@@ -208,6 +235,63 @@ gt_res_t gt_event_send_to_childs(struct gt_obj_s * parent, gt_event_type_et even
  */
 gt_res_t gt_event_send_by_id(gt_id_t widget_id, gt_event_type_et event, void * parms);
 
+#if GT_USE_EVENT_QUEUE
+/**
+ * @brief [Deferred] Post an event code to the object, the event is dispatched
+ *      by gt_event_send() within the event task of gt_task_handler().
+ *      If the latest pending event of the object has the same event code,
+ *      they are coalesced into one event, and the newer parms is used.
+ *      The events with different code are never merged or reordered.
+ *
+ * @param obj Object which want to be notified
+ * @param event The event code to post, the priority is classified by code
+ * @param parms User data [default or unused: NULL], it must be valid until dispatched
+ * @return gt_res_t GT_RES_OK: posted or coalesced; GT_RES_FAIL: queue is full
+ */
+gt_res_t gt_event_post(struct gt_obj_s * obj, gt_event_type_et event, void * parms);
+
+/**
+ * @brief [Deferred] Post an event code with the custom priority.
+ *
+ * @param obj
+ * @param event
+ * @param parms
+ * @param priority @ref gt_event_priority_et
+ * @return gt_res_t
+ */
+gt_res_t gt_event_post_with_priority(struct gt_obj_s * obj, gt_event_type_et event, void * parms, gt_event_priority_et priority);
+
+/**
+ * @brief Dispatch all of the pending events immediately.
+ */
+void gt_event_queue_flush(void);
+
+/**
+ * @brief [Called by core inside] Discard the pending events of the object,
+ *      such as the object is deleting.
+ *
+ * @param obj
+ */
+void _gt_event_queue_remove_obj(struct gt_obj_s * obj);
+
+/**
+ * @brief Get the statistics of the deferred event queue
+ *
+ * @param info [out]
+ */
+void gt_event_queue_get_info(gt_event_queue_info_st * info);
+
+/**
+ * @brief Reset the statistics, except the current depth
+ */
+void gt_event_queue_reset_info(void);
+
+/**
+ * @brief [Called by core inside] Create the dispatch task
+ */
+void _gt_event_queue_init(void);
+#endif  /** GT_USE_EVENT_QUEUE */
+
 #if GT_USE_LAYER_TOP
 /**
  * @brief Adding an event to the global, can be called by any time, any screen or widget
@@ -324,6 +324,18 @@ uint32_t gt_fs_read_direct_physical(gt_addr_t addr, uint32_t len, uint8_t * data
     return drv->rw_cb(data_write, len_write, data, len);
 }
 
+#if GT_USE_MODE_FLASH
+uint32_t gt_fs_write_direct_physical(gt_addr_t addr, uint32_t len, uint8_t const * data)
+{
+    return gt_vf_flash_program(addr, data, len);
+}
+
+gt_fs_res_et gt_fs_erase_direct_physical(gt_addr_t addr, uint32_t len)
+{
+    return gt_vf_flash_erase(addr, len);
+}
+#endif
+
 void gt_fs_close(gt_fs_fp_st * fp)
 {
     GT_CHECK_BACK(fp);
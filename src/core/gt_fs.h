@@ -182,6 +182,27 @@ gt_fs_res_et gt_fs_direct_addr_read_img_wh(gt_addr_t addr, uint16_t * w, uint16_
  */
 uint32_t gt_fs_read_direct_physical(gt_addr_t addr, uint32_t len, uint8_t * data);
 
+#if GT_USE_MODE_FLASH
+/**
+ * @brief Directly program the physical data into flash, the range must be erased before.
+ *
+ * @param addr Flash address
+ * @param len The number of bytes to write
+ * @param data The data to write
+ * @return uint32_t The number of bytes programmed
+ */
+uint32_t gt_fs_write_direct_physical(gt_addr_t addr, uint32_t len, uint8_t const * data);
+
+/**
+ * @brief Directly erase the flash sectors which are covered by [addr, addr + len)
+ *
+ * @param addr Flash address
+ * @param len The number of bytes to erase
+ * @return gt_fs_res_et The result status
+ */
+gt_fs_res_et gt_fs_erase_direct_physical(gt_addr_t addr, uint32_t len);
+#endif
+
 /**
  * @brief Close the file operation handler, which need to
  *      be called after gt_fs_open().
@@ -36,6 +36,23 @@ extern "C" {
 
 #define GT_RADIUS_MIN   2
 
+#ifndef GT_GRAPHS_USE_FIXED_POINT
+    /**
+     * @brief Store the points value of the graphs series as int16 fixed-point
+     *      number instead of float, half or quarter of the memory is required.
+     *      [Default]0: float value; 1: fixed-point value, @ref GT_GRAPHS_FIXED_POINT_SHIFT
+     */
+    #define GT_GRAPHS_USE_FIXED_POINT       0
+#endif
+
+#ifndef GT_GRAPHS_FIXED_POINT_SHIFT
+    /**
+     * @brief The fraction bits of the fixed-point value, such as:
+     *      [Default]4: 1/16 precision, value range: -2048.0 ~ 2047.9375
+     */
+    #define GT_GRAPHS_FIXED_POINT_SHIFT     4
+#endif
+
 /* typedef --------------------------------------------------------------*/
 
 #if 0
@@ -94,14 +111,28 @@ typedef struct _gt_attr_curve_s {
     gt_line_st line;
 }gt_attr_curve_st;
 
+#if GT_GRAPHS_USE_FIXED_POINT
+typedef int16_t gt_series_value_t;
+#else
+typedef gt_float_t gt_series_value_t;
+#endif
+
+/**
+ * @brief The points of the series are stored in a ring buffer,
+ *      the index of point i is (head + i) % capacity.
+ */
 typedef struct gt_series_points_s {
     struct gt_series_points_s * next_series_p;
-    gt_float_t * x_series;
-    gt_float_t * y_series;
-    char ** point_value_str;
+    gt_series_value_t * x_series;   /** NULL: fifo mode, x value is calculated by the point index */
+    gt_series_value_t * y_series;
+    char ** point_value_str;        /** NULL: none of the points has value text */
+    struct _gt_series_cache_s * cache;  /** The pixel columns cache of the series, @ref gt_graphs.c */
     gt_color_t point_value_font_color;
     gt_line_st line;
     uint16_t count_point;
+    uint16_t capacity;          /** The count of points which can be stored */
+    uint16_t head;              /** The index of the oldest point */
+    uint32_t fifo_seq;          /** fifo mode: The sequence of the oldest point, increased when a point is dropped */
     uint8_t font_line_space;    // Spacing between point value characters and lines
     /** point value display position, true: bottom of line; false[default]: top of line */
     uint8_t show_point_value : 1;
@@ -38,6 +38,8 @@
 
 #if _GT_USE_TEST
 #include "../../test/gt_test_rand_widget.h"
+#include "../../test/gt_test_serial_flash.h"
+#include "../../test/gt_test_vector.h"
 #endif
 
 /* private define -------------------------------------------------------*/
@@ -75,8 +77,8 @@ static void gt_print_info_start(void) {
 
     GT_LOG_A(GT_LOG_TAG_LCD, "Flush style: %d", GT_REFRESH_STYLE);
 
-    GT_LOG_A(GT_LOG_TAG_TIM, "Indev: %d, Event: %d, Anim: %d, Refr: %d, Serial: %d",
-        GT_TASK_PERIOD_TIME_INDEV, GT_TASK_PERIOD_TIME_EVENT, GT_TASK_PERIOD_TIME_ANIM, GT_TASK_PERIOD_TIME_REFR, GT_TASK_PERIOD_TIME_SERIAL);
+    GT_LOG_A(GT_LOG_TAG_TIM, "Indev: %d, Event: %d, Refr(Anim): %d, Serial: %d",
+        GT_TASK_PERIOD_TIME_INDEV, GT_TASK_PERIOD_TIME_EVENT, GT_TASK_PERIOD_TIME_REFR, GT_TASK_PERIOD_TIME_SERIAL);
 
     GT_LOG_A(GT_LOG_TAG_FS, "Enabled src array: [%s], prefix name: \"%c\"", GT_USE_MODE_SRC ? "Yes" : "No", GT_FS_LABEL_ARRAY);
 
@@ -164,6 +166,10 @@ void gt_init(void)
 
     _gt_timer_core_init();
 
+#if GT_USE_EVENT_QUEUE
+    _gt_event_queue_init();
+#endif
+
     _gt_anim_core_init();
 
     _gt_img_decoder_init();
@@ -178,6 +184,14 @@ void gt_init(void)
     _gt_serial_core_init();
 #endif
 
+#if _GT_TEST_SERIAL_FLASH
+    _gt_test_serial_flash();
+#endif
+
+#if _GT_TEST_VECTOR_BENCH
+    _gt_test_vector_bench();
+#endif
+
 #if GT_BOOTING_INFO_MSG
     gt_print_info_end();
 #endif
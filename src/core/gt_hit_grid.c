@@ -0,0 +1,243 @@
+/**
+ * @file gt_hit_grid.c
+ * @author Feyoung
+ * @brief Uniform grid spatial index, which is used to speed up the
+ *      pointer hit testing of the widgets.
+ * @version 0.1
+ * @date 2026-10-19 10:12:45
+ * @copyright Copyright (c) 2014-present, Company Genitop. Co., Ltd.
+ */
+
+/* include --------------------------------------------------------------*/
+#include "gt_hit_grid.h"
+
+#if GT_USE_OBJ_HIT_GRID
+#include "gt_mem.h"
+#include "gt_disp.h"
+#include "../hal/gt_hal_disp.h"
+#include "../others/gt_log.h"
+#include "../others/gt_math.h"
+
+
+/* private define -------------------------------------------------------*/
+#define _GT_HIT_GRID_CELLS_COUNT    (_GT_HIT_GRID_COLS * _GT_HIT_GRID_ROWS)
+
+#if _GT_HIT_GRID_COLS >= _GT_HIT_GRID_RANGE_NONE || _GT_HIT_GRID_ROWS >= _GT_HIT_GRID_RANGE_NONE
+    #error "GT_OBJ_HIT_GRID_CELL_SIZE is too small, the grid must be less than 255 x 255 cells"
+#endif
+
+
+/* private typedef ------------------------------------------------------*/
+/**
+ * @brief The objects which touch area covered the cell
+ */
+typedef struct _gt_hit_grid_cell_s {
+    gt_obj_st ** objs;
+    uint16_t cnt;
+    uint16_t cap;
+}_gt_hit_grid_cell_st;
+
+
+/* static variables -----------------------------------------------------*/
+static GT_ATTRIBUTE_LARGE_RAM_ARRAY _gt_hit_grid_cell_st _cells[_GT_HIT_GRID_CELLS_COUNT];
+
+static GT_ATTRIBUTE_LARGE_RAM_ARRAY gt_hit_grid_info_st _info = {
+    .cells = _GT_HIT_GRID_CELLS_COUNT,
+};
+
+
+/* macros ---------------------------------------------------------------*/
+
+
+
+/* static functions -----------------------------------------------------*/
+/**
+ * @brief Map the coordinate to the cell index, the coordinate out of the
+ *      grid is clamped to the edge cells, so that the widgets which are
+ *      scrolled out of the screen are still able to be indexed.
+ */
+static GT_ATTRIBUTE_RAM_TEXT inline uint8_t _coord_to_cell(int32_t val, uint8_t max) {
+    if (val < 0) {
+        return 0;
+    }
+    val /= GT_OBJ_HIT_GRID_CELL_SIZE;
+    return val >= max ? max - 1 : (uint8_t)val;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _calc_range(gt_obj_st * obj, gt_hit_grid_range_st * range) {
+    int32_t x0 = obj->area.x, y0 = obj->area.y;
+    int32_t x1 = obj->area.x + obj->area.w, y1 = obj->area.y + obj->area.h;
+#if GT_USE_CUSTOM_TOUCH_EXPAND_SIZE
+    x0 -= obj->touch_expand_size.x;
+    y0 -= obj->touch_expand_size.y;
+    x1 += obj->touch_expand_size.x;
+    y1 += obj->touch_expand_size.y;
+#endif
+    range->x0 = _coord_to_cell(x0, _GT_HIT_GRID_COLS);
+    range->y0 = _coord_to_cell(y0, _GT_HIT_GRID_ROWS);
+    range->x1 = _coord_to_cell(x1, _GT_HIT_GRID_COLS);
+    range->y1 = _coord_to_cell(y1, _GT_HIT_GRID_ROWS);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT bool _cell_push(_gt_hit_grid_cell_st * cell, gt_obj_st * obj) {
+    if (cell->cnt == cell->cap) {
+        uint16_t cap = cell->cap ? (cell->cap << 1) : 4;
+        gt_obj_st ** objs = (gt_obj_st ** )gt_mem_realloc(cell->objs, cap * sizeof(gt_obj_st * ));
+        if (NULL == objs) {
+            GT_LOGW(GT_LOG_TAG_GUI, "hit grid cell realloc failed, size: %d", cap);
+            return false;
+        }
+        cell->objs = objs;
+        cell->cap = cap;
+    }
+    cell->objs[cell->cnt++] = obj;
+    if (cell->cnt > _info.max_cell) {
+        _info.max_cell = cell->cnt;
+    }
+    ++_info.entries;
+    return true;
+}
+
+/**
+ * @brief Swap remove, the order of the objects within a cell is meaningless,
+ *      the paint order is resolved by the object tree while querying.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _cell_pop(_gt_hit_grid_cell_st * cell, gt_obj_st * obj) {
+    for (uint16_t i = 0; i < cell->cnt; i++) {
+        if (cell->objs[i] != obj) {
+            continue;
+        }
+        cell->objs[i] = cell->objs[--cell->cnt];
+        --_info.entries;
+        break;
+    }
+    if (0 == cell->cnt && cell->objs) {
+        gt_mem_free(cell->objs);
+        cell->objs = NULL;
+        cell->cap = 0;
+    }
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _index_range(gt_obj_st * obj, gt_hit_grid_range_st const * const range) {
+    for (uint8_t y = range->y0; y <= range->y1; y++) {
+        for (uint8_t x = range->x0; x <= range->x1; x++) {
+            _cell_push(&_cells[y * _GT_HIT_GRID_COLS + x], obj);
+        }
+    }
+    obj->hit_range = *range;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _unindex_range(gt_obj_st * obj) {
+    gt_hit_grid_range_st * range = &obj->hit_range;
+    if (_GT_HIT_GRID_RANGE_NONE == range->x0) {
+        return;
+    }
+    for (uint8_t y = range->y0; y <= range->y1; y++) {
+        for (uint8_t x = range->x0; x <= range->x1; x++) {
+            _cell_pop(&_cells[y * _GT_HIT_GRID_COLS + x], obj);
+        }
+    }
+    range->x0 = _GT_HIT_GRID_RANGE_NONE;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _index_tree(gt_obj_st * obj) {
+    if (obj->parent) {
+        obj->hit_range.x0 = _GT_HIT_GRID_RANGE_NONE;
+        _gt_hit_grid_insert(obj);
+    }
+    for (uint16_t i = 0, cnt = obj->cnt_child; i < cnt; i++) {
+        _index_tree(obj->child[i]);
+    }
+}
+
+/* global functions / API interface -------------------------------------*/
+void _gt_hit_grid_insert(gt_obj_st * obj)
+{
+    gt_hit_grid_range_st range;
+    GT_CHECK_BACK(obj);
+    if (NULL == obj->parent) {
+        obj->hit_range.x0 = _GT_HIT_GRID_RANGE_NONE;
+        return;
+    }
+    if (GT_INVISIBLE == obj->visible) {
+        obj->hit_range.x0 = _GT_HIT_GRID_RANGE_NONE;
+        return;
+    }
+    _calc_range(obj, &range);
+    _index_range(obj, &range);
+}
+
+void _gt_hit_grid_remove(gt_obj_st * obj)
+{
+    GT_CHECK_BACK(obj);
+    _unindex_range(obj);
+}
+
+void _gt_hit_grid_update(gt_obj_st * obj)
+{
+    gt_hit_grid_range_st range;
+    GT_CHECK_BACK(obj);
+    if (NULL == obj->parent) {
+        return;
+    }
+    if (GT_INVISIBLE == obj->visible) {
+        /** Hidden widget can not be clicked, the children are filtered by the query */
+        _unindex_range(obj);
+        return;
+    }
+    _calc_range(obj, &range);
+    if (range.x0 == obj->hit_range.x0 && range.y0 == obj->hit_range.y0 &&
+        range.x1 == obj->hit_range.x1 && range.y1 == obj->hit_range.y1) {
+        return;
+    }
+    _unindex_range(obj);
+    _index_range(obj, &range);
+}
+
+void gt_hit_grid_rebuild(void)
+{
+    gt_disp_st * disp = gt_disp_get_default();
+
+    for (uint16_t i = 0; i < _GT_HIT_GRID_CELLS_COUNT; i++) {
+        if (_cells[i].objs) {
+            gt_mem_free(_cells[i].objs);
+        }
+        _cells[i].objs = NULL;
+        _cells[i].cnt = 0;
+        _cells[i].cap = 0;
+    }
+    _info.entries = 0;
+    _info.max_cell = 0;
+
+    GT_CHECK_BACK(disp);
+    for (uint16_t i = 0; i < disp->cnt_scr; i++) {
+        _index_tree(disp->screens[i]);
+    }
+#if GT_USE_LAYER_TOP
+    if (disp->layer_top) {
+        _index_tree(disp->layer_top);
+    }
+#endif
+}
+
+gt_obj_st ** _gt_hit_grid_get_candidates(gt_point_st const * const point, uint16_t * cnt)
+{
+    uint8_t x = _coord_to_cell(point->x, _GT_HIT_GRID_COLS);
+    uint8_t y = _coord_to_cell(point->y, _GT_HIT_GRID_ROWS);
+    _gt_hit_grid_cell_st * cell = &_cells[y * _GT_HIT_GRID_COLS + x];
+
+    ++_info.queries;
+    _info.candidates += cell->cnt;
+    *cnt = cell->cnt;
+    return cell->objs;
+}
+
+void gt_hit_grid_get_info(gt_hit_grid_info_st * info)
+{
+    GT_CHECK_BACK(info);
+    *info = _info;
+}
+
+#endif  /** GT_USE_OBJ_HIT_GRID */
+
+/* end ------------------------------------------------------------------*/
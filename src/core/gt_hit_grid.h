@@ -0,0 +1,108 @@
+/**
+ * @file gt_hit_grid.h
+ * @author Feyoung
+ * @brief Uniform grid spatial index, which is used to speed up the
+ *      pointer hit testing of the widgets.
+ * @version 0.1
+ * @date 2026-10-19 10:12:40
+ * @copyright Copyright (c) 2014-present, Company Genitop. Co., Ltd.
+ */
+#ifndef _GT_HIT_GRID_H_
+#define _GT_HIT_GRID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* include --------------------------------------------------------------*/
+#include "stdint.h"
+#include "stdbool.h"
+#include "../gt_conf.h"
+#include "../widgets/gt_obj.h"
+
+#if GT_USE_OBJ_HIT_GRID
+
+/* define ---------------------------------------------------------------*/
+
+/** The number of the grid cells in horizontal direction */
+#define _GT_HIT_GRID_COLS   ((GT_SCREEN_WIDTH + GT_OBJ_HIT_GRID_CELL_SIZE - 1) / GT_OBJ_HIT_GRID_CELL_SIZE)
+
+/** The number of the grid cells in vertical direction */
+#define _GT_HIT_GRID_ROWS   ((GT_SCREEN_HEIGHT + GT_OBJ_HIT_GRID_CELL_SIZE - 1) / GT_OBJ_HIT_GRID_CELL_SIZE)
+
+/** The object has not been indexed by the grid yet */
+#define _GT_HIT_GRID_RANGE_NONE     (0xFF)
+
+
+/* typedef --------------------------------------------------------------*/
+
+/**
+ * @brief The status of the grid index
+ */
+typedef struct gt_hit_grid_info_s {
+    uint32_t entries;       /** The total number of the object entries in all of cells */
+    uint32_t queries;       /** The number of the point queries */
+    uint32_t candidates;    /** The number of the objects checked by all of queries */
+    uint16_t max_cell;      /** The maximum number of the objects within a cell */
+    uint16_t cells;         /** The number of the cells */
+}gt_hit_grid_info_st;
+
+
+/* macros ---------------------------------------------------------------*/
+
+
+
+/* global functions / API interface -------------------------------------*/
+
+/**
+ * @brief Add the object into the cells which covered by its touch area.
+ *      Screen or layer top object (parent is NULL) and invisible object
+ *      are not indexed.
+ *
+ * @param obj
+ */
+void _gt_hit_grid_insert(gt_obj_st * obj);
+
+/**
+ * @brief Remove the object from all of the cells it indexed.
+ *
+ * @param obj
+ */
+void _gt_hit_grid_remove(gt_obj_st * obj);
+
+/**
+ * @brief Re-index the object if its touch area covered different cells,
+ *      it is cheap when the cells are not changed. Invisible object is removed.
+ *
+ * @param obj
+ */
+void _gt_hit_grid_update(gt_obj_st * obj);
+
+/**
+ * @brief Clear all of the cells and index all of the screens and layer top again.
+ */
+void gt_hit_grid_rebuild(void);
+
+/**
+ * @brief Get the candidate objects of the cell which contains the point.
+ *
+ * @param point The point within the virtual screen
+ * @param cnt [out] The count of the candidate objects
+ * @return gt_obj_st** The candidate objects array, NULL: empty cell
+ */
+gt_obj_st ** _gt_hit_grid_get_candidates(gt_point_st const * const point, uint16_t * cnt);
+
+/**
+ * @brief Get the status of the grid index
+ *
+ * @param info [out]
+ */
+void gt_hit_grid_get_info(gt_hit_grid_info_st * info);
+
+#endif  /** GT_USE_OBJ_HIT_GRID */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif //!_GT_HIT_GRID_H_
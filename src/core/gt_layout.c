@@ -13,6 +13,7 @@
 #include "./gt_style.h"
 #include "../others/gt_log.h"
 #include "./gt_draw.h"
+#include "./gt_hit_grid.h"
 
 
 /* private define -------------------------------------------------------*/
@@ -279,6 +280,9 @@ static GT_ATTRIBUTE_RAM_TEXT gt_area_st _childs_sort_by_flex_direction(gt_obj_st
                 parent->area.w = pos.w;
             }
         }
+#if GT_USE_OBJ_HIT_GRID
+        _gt_hit_grid_update(parent);
+#endif
         if (GT_LAYOUT_JUSTIFY_CONTENT_END == jc) {
             if (is_row) {
                 pos.x += (parent->radius >> 1);
@@ -13,6 +13,11 @@
 #include "gt_mem.h"
 #include "../gt_conf.h"
 #include "../others/gt_log.h"
+#if GT_USE_MEM_SLAB
+#include "gt_timer.h"
+#include "../widgets/gt_obj.h"
+#include "../others/gt_anim.h"
+#endif
 
 #include GT_MEM_CUSTOM_INCLUDE
 
@@ -105,7 +110,45 @@
 
 
 
+#if GT_USE_MEM_SLAB
+    #define _SLAB_PAGE_COUNT        (GT_MEM_SLAB_SIZE / GT_MEM_SLAB_PAGE_SIZE)
+    #define _SLAB_NIL               0xFF
+    #define _SLAB_OFFSET_NIL        0xFFFF
+    #define _SLAB_ALIGN(_size)      (((_size) + 7) & ~7U)
+
+    #if _SLAB_PAGE_COUNT < 1 || _SLAB_PAGE_COUNT >= _SLAB_NIL
+        #error "GT_MEM_SLAB_SIZE / GT_MEM_SLAB_PAGE_SIZE must be within [1, 254] pages"
+    #endif
+    #if GT_MEM_SLAB_PAGE_SIZE & 0x07 || GT_MEM_SLAB_PAGE_SIZE >= _SLAB_OFFSET_NIL
+        #error "GT_MEM_SLAB_PAGE_SIZE must be multiple of 8 and less than 64KB"
+    #endif
+#endif
+
 /* private typedef ------------------------------------------------------*/
+#if GT_USE_MEM_SLAB
+/**
+ * @brief The page of the slab, the released blocks are linked by the
+ *      offset which saved in the first two bytes of the block.
+ */
+typedef struct _gt_slab_page_s {
+    uint16_t free_head;     /** The offset of the first released block, _SLAB_OFFSET_NIL: none */
+    uint16_t bump;          /** The offset of the area which has never been allocated */
+    uint16_t used;
+    uint8_t cls;            /** The index of the class, _SLAB_NIL: free page */
+    uint8_t prev;
+    uint8_t next;
+}_gt_slab_page_st;
+
+typedef struct _gt_slab_class_s {
+    uint32_t fallback;
+    uint16_t size;
+    uint16_t per_page;
+    uint16_t pages;
+    uint16_t used;
+    uint16_t peak;
+    uint8_t partial;        /** The pages list which still have free blocks */
+}_gt_slab_class_st;
+#endif
 
 /**
  * @brief 指针
@@ -137,6 +180,34 @@ static gt_mem_hooks_st _self = {
 };
 #endif
 
+#if GT_USE_MEM_SLAB
+/**
+ * @brief The size classes, which are tuned to the most frequently allocated
+ *      structures, sorted and merged by gt_mem_init(). The style struct
+ *      of the widgets is private, whose class is added by the first created
+ *      widget, @ref _gt_mem_slab_add_class().
+ */
+static const uint16_t _slab_class_size_def[] = {
+    16,
+    _SLAB_ALIGN(sizeof(gt_obj_event_attr_st)),
+    _SLAB_ALIGN(sizeof(_gt_timer_st)),
+    _SLAB_ALIGN(sizeof(gt_obj_st)),
+    _SLAB_ALIGN(sizeof(gt_anim_st)),
+};
+
+#define _SLAB_CLASS_COUNT_DEF   (sizeof(_slab_class_size_def) / sizeof(_slab_class_size_def[0]))
+#define _SLAB_CLASS_COUNT_MAX   (_SLAB_CLASS_COUNT_DEF + GT_MEM_SLAB_STYLE_CLASS_COUNT)
+
+static GT_ATTRIBUTE_LARGE_RAM_ARRAY struct {
+    uint8_t * base;
+    _gt_slab_page_st page[_SLAB_PAGE_COUNT];
+    _gt_slab_class_st cls[_SLAB_CLASS_COUNT_MAX];
+    uint8_t cnt_cls;
+    uint8_t free_page;      /** The free pages list */
+    uint8_t cnt_free_page;
+}_slab;
+#endif
+
 #if USE_MEM_MAX_REMARK
 static MEM_UNIT _max_addr = 0;
 static MEM_UNIT _malloc_count = 0;
@@ -148,23 +219,6 @@ static MEM_UNIT _malloc_count = 0;
 
 /* static functions -----------------------------------------------------*/
 
-
-#if USE_MEM_TRACE_DEBUG_BY_FILE || USE_MEM_MAX_REMARK || USE_MEM_BIG_UNIT_REMARK || USE_MEM_LOG_PRINT
-static GT_ATTRIBUTE_RAM_TEXT size_t _gt_block_size(void * ptr) {
-    size_t size = 0;
-
-#if GT_MEM_CUSTOM
-    size = gt_tlsf_block_size(ptr);
-#else
-    if (_self.block_size_hooks) {
-        size = _self.block_size_hooks(ptr);
-    }
-#endif
-
-    return size;
-}
-#endif
-
 /**
  * @brief 申请内存
  *
@@ -217,6 +271,241 @@ static GT_ATTRIBUTE_RAM_TEXT inline void _gt_free_hooks(void * ptr) {
 #endif
 }
 
+#if GT_USE_MEM_SLAB
+static GT_ATTRIBUTE_RAM_TEXT void _slab_list_push(uint8_t * head, uint8_t idx) {
+    _slab.page[idx].prev = _SLAB_NIL;
+    _slab.page[idx].next = *head;
+    if (_SLAB_NIL != *head) {
+        _slab.page[*head].prev = idx;
+    }
+    *head = idx;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _slab_list_unlink(uint8_t * head, uint8_t idx) {
+    _gt_slab_page_st * page = &_slab.page[idx];
+    if (_SLAB_NIL != page->prev) {
+        _slab.page[page->prev].next = page->next;
+    } else {
+        *head = page->next;
+    }
+    if (_SLAB_NIL != page->next) {
+        _slab.page[page->next].prev = page->prev;
+    }
+}
+
+/**
+ * @brief Insert the size class in ascending order, the duplicated is merged,
+ *      the class index of the pages in use is moved together.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _slab_class_insert(uint16_t size) {
+    uint8_t i = 0, k = 0;
+
+    if (size > GT_MEM_SLAB_PAGE_SIZE || _slab.cnt_cls >= _SLAB_CLASS_COUNT_MAX) {
+        return;
+    }
+    for (k = _slab.cnt_cls; k > 0 && _slab.cls[k - 1].size > size; k--);
+    if (k && _slab.cls[k - 1].size == size) {
+        return;
+    }
+    gt_memmove(&_slab.cls[k + 1], &_slab.cls[k], (_slab.cnt_cls - k) * sizeof(_gt_slab_class_st));
+    gt_memset_0(&_slab.cls[k], sizeof(_gt_slab_class_st));
+    _slab.cls[k].size = size;
+    _slab.cls[k].per_page = GT_MEM_SLAB_PAGE_SIZE / size;
+    _slab.cls[k].partial = _SLAB_NIL;
+    ++_slab.cnt_cls;
+
+    for (i = 0; i < _SLAB_PAGE_COUNT; i++) {
+        if (_SLAB_NIL != _slab.page[i].cls && _slab.page[i].cls >= k) {
+            ++_slab.page[i].cls;
+        }
+    }
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _slab_init(void) {
+    uint8_t i = 0;
+
+    gt_memset_0(&_slab, sizeof(_slab));
+    _slab.free_page = _SLAB_NIL;
+    for (i = 0; i < _SLAB_CLASS_COUNT_DEF; i++) {
+        _slab_class_insert(_slab_class_size_def[i]);
+    }
+
+    _slab.base = (uint8_t * )_gt_malloc_hooks(GT_MEM_SLAB_SIZE);
+    if (NULL == _slab.base) {
+        GT_LOGW(GT_LOG_TAG_MEM, "slab reserve failed, size: %d", GT_MEM_SLAB_SIZE);
+        return;
+    }
+    for (i = _SLAB_PAGE_COUNT; i > 0; i--) {
+        _slab.page[i - 1].cls = _SLAB_NIL;
+        _slab_list_push(&_slab.free_page, i - 1);
+    }
+    _slab.cnt_free_page = _SLAB_PAGE_COUNT;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline bool _slab_is_owner(void * ptr) {
+    return _slab.base && (uint8_t * )ptr >= _slab.base &&
+            (uint8_t * )ptr < _slab.base + _SLAB_PAGE_COUNT * GT_MEM_SLAB_PAGE_SIZE;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline uint8_t _slab_page_of(void * ptr) {
+    return (uint8_t)(((uint8_t * )ptr - _slab.base) / GT_MEM_SLAB_PAGE_SIZE);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline uint16_t _slab_block_size(void * ptr) {
+    return _slab.cls[_slab.page[_slab_page_of(ptr)].cls].size;
+}
+
+/**
+ * @brief Allocate a block from the smallest class which fits the size
+ *
+ * @return void* NULL: the size is too large or no free page, need to fall back to heap
+ */
+static GT_ATTRIBUTE_RAM_TEXT void * _slab_alloc(size_t size) {
+    _gt_slab_class_st * cls = NULL;
+    _gt_slab_page_st * page = NULL;
+    uint8_t * ptr = NULL;
+    uint8_t c = 0, idx = 0;
+
+    if (NULL == _slab.base || 0 == size) {
+        return NULL;
+    }
+    for (c = 0; c < _slab.cnt_cls && _slab.cls[c].size < size; c++);
+    if (c == _slab.cnt_cls) {
+        return NULL;
+    }
+    cls = &_slab.cls[c];
+    if (_SLAB_NIL == cls->partial) {
+        if (_SLAB_NIL == _slab.free_page) {
+            ++cls->fallback;
+            return NULL;
+        }
+        idx = _slab.free_page;
+        _slab_list_unlink(&_slab.free_page, idx);
+        --_slab.cnt_free_page;
+        page = &_slab.page[idx];
+        page->cls = c;
+        page->used = 0;
+        page->bump = 0;
+        page->free_head = _SLAB_OFFSET_NIL;
+        _slab_list_push(&cls->partial, idx);
+        ++cls->pages;
+    }
+    idx = cls->partial;
+    page = &_slab.page[idx];
+    ptr = _slab.base + idx * GT_MEM_SLAB_PAGE_SIZE;
+    if (_SLAB_OFFSET_NIL != page->free_head) {
+        ptr += page->free_head;
+        page->free_head = *(uint16_t * )ptr;
+    } else {
+        ptr += page->bump;
+        page->bump += cls->size;
+    }
+    if (++page->used == cls->per_page) {
+        _slab_list_unlink(&cls->partial, idx);
+    }
+    if (++cls->used > cls->peak) {
+        cls->peak = cls->used;
+    }
+    return ptr;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _slab_free(void * ptr) {
+    uint8_t idx = _slab_page_of(ptr);
+    _gt_slab_page_st * page = &_slab.page[idx];
+    _gt_slab_class_st * cls = &_slab.cls[page->cls];
+    uint8_t * base = _slab.base + idx * GT_MEM_SLAB_PAGE_SIZE;
+
+    *(uint16_t * )ptr = page->free_head;
+    page->free_head = (uint16_t)((uint8_t * )ptr - base);
+    if (page->used-- == cls->per_page) {
+        _slab_list_push(&cls->partial, idx);
+    }
+    --cls->used;
+    if (page->used) {
+        return;
+    }
+    /** The empty page is returned, so that it can be reused by other classes */
+    _slab_list_unlink(&cls->partial, idx);
+    --cls->pages;
+    page->cls = _SLAB_NIL;
+    _slab_list_push(&_slab.free_page, idx);
+    ++_slab.cnt_free_page;
+}
+#endif
+
+/**
+ * @brief The small block is allocated from slab first
+ */
+static GT_ATTRIBUTE_RAM_TEXT inline void * _gt_alloc(size_t size) {
+#if GT_USE_MEM_SLAB
+    void * ptr = _slab_alloc(size);
+    if (ptr) {
+        return ptr;
+    }
+#endif
+    return _gt_malloc_hooks(size);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline void * _gt_realloc(void * ptr, size_t size) {
+#if GT_USE_MEM_SLAB
+    void * ret = NULL;
+    uint16_t old_size = 0;
+
+    if (NULL == ptr) {
+        return _gt_alloc(size);
+    }
+    if (_slab_is_owner(ptr)) {
+        if (0 == size) {
+            _slab_free(ptr);
+            return NULL;
+        }
+        old_size = _slab_block_size(ptr);
+        if (size <= old_size) {
+            return ptr;
+        }
+        ret = _gt_alloc(size);
+        if (NULL == ret) {
+            return NULL;
+        }
+        gt_memcpy(ret, ptr, old_size);
+        _slab_free(ptr);
+        return ret;
+    }
+#endif
+    return _gt_realloc_hooks(ptr, size);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline void _gt_free(void * ptr) {
+#if GT_USE_MEM_SLAB
+    if (_slab_is_owner(ptr)) {
+        _slab_free(ptr);
+        return;
+    }
+#endif
+    _gt_free_hooks(ptr);
+}
+
+#if USE_MEM_TRACE_DEBUG_BY_FILE || USE_MEM_MAX_REMARK || USE_MEM_BIG_UNIT_REMARK || USE_MEM_LOG_PRINT
+static GT_ATTRIBUTE_RAM_TEXT size_t _gt_block_size(void * ptr) {
+    size_t size = 0;
+
+#if GT_USE_MEM_SLAB
+    if (_slab_is_owner(ptr)) {
+        return _slab_block_size(ptr);
+    }
+#endif
+#if GT_MEM_CUSTOM
+    size = gt_tlsf_block_size(ptr);
+#else
+    if (_self.block_size_hooks) {
+        size = _self.block_size_hooks(ptr);
+    }
+#endif
+
+    return size;
+}
+#endif
+
 /* global functions / API interface -------------------------------------*/
 void gt_mem_init(void)
 {
@@ -246,10 +535,20 @@ void gt_mem_init(void)
 #endif
 
 #endif
+
+#if GT_USE_MEM_SLAB
+    _slab_init();
+#endif
 }
 
 void gt_mem_deinit(void)
 {
+#if GT_USE_MEM_SLAB
+    if (_slab.base) {
+        _gt_free_hooks(_slab.base);
+        _slab.base = NULL;
+    }
+#endif
 #if GT_MEM_CUSTOM
     gt_tlsf_destroy(_tlsf);
 #endif
@@ -257,7 +556,7 @@ void gt_mem_deinit(void)
 
 void * _mem_malloc(size_t size, char const * file_name, char const * func_name, size_t line)
 {
-    void * ret = _gt_malloc_hooks(size);
+    void * ret = _gt_alloc(size);
 
 #if USE_MEM_TRACE_DEBUG_BY_FILE || USE_MEM_MAX_REMARK || USE_MEM_BIG_UNIT_REMARK || USE_MEM_LOG_PRINT
     size_t block_size = _gt_block_size(ret);
@@ -306,7 +605,7 @@ void * _mem_realloc(void * ptr, size_t size, char const * file_name, char const
     size_t old_size = _gt_block_size(ptr);
 #endif
 
-    void * ret = _gt_realloc_hooks(ptr, size);
+    void * ret = _gt_realloc(ptr, size);
 
 #if USE_MEM_TRACE_DEBUG_BY_FILE || USE_MEM_MAX_REMARK || USE_MEM_BIG_UNIT_REMARK || USE_MEM_LOG_PRINT
     size_t block_size = _gt_block_size(ret);
@@ -407,7 +706,7 @@ void _mem_free(void * ptr, char const * file_name, char const * func_name, size_
         fp = NULL;
     }
 #endif
-    _gt_free_hooks(ptr);
+    _gt_free(ptr);
 }
 
 #ifdef _GT_PORT_SIMULATOR_ENVS
@@ -465,4 +764,37 @@ void gt_mem_check_used(void)
     GT_LOGI(GT_LOG_TAG_MEM, "used:%.2f%%",used*100);
 #endif
 }
+
+#if GT_USE_MEM_SLAB
+uint8_t gt_mem_slab_get_class_count(void)
+{
+    return _slab.cnt_cls;
+}
+
+gt_res_t gt_mem_slab_get_info(uint8_t idx, gt_mem_slab_info_st * info)
+{
+    _gt_slab_class_st * cls = NULL;
+    if (NULL == info || idx >= _slab.cnt_cls) {
+        return GT_RES_INV;
+    }
+    cls = &_slab.cls[idx];
+    info->fallback = cls->fallback;
+    info->size = cls->size;
+    info->pages = cls->pages;
+    info->total = cls->pages * cls->per_page;
+    info->used = cls->used;
+    info->peak = cls->peak;
+    return GT_RES_OK;
+}
+
+uint16_t gt_mem_slab_get_free_pages(void)
+{
+    return _slab.cnt_free_page;
+}
+
+void _gt_mem_slab_add_class(uint16_t size)
+{
+    _slab_class_insert(_SLAB_ALIGN(size));
+}
+#endif
 /* end ------------------------------------------------------------------*/
@@ -19,13 +19,26 @@ extern "C" {
 #include "../gt_conf.h"
 #include "string.h"
 #include "../others/gt_log.h"
+#include "../others/gt_types.h"
 
 /* define ---------------------------------------------------------------*/
 
 
 
 /* typedef --------------------------------------------------------------*/
-
+#if GT_USE_MEM_SLAB
+/**
+ * @brief The occupancy of a slab size class
+ */
+typedef struct gt_mem_slab_info_s {
+    uint32_t fallback;  /** The count of the allocations which fell back to heap, no free page */
+    uint16_t size;      /** The block size of the class [byte] */
+    uint16_t pages;     /** The count of the pages which owned by the class */
+    uint16_t total;     /** The count of the blocks within the owned pages */
+    uint16_t used;      /** The count of the blocks in use */
+    uint16_t peak;      /** The maximum count of the blocks in use */
+}gt_mem_slab_info_st;
+#endif
 
 
 /* macros ---------------------------------------------------------------*/
@@ -122,6 +135,39 @@ int gt_memcmp(const void * dst, const void * src, size_t size);
 
 void gt_mem_check_used(void);
 
+#if GT_USE_MEM_SLAB
+/**
+ * @brief Get the count of the slab size classes
+ *
+ * @return uint8_t
+ */
+uint8_t gt_mem_slab_get_class_count(void);
+
+/**
+ * @brief Get the occupancy of the slab size class
+ *
+ * @param idx The index of the class, sorted by block size ascending
+ * @param info [out]
+ * @return gt_res_t GT_RES_OK: success; GT_RES_INV: invalid index
+ */
+gt_res_t gt_mem_slab_get_info(uint8_t idx, gt_mem_slab_info_st * info);
+
+/**
+ * @brief Get the count of the free pages, which can be used by any class
+ *
+ * @return uint16_t
+ */
+uint16_t gt_mem_slab_get_free_pages(void);
+
+/**
+ * @brief [only kernel calling] Add a size class for the style struct of the
+ *      widget, ignored when the class exists or all the style classes are used.
+ *
+ * @param size The size of the widget style struct [byte]
+ */
+void _gt_mem_slab_add_class(uint16_t size);
+#endif
+
 
 #define gt_mem_malloc(size) _mem_malloc(size, _GT_LOG_PRINT_FILE, __func__, __LINE__)
 #define gt_mem_realloc(ptr, size) _mem_realloc(ptr, size, _GT_LOG_PRINT_FILE, __func__, __LINE__)
@@ -17,6 +17,7 @@
 #include "gt_indev.h"
 #include "gt_style.h"
 #include "../widgets/gt_conf_widgets.h"
+#include "./gt_hit_grid.h"
 
 #if GT_CFG_ENABLE_VIEW_PAGER
 #include "../widgets/gt_view_pager.h"
@@ -140,6 +141,135 @@ static GT_ATTRIBUTE_RAM_TEXT _click_obj_ret_st _gt_obj_foreach_clicked(gt_obj_st
 }
 
 
+static GT_ATTRIBUTE_RAM_TEXT gt_obj_st * _find_clicked_obj_by_walk(gt_obj_st * scr_or_top, gt_point_st * point) {
+    _click_obj_ret_st obj_temp = _gt_obj_foreach_clicked(scr_or_top, point);
+    return obj_temp.obj;
+}
+
+#if GT_USE_OBJ_HIT_GRID
+static GT_ATTRIBUTE_RAM_TEXT uint16_t _get_depth(gt_obj_st * obj) {
+    uint16_t depth = 0;
+    while (obj->parent) {
+        obj = obj->parent;
+        ++depth;
+    }
+    return depth;
+}
+
+/**
+ * @brief Compare the objects by the order of the brute-force walk,
+ *      which is from the newer layer to the first layer, and the child
+ *      before the parent.
+ *
+ * @param a
+ * @param b
+ * @return true a is visited before b, that is a is above b
+ * @return false b is above a
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _is_above(gt_obj_st * a, gt_obj_st * b) {
+    uint16_t depth_a = _get_depth(a), depth_b = _get_depth(b);
+
+    while (depth_a > depth_b) {
+        a = a->parent;
+        if (a == b) {
+            /** a is the descendant of b */
+            return true;
+        }
+        --depth_a;
+    }
+    while (depth_b > depth_a) {
+        b = b->parent;
+        if (a == b) {
+            return false;
+        }
+        --depth_b;
+    }
+    while (a->parent != b->parent) {
+        a = a->parent;
+        b = b->parent;
+    }
+    if (NULL == a->parent) {
+        /** Different screens */
+        return false;
+    }
+    for (gt_size_t idx = a->parent->cnt_child - 1; idx >= 0; --idx) {
+        if (a->parent->child[idx] == a) {
+            return true;
+        }
+        if (a->parent->child[idx] == b) {
+            return false;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Check every object on the path from obj to root is able to
+ *      be walked into by _gt_obj_foreach_clicked(). The clicked object
+ *      which enabled touch parent property is skipped with its children,
+ *      the event is passed to the objects under it.
+ *
+ * @param root Screen or layer top object
+ * @param obj The candidate object, it must be clicked directly
+ * @param point
+ * @return true The candidate is reachable
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _is_reachable(gt_obj_st * root, gt_obj_st * obj, gt_point_st * point) {
+    _check_clicked_state_em state = gt_obj_check_is_clicked(obj, point);
+
+    if (_CHECK_CLICKED_STATE_OK != state) {
+        return false;
+    }
+    while (obj != root) {
+        if (_CHECK_CLICKED_STATE_OK == state && gt_obj_get_touch_parent(obj)) {
+            return false;
+        }
+        obj = obj->parent;
+        if (NULL == obj) {
+            /** The candidate belongs to other screen */
+            return false;
+        }
+        state = gt_obj_check_is_clicked(obj, point);
+        if (_CHECK_CLICKED_STATE_FAIL == state) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Find the clicked object by the grid cell candidates, which is
+ *      the same result as _find_clicked_obj_by_walk().
+ */
+static GT_ATTRIBUTE_RAM_TEXT gt_obj_st * _find_clicked_obj_by_grid(gt_obj_st * scr_or_top, gt_point_st * point) {
+    uint16_t cnt = 0;
+    gt_obj_st ** candidates = NULL;
+    gt_obj_st * top = NULL;
+    _check_clicked_state_em state = gt_obj_check_is_clicked(scr_or_top, point);
+
+    if (_CHECK_CLICKED_STATE_FAIL == state) {
+        return NULL;
+    }
+    if (_CHECK_CLICKED_STATE_OK == state && gt_obj_get_touch_parent(scr_or_top)) {
+        return NULL;
+    }
+    candidates = _gt_hit_grid_get_candidates(point, &cnt);
+    for (uint16_t i = 0; i < cnt; i++) {
+        if (top && false == _is_above(candidates[i], top)) {
+            continue;
+        }
+        if (false == _is_reachable(scr_or_top, candidates[i], point)) {
+            continue;
+        }
+        top = candidates[i];
+    }
+    if (top) {
+        return top;
+    }
+    return _CHECK_CLICKED_STATE_OK == state ? scr_or_top : NULL;
+}
+#endif  /** GT_USE_OBJ_HIT_GRID */
+
 #if GT_USE_UD_LR_TO_CONTROL_FOCUS_EN
 /**
  * @brief
@@ -420,22 +550,47 @@ void gt_area_copy(gt_area_st * dst, gt_area_st const * const src)
 }
 
 gt_obj_st * gt_find_clicked_obj_by_point(gt_obj_st * scr_or_top, gt_point_st * point) {
-    gt_obj_st * obj_clicked = NULL;
-    _click_obj_ret_st obj_temp = {
-        .obj = NULL,
-        .state = _CHECK_CLICKED_STATE_FAIL
-    };
-
     gt_point_st _point = {
         .x = point->x + scr_or_top->area.x,
         .y = point->y + scr_or_top->area.y
     };
-    obj_temp = _gt_obj_foreach_clicked(scr_or_top, &_point);
-    if ( obj_temp.obj ) {
-        obj_clicked = obj_temp.obj;
+#if GT_USE_OBJ_HIT_GRID
+    return _find_clicked_obj_by_grid(scr_or_top, &_point);
+#else
+    return _find_clicked_obj_by_walk(scr_or_top, &_point);
+#endif
+}
+
+#if GT_USE_OBJ_HIT_GRID
+uint32_t gt_obj_check_hit_grid(gt_obj_st * scr_or_top, uint16_t step)
+{
+    uint32_t mismatch = 0;
+    gt_obj_st * by_grid = NULL, * by_walk = NULL;
+    gt_point_st point = {0};
+    GT_CHECK_BACK_VAL(scr_or_top, 0);
+
+    if (0 == step) {
+        step = 1;
+    }
+    for (gt_size_t y = 0; y < scr_or_top->area.h; y += step) {
+        for (gt_size_t x = 0; x < scr_or_top->area.w; x += step) {
+            point.x = scr_or_top->area.x + x;
+            point.y = scr_or_top->area.y + y;
+            by_grid = _find_clicked_obj_by_grid(scr_or_top, &point);
+            by_walk = _find_clicked_obj_by_walk(scr_or_top, &point);
+            if (by_grid == by_walk) {
+                continue;
+            }
+            if (0 == mismatch) {
+                GT_LOGW(GT_LOG_TAG_GUI, "hit grid mismatch at (%d, %d), grid: %p, walk: %p",
+                    point.x, point.y, by_grid, by_walk);
+            }
+            ++mismatch;
+        }
     }
-    return obj_clicked;
+    return mismatch;
 }
+#endif
 
 gt_obj_st* _gt_obj_focus_clicked(gt_obj_st * parent)
 {
@@ -54,6 +54,19 @@ void gt_area_copy(gt_area_st * dst, gt_area_st const * const src);
  */
 gt_obj_st * gt_find_clicked_obj_by_point(gt_obj_st * scr_or_top, gt_point_st * point);
 
+#if GT_USE_OBJ_HIT_GRID
+/**
+ * @brief Consistency checker of the hit grid, sample the points of the
+ *      screen or layer top area, and compare the clicked object found by
+ *      the grid with the brute-force walk of the object tree.
+ *
+ * @param scr_or_top Screen object or layer top object
+ * @param step The distance between the sample points, 0: 1 pixel
+ * @return uint32_t The count of mismatched points, 0: consistent
+ */
+uint32_t gt_obj_check_hit_grid(gt_obj_st * scr_or_top, uint16_t step);
+#endif
+
 gt_obj_st* gt_find_clicked_obj_by_focus(gt_obj_st * parent);
 void gt_obj_focus_change_display(gt_obj_change_st * chg);
 
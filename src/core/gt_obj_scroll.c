@@ -148,8 +148,17 @@ void _gt_obj_scroll_internal(gt_obj_st * obj)
         return;
     }
 
-    _gt_obj_move_child_by(obj, scroll->x - obj->process_attr.scroll_prev.x, scroll->y - obj->process_attr.scroll_prev.y);
+    gt_size_t dx = scroll->x - obj->process_attr.scroll_prev.x;
+    gt_size_t dy = scroll->y - obj->process_attr.scroll_prev.y;
+
+    _gt_obj_move_child_by(obj, dx, dy);
+#if GT_USE_DISP_COPY_AREA
+    if (false == _gt_disp_scroll_blit(obj, dx, dy)) {
+        gt_disp_invalid_area(obj);
+    }
+#else
     gt_disp_invalid_area(obj);
+#endif
     if (obj->process_attr.scroll_prev.x != scroll->x) {
         obj->process_attr.scroll_prev.x = scroll->x;
     }
@@ -15,6 +15,7 @@
 #include "../hal/gt_hal_disp.h"
 #include "../others/gt_log.h"
 #include "../others/gt_anim.h"
+#include "./gt_hit_grid.h"
 
 /* private define -------------------------------------------------------*/
 #define _get_area_prop(obj, prop)               (obj->area.prop)
@@ -113,35 +114,6 @@ static GT_ATTRIBUTE_RAM_TEXT bool _update_layer_top_widget_area(gt_obj_st * obj,
 }
 #endif
 
-static GT_ATTRIBUTE_RAM_TEXT void _opa_anim_exec_cb(void * obj, int32_t val) {
-    gt_obj_st * tar = (gt_obj_st *)obj;
-    tar->opa = (gt_opa_t)val;
-    if (false == gt_obj_get_visible(tar)) {
-        return;
-    }
-    gt_event_send(tar, GT_EVENT_TYPE_DRAW_START, NULL);
-}
-
-static GT_ATTRIBUTE_RAM_TEXT void _width_anim_exec_cb(void * obj, int32_t val) {
-    gt_obj_st * tar = (gt_obj_st * )obj;
-    gt_obj_set_size(tar, val, tar->area.h);
-}
-
-static GT_ATTRIBUTE_RAM_TEXT void _height_anim_exec_cb(void * obj, int32_t val) {
-    gt_obj_st * tar = (gt_obj_st * )obj;
-    gt_obj_set_size(tar, tar->area.w, val);
-}
-
-static GT_ATTRIBUTE_RAM_TEXT void _x_anim_exec_cb(void * obj, int32_t val) {
-    gt_obj_st * tar = (gt_obj_st * )obj;
-    gt_obj_set_pos(tar, val, tar->area.y);
-}
-
-static GT_ATTRIBUTE_RAM_TEXT void _y_anim_exec_cb(void * obj, int32_t val) {
-    gt_obj_st * tar = (gt_obj_st * )obj;
-    gt_obj_set_pos(tar, tar->area.x, val);
-}
-
 static GT_ATTRIBUTE_RAM_TEXT void _radius_anim_exec_cb(void * obj, int32_t val) {
     gt_obj_st * tar = (gt_obj_st * )obj;
     tar->radius = val;
@@ -196,12 +168,12 @@ void gt_obj_set_pos_anim(gt_obj_st * obj, gt_size_t x, gt_size_t y)
     gt_anim_set_time(&anim, GT_ANIM_PERIOD_TRANSITION_EFFECT_MS);
     if (obj->area.x != x) {
         gt_anim_set_value(&anim, obj->area.x, x);
-        gt_anim_set_exec_cb(&anim, _x_anim_exec_cb);
+        gt_anim_set_track(&anim, GT_ANIM_TRACK_X);
         gt_anim_start(&anim);
     }
     if (obj->area.y != y) {
         gt_anim_set_value(&anim, obj->area.y, y);
-        gt_anim_set_exec_cb(&anim, _y_anim_exec_cb);
+        gt_anim_set_track(&anim, GT_ANIM_TRACK_Y);
         gt_anim_start(&anim);
     }
 }
@@ -281,6 +253,9 @@ void _gt_obj_move_child_by(gt_obj_st * obj, gt_size_t diff_x, gt_size_t diff_y)
         gt_obj_st * child = obj->child[i];
         child->area.x += diff_x;
         child->area.y += diff_y;
+#if GT_USE_OBJ_HIT_GRID
+        _gt_hit_grid_update(child);
+#endif
 
         _gt_obj_move_child_by(child, diff_x, diff_y);
     }
@@ -313,12 +288,12 @@ void gt_obj_set_size_anim(gt_obj_st * obj, uint16_t w, uint16_t h)
     gt_anim_set_time(&anim, GT_ANIM_PERIOD_TRANSITION_EFFECT_MS);
     if (obj->area.w != w) {
         gt_anim_set_value(&anim, obj->area.w, w);
-        gt_anim_set_exec_cb(&anim, _width_anim_exec_cb);
+        gt_anim_set_track(&anim, GT_ANIM_TRACK_W);
         gt_anim_start(&anim);
     }
     if (obj->area.h != h) {
         gt_anim_set_value(&anim, obj->area.h, h);
-        gt_anim_set_exec_cb(&anim, _height_anim_exec_cb);
+        gt_anim_set_track(&anim, GT_ANIM_TRACK_H);
         gt_anim_start(&anim);
     }
 }
@@ -413,7 +388,7 @@ void gt_obj_set_opa_anim(gt_obj_st * obj, gt_opa_t opa)
     gt_anim_set_path_type(&anim, GT_ANIM_PATH_TYPE_EASE_IN_OUT);
     gt_anim_set_time(&anim, GT_ANIM_PERIOD_TRANSITION_EFFECT_MS);
     gt_anim_set_value(&anim, obj->opa, opa);
-    gt_anim_set_exec_cb(&anim, _opa_anim_exec_cb);
+    gt_anim_set_track(&anim, GT_ANIM_TRACK_OPA);
     gt_anim_start(&anim);
 }
 
@@ -453,6 +428,9 @@ void gt_obj_set_visible(gt_obj_st * obj, gt_visible_et is_visible)
 {
     GT_CHECK_BACK(obj);
     obj->visible = is_visible;
+#if GT_USE_OBJ_HIT_GRID
+    _gt_hit_grid_update(obj);
+#endif
     gt_disp_invalid_area(obj);
     if (obj->visible) {
         _gt_disp_reload_max_area(gt_obj_within_which_scr(obj));
@@ -553,6 +531,9 @@ void gt_obj_size_change(gt_obj_st * obj, gt_area_st * area_new)
         area.h = area_new->h;
     }
     obj->area = *area_new;
+#if GT_USE_OBJ_HIT_GRID
+    _gt_hit_grid_update(obj);
+#endif
     _gt_disp_refr_append_area(&area);
 }
 
@@ -591,6 +572,9 @@ void gt_obj_pos_change(gt_obj_st * obj, gt_area_st * area_new)
     }
 
     obj->area = *area_new;
+#if GT_USE_OBJ_HIT_GRID
+    _gt_hit_grid_update(obj);
+#endif
     _gt_disp_refr_append_area(&area);
 }
 
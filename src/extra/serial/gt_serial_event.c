@@ -82,7 +82,7 @@ typedef struct {
 
 typedef struct {
     uint32_t addr;
-    uint8_t * page_list;
+    uint8_t * page_list;    // [event_count, addr_h, addr_m, addr_l] * page_count, NULL: read by page
     uint16_t page_count;
     uint8_t id;
     uint8_t title[_SERIAL_EVENT_TITLE_BYTE_LEN];
@@ -92,8 +92,40 @@ typedef struct {
     uint8_t * src_data;     // data_len * 256
 }gt_serial_event_file_header_st;
 
+typedef struct {
+    gt_obj_st * tar;
+    union {
+        gt_color_t color;
+        gt_point_st pos;
+        gt_point_st size;
+        gt_opa_t opa;
+        uint32_t value;
+        uint8_t cache[8];
+    }data;
+    uint16_t vp;
+    uint16_t src;       /** The index of the source widget */
+    uint8_t trigger;    /** The trigger type of the packet */
+    uint8_t ev_type;    /** The event type of the packet */
+}_serial_event_data_st;
+
+/**
+ * @brief The event data of a page, which is sorted by the source widget
+ *      and trigger type, the items are shared as the events user data.
+ *      When the page table can not be allocated, each packet has its own
+ *      table of one item, which are linked by next.
+ */
+typedef struct _serial_event_table_s {
+    struct _serial_event_table_s * next;
+    _serial_event_data_st * items;
+    uint16_t page_index;
+    uint16_t count;
+    uint16_t capacity;
+    uint8_t single;     /** 1: the table of one packet, unsorted */
+}_serial_event_table_st;
+
 typedef struct {
     gt_obj_st * parent;
+    _serial_event_table_st * table;
     uint16_t event_type;
     uint8_t * data;
     uint8_t len;
@@ -104,31 +136,21 @@ typedef gt_res_t ( * _serial_init_event_cb)(gt_serial_event_packet_st * packet);
 typedef struct {
     gt_obj_st * obj_src;
     gt_obj_st * obj_target;
+    _serial_event_data_st * item;
     gt_event_type_et type;
     gt_res_t res;
 }_serial_base_st;
 
-typedef struct {
-    gt_obj_st * tar;
-    union {
-        gt_color_t color;
-        gt_point_st pos;
-        gt_point_st size;
-        gt_opa_t opa;
-        uint32_t value;
-        uint8_t cache[8];
-    }data;
-    uint16_t vp;
-}_serial_event_data_st;
-
 /* static variables -----------------------------------------------------*/
 static gt_serial_event_file_header_st _event_fh = {
     .page_count = 0,
     .inited = false,
 };
 
-/* macros ---------------------------------------------------------------*/
+static gt_serial_event_info_st _event_info = {0};
 
+/* macros ---------------------------------------------------------------*/
+#define _SE_SORT_KEY(_data)     ((gt_convert_parse_u16(&(_data)[_SE_OFFSET_SRC]) << 8) | (_data)[_SE_OFFSET_TRIGGER])
 
 
 /* class ----------------------------------------------------------------*/
@@ -140,16 +162,41 @@ static uint32_t _calc_abs_addr(uint32_t addr, uint16_t page_index) {
     return page_index * _SERIAL_EVENT_ADDR_DATA_LEN + addr + _SERIAL_EVENT_TOTAL_LEN;
 }
 
-static gt_serial_event_addr_data_st _get_event_addr_data(uint32_t offset_addr) {
+static gt_serial_event_addr_data_st _parse_event_addr_data(uint8_t const * const tmp) {
     gt_serial_event_addr_data_st ret = {0};
-    uint8_t tmp[_SERIAL_EVENT_ADDR_DATA_LEN] = {0};
-    gt_fs_read_direct_physical(offset_addr, _SERIAL_EVENT_ADDR_DATA_LEN, tmp);
-
     ret.event_count = tmp[0];
-    ret.addr = gt_convert_parse_by_len(&tmp[1], 3);
+    ret.addr = gt_convert_parse_by_len((uint8_t * )&tmp[1], 3);
     return ret;
 }
 
+static gt_serial_event_addr_data_st _get_event_addr_data(uint16_t page_index) {
+    uint8_t tmp[_SERIAL_EVENT_ADDR_DATA_LEN] = {0};
+    if (_event_fh.page_list && page_index < _event_fh.page_count) {
+        return _parse_event_addr_data(&_event_fh.page_list[page_index * _SERIAL_EVENT_ADDR_DATA_LEN]);
+    }
+    gt_fs_read_direct_physical(_calc_abs_addr(_event_fh.addr, page_index), _SERIAL_EVENT_ADDR_DATA_LEN, tmp);
+    return _parse_event_addr_data(tmp);
+}
+
+static void _read_page_list(void) {
+    uint32_t size = _event_fh.page_count * _SERIAL_EVENT_ADDR_DATA_LEN;
+    if (_event_fh.page_list) {
+        gt_mem_free(_event_fh.page_list);
+        _event_fh.page_list = NULL;
+    }
+#if GT_SERIAL_EVENT_USE_PAGE_INDEX
+    if (0 == size) {
+        return;
+    }
+    _event_fh.page_list = (uint8_t * )gt_mem_malloc(size);
+    if (NULL == _event_fh.page_list) {
+        GT_LOGW(GT_LOG_TAG_SERIAL, "alloc event page index failed, read by page");
+        return;
+    }
+    gt_fs_read_direct_physical(_calc_abs_addr(_event_fh.addr, 0), size, _event_fh.page_list);
+#endif
+}
+
 /**
  * @brief
  *
@@ -173,24 +220,63 @@ static gt_event_type_et _get_trigger_type(uint8_t val) {
         GT_EVENT_TYPE_CHANGE_CHILD_DELETE,
         GT_EVENT_TYPE_CHANGE_CHILD_DELETED,
     };
-    if (_SERIAL_EVENT_INVALID_TRIGGER == val) {
+    if (_SERIAL_EVENT_INVALID_TRIGGER == val || val >= sizeof(type)) {
         return GT_EVENT_TYPE_NONE;
     }
     return type[val];
 }
 
 /**
- * @brief get base data
+ * @brief Find the first item of the source widget and trigger type by binary search
+ *
+ * @param table
+ * @param src
+ * @param trigger
+ * @return uint16_t The index of the first item, table->count: not found
+ */
+static uint16_t _event_table_find(_serial_event_table_st * table, uint16_t src, uint8_t trigger) {
+    uint32_t key = (src << 8) | trigger, mid_key = 0;
+    uint16_t lo = 0, hi = table->count, mid = 0;
+    while (lo < hi) {
+        mid = lo + ((hi - lo) >> 1);
+        mid_key = (table->items[mid].src << 8) | table->items[mid].trigger;
+        if (mid_key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < table->count && table->items[lo].src == src && table->items[lo].trigger == trigger) {
+        return lo;
+    }
+    return table->count;
+}
+
+static bool _event_table_has_same(_serial_event_table_st * table, uint16_t src, uint8_t trigger, uint8_t ev_type) {
+    uint16_t i = _event_table_find(table, src, trigger);
+    for (; i < table->count && table->items[i].src == src && table->items[i].trigger == trigger; ++i) {
+        if (table->items[i].ev_type == ev_type) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief get base data and the free item of the page event table
  *
  * @param packet
- * @param ev_cb [default: NULL] check if the event has the same callback before add
+ * @param ev_cb The same callback of the source widget is checked, when the
+ *      page event table is not sorted
  * @return _serial_base_st
  */
 static _serial_base_st _get_base_data(gt_serial_event_packet_st * packet, gt_event_cb_t ev_cb) {
     _serial_base_st ret = {
         .res = GT_RES_OK,
     };
-    uint16_t idx = gt_convert_parse_u16(&packet->data[_SE_OFFSET_SRC]);
+    _serial_event_table_st * table = packet->table;
+    uint16_t src = gt_convert_parse_u16(&packet->data[_SE_OFFSET_SRC]);
+    uint16_t idx = src;
     if (idx < packet->parent->cnt_child) {
         ret.obj_src = packet->parent->child[idx];
     }
@@ -208,23 +294,118 @@ static _serial_base_st _get_base_data(gt_serial_event_packet_st * packet, gt_eve
         ret.res = GT_RES_INV;
         return ret;
     }
-    if (ev_cb && gt_event_has_the_same_cb(ret.obj_src, ev_cb, ret.type)) {
+    if (table->single) {
+        if (ev_cb && gt_event_has_the_same_cb(ret.obj_src, ev_cb, ret.type)) {
+            ret.res = GT_RES_FAIL;
+            return ret;
+        }
+    } else if (_event_table_has_same(table, src, packet->data[_SE_OFFSET_TRIGGER], packet->event_type)) {
+        ret.res = GT_RES_FAIL;
+        return ret;
+    }
+    if (table->count >= table->capacity) {
         ret.res = GT_RES_FAIL;
         return ret;
     }
+    ret.item = &table->items[table->count];
+    gt_memset(ret.item, 0, sizeof(_serial_event_data_st));
+    ret.item->tar = ret.obj_target;
+    ret.item->vp = gt_convert_parse_u16(&packet->data[_SE_OFFSET_VP]);
+    ret.item->src = src;
+    ret.item->trigger = packet->data[_SE_OFFSET_TRIGGER];
+    ret.item->ev_type = (uint8_t)packet->event_type;
     return ret;
 }
 
-static void _free_user_data_cb(gt_event_st * e) {
-    if (NULL == e->user_data) {
-        return;
+/**
+ * @brief Register the event callback with the item of the page event table
+ *      which is filled by the init callback.
+ */
+static gt_res_t _bind_event(gt_serial_event_packet_st * packet, _serial_base_st * base, gt_event_cb_t ev_cb) {
+    gt_obj_add_event_cb(base->obj_src, ev_cb, base->type, base->item);
+    ++packet->table->count;
+    return GT_RES_OK;
+}
+
+static uint32_t _event_table_size(uint16_t capacity) {
+    return sizeof(_serial_event_table_st) + capacity * sizeof(_serial_event_data_st);
+}
+
+static _serial_event_table_st * _event_table_create(uint16_t page_index, uint16_t capacity) {
+    uint32_t size = _event_table_size(capacity);
+    _serial_event_table_st * table = (_serial_event_table_st * )gt_mem_malloc(size);
+    if (NULL == table) {
+        return NULL;
+    }
+    table->next = NULL;
+    table->items = (_serial_event_data_st * )(table + 1);
+    table->page_index = page_index;
+    table->count = 0;
+    table->capacity = capacity;
+    table->single = 0;
+
+    ++_event_info.tables;
+    _event_info.table_bytes += size;
+    if (_event_info.table_bytes > _event_info.table_peak) {
+        _event_info.table_peak = _event_info.table_bytes;
+    }
+    return table;
+}
+
+static void _event_table_destroy(_serial_event_table_st * table) {
+    _serial_event_table_st * next = NULL;
+
+    while (table) {
+        next = table->next;
+        --_event_info.tables;
+        _event_info.table_bytes -= _event_table_size(table->capacity);
+        _event_info.entries -= table->count;
+        gt_mem_free(table);
+        table = next;
     }
-    gt_mem_free(e->user_data);
+}
+
+static void _free_event_table_cb(gt_event_st * e) {
+    _event_table_destroy((_serial_event_table_st * )e->user_data);
     e->user_data = NULL;
 }
 
-static void _free_user_data_by_deleted_event(gt_obj_st * tar, void * user_data) {
-    gt_obj_add_event_cb(tar, _free_user_data_cb, GT_EVENT_TYPE_CHANGE_DELETED, user_data);
+/**
+ * @brief Valid packets are gathered into order[] and sorted by the source widget
+ *      and trigger type, the packets of the same key keep the order of the file,
+ *      so that the callbacks are called as the same order as before.
+ *
+ * @return uint16_t The count of the valid packets
+ */
+static uint16_t _sort_page_packets(gt_obj_st * parent, uint8_t * order, uint8_t count) {
+    uint8_t * data = NULL;
+    uint16_t valid = 0, j = 0;
+    uint32_t key = 0;
+
+    for (uint16_t i = 0; i < count; ++i) {
+        data = _event_fh.src_data + i * _event_fh.data_len;
+        if (gt_convert_parse_u16(&data[_SE_OFFSET_SRC]) >= parent->cnt_child ||
+            GT_EVENT_TYPE_NONE == _get_trigger_type(data[_SE_OFFSET_TRIGGER])) {
+            continue;
+        }
+        /** Insertion sort, the packets of file are mostly ordered by widget */
+        key = _SE_SORT_KEY(data);
+        for (j = valid; j > 0 && _SE_SORT_KEY(_event_fh.src_data + order[j - 1] * _event_fh.data_len) > key; --j) {
+            order[j] = order[j - 1];
+        }
+        order[j] = (uint8_t)i;
+        ++valid;
+    }
+    return valid;
+}
+
+/**
+ * @brief The text length of the vp, which is terminated by 0x0000 or 0xFFFF
+ */
+static uint16_t _get_vp_text_len(uint16_t vp) {
+    uint16_t len = gt_serial_var_buffer_get_len_by_eof(vp, 0x0000);
+    uint16_t len_full = gt_serial_var_buffer_get_len_by_eof(vp, 0xFFFF);
+    return GT_MAX(len, len_full);
 }
 
 static gt_res_t _common_get_vp_data(gt_serial_event_packet_st * packet, gt_event_cb_t ev_cb) {
@@ -232,15 +413,7 @@ static gt_res_t _common_get_vp_data(gt_serial_event_packet_st * packet, gt_event
     if (GT_RES_OK != base.res) {
         return base.res;
     }
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
-    user_data->vp = gt_convert_parse_u16(&packet->data[_SE_OFFSET_VP]);
-    user_data->tar = base.obj_target;
-    gt_obj_add_event_cb(base.obj_src, ev_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, ev_cb);
 }
 
 /* ------------------- init callback begin ------------------- */
@@ -280,20 +453,14 @@ static gt_res_t _back_ground_color_init_cb(gt_serial_event_packet_st * packet) {
         return base.res;
     }
     uint8_t buffer[3] = {0};
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
+    _serial_event_data_st * user_data = base.item;
     gt_serial_var_buffer_get_reg(gt_convert_parse_u16(&packet->data[_SE_OFFSET_VP]), buffer, 3);
     if (0x01 == packet->data[_SE_OFFSET_DATA]) {
         user_data->data.color.full = gt_convert_parse_u16(buffer);
     } else {
         user_data->data.color = gt_color_make(buffer[0], buffer[1], buffer[2]);
     }
-    user_data->tar = base.obj_target;
-    gt_obj_add_event_cb(base.obj_src, _back_ground_color_event_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, _back_ground_color_event_cb);
 }
 
 static void _font_color_event_cb(gt_event_st * e) {
@@ -366,10 +533,7 @@ static gt_res_t _font_color_init_cb(gt_serial_event_packet_st * packet) {
         return base.res;
     }
     uint8_t buffer[3] = {0};
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
+    _serial_event_data_st * user_data = base.item;
     gt_serial_var_buffer_get_reg(gt_convert_parse_u16(&packet->data[_SE_OFFSET_VP]), buffer, 3);
     if (0x01 == packet->data[_SE_OFFSET_DATA]) {
         user_data->data.color.full = gt_convert_parse_u16(buffer);
@@ -377,10 +541,7 @@ static gt_res_t _font_color_init_cb(gt_serial_event_packet_st * packet) {
         user_data->data.color = gt_color_make(buffer[0], buffer[1], buffer[2]);
     }
 
-    user_data->tar = base.obj_target;
-    gt_obj_add_event_cb(base.obj_src, _font_color_event_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, _font_color_event_cb);
 }
 
 static void _pos_change_event_cb(gt_event_st * e) {
@@ -393,16 +554,10 @@ static gt_res_t _pos_change_init_cb(gt_serial_event_packet_st * packet) {
     if (GT_RES_OK != base.res) {
         return base.res;
     }
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
+    _serial_event_data_st * user_data = base.item;
     user_data->data.pos.x = gt_convert_parse_i16(&packet->data[_SE_OFFSET_DATA]);
     user_data->data.pos.y = gt_convert_parse_i16(&packet->data[_SE_OFFSET_DATA + 2]);
-    user_data->tar = base.obj_target;
-    gt_obj_add_event_cb(base.obj_src, _pos_change_event_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, _pos_change_event_cb);
 }
 
 static void _size_change_event_cb(gt_event_st * e) {
@@ -416,16 +571,10 @@ static gt_res_t _size_change_init_cb(gt_serial_event_packet_st * packet) {
         return base.res;
     }
     uint8_t buffer[4] = {0};
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
+    _serial_event_data_st * user_data = base.item;
     user_data->data.size.x = gt_convert_parse_u16(&packet->data[_SE_OFFSET_DATA]);
     user_data->data.size.y = gt_convert_parse_u16(&packet->data[_SE_OFFSET_DATA + 2]);
-    user_data->tar = base.obj_target;
-    gt_obj_add_event_cb(base.obj_src, _size_change_event_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, _size_change_event_cb);
 }
 
 static void _opa_change_event_cb(gt_event_st * e) {
@@ -439,23 +588,15 @@ static gt_res_t _opa_change_init_cb(gt_serial_event_packet_st * packet) {
         return base.res;
     }
     uint8_t buffer[2] = {0};
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
+    _serial_event_data_st * user_data = base.item;
     user_data->data.opa = packet->data[_SE_OFFSET_DATA];
-    user_data->tar = base.obj_target;
-    gt_obj_add_event_cb(base.obj_src, _opa_change_event_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, _opa_change_event_cb);
 }
 
 static void _text_change_event_cb(gt_event_st * e) {
     _serial_event_data_st * udata = (_serial_event_data_st * )e->user_data;
     uint16_t vp = udata->vp;
-    uint16_t len = gt_serial_var_buffer_get_len_by_eof(vp, 0x0000);
-    uint16_t len_full = gt_serial_var_buffer_get_len_by_eof(vp, 0xFFFF);
-    len = GT_MAX(len, len_full);
+    uint16_t len = _get_vp_text_len(vp);
     if (0 == len) {
         return;
     }
@@ -516,15 +657,9 @@ static gt_res_t _visible_change_init_cb(gt_serial_event_packet_st * packet) {
     if (GT_RES_OK != base.res) {
         return base.res;
     }
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
+    _serial_event_data_st * user_data = base.item;
     user_data->data.value = packet->data[_SE_OFFSET_DATA];
-    user_data->tar = base.obj_target;
-    gt_obj_add_event_cb(base.obj_src, _visible_change_event_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, _visible_change_event_cb);
 }
 
 static void _move_anim_event_cb(gt_event_st * e) {
@@ -596,9 +731,7 @@ static gt_res_t _del_chars_init_cb(gt_serial_event_packet_st * packet) {
 static void _append_chars_event_cb(gt_event_st * e) {
     _serial_event_data_st * udata = (_serial_event_data_st * )e->user_data;
     uint16_t vp = udata->vp;
-    uint16_t len = gt_serial_var_buffer_get_len_by_eof(vp, 0x0000);
-    uint16_t len_full = gt_serial_var_buffer_get_len_by_eof(vp, 0xFFFF);
-    len = GT_MAX(len, len_full);
+    uint16_t len = _get_vp_text_len(vp);
     if (0 == len) {
         return;
     }
@@ -720,17 +853,10 @@ static gt_res_t _number_input_init_cb(gt_serial_event_packet_st * packet) {
     if (GT_RES_OK != base.res) {
         return base.res;
     }
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
-    user_data->vp = gt_convert_parse_u16(&packet->data[_SE_OFFSET_VP]);
-    user_data->tar = base.obj_target;
+    _serial_event_data_st * user_data = base.item;
     /** len_integer, len_decimal, value_type */
     gt_memcpy(user_data->data.cache, &packet->data[_SE_OFFSET_DATA], 3);
-    gt_obj_add_event_cb(base.obj_src, _number_input_event_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, _number_input_event_cb);
 }
 
 static void _next_second_event_cb(gt_event_st * e) {
@@ -852,16 +978,9 @@ static gt_res_t _go_back_page_stack_init_cb(gt_serial_event_packet_st * packet)
     if (GT_RES_OK != base.res) {
         return base.res;
     }
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
-    user_data->vp = gt_convert_parse_u16(&packet->data[_SE_OFFSET_VP]);
-    user_data->tar = base.obj_target;
+    _serial_event_data_st * user_data = base.item;
     user_data->data.value = packet->data[_SE_OFFSET_DATA];
-    gt_obj_add_event_cb(base.obj_src, _go_back_page_stack_event_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, _go_back_page_stack_event_cb);
 }
 
 // static void _show_event_cb(gt_event_st * e) {
@@ -915,15 +1034,9 @@ static gt_res_t _load_page_init_cb(gt_serial_event_packet_st * packet) {
     if (GT_RES_OK != base.res) {
         return base.res;
     }
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
-    user_data->vp = gt_convert_parse_u16(&packet->data[_SE_OFFSET_VP]);
+    _serial_event_data_st * user_data = base.item;
     gt_memcpy(user_data->data.cache, &packet->data[_SE_OFFSET_DATA], 4);
-    gt_obj_add_event_cb(base.obj_src, _load_page_event_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, _load_page_event_cb);
 }
 
 static void _load_wav_id_event_cb(gt_event_st * e) {
@@ -937,16 +1050,9 @@ static gt_res_t _load_wav_id_init_cb(gt_serial_event_packet_st * packet) {
     if (GT_RES_OK != base.res) {
         return base.res;
     }
-    _serial_event_data_st * user_data = gt_mem_malloc(sizeof(_serial_event_data_st));
-    if (NULL == user_data) {
-        return GT_RES_INV;
-    }
-    user_data->vp = gt_convert_parse_u16(&packet->data[_SE_OFFSET_VP]);
-    user_data->tar = base.obj_target;
+    _serial_event_data_st * user_data = base.item;
     user_data->data.value = gt_convert_parse_u16(&packet->data[_SE_OFFSET_DATA]);
-    gt_obj_add_event_cb(base.obj_src, _load_wav_id_event_cb, base.type, user_data);
-    _free_user_data_by_deleted_event(base.obj_src, user_data);
-    return GT_RES_OK;
+    return _bind_event(packet, &base, _load_wav_id_event_cb);
 }
 
 static GT_ATTRIBUTE_LARGE_RAM_ARRAY const _serial_init_event_cb _serial_event_init_list_cb[] = {
@@ -988,7 +1094,7 @@ static GT_ATTRIBUTE_LARGE_RAM_ARRAY const _serial_init_event_cb _serial_event_in
 
 /* ------------------- init callback end ------------------- */
 
-static gt_res_t _serial_add_event(gt_obj_st * parent, uint8_t * data, uint8_t len) {
+static gt_res_t _serial_add_event(gt_obj_st * parent, _serial_event_table_st * table, uint8_t * data, uint8_t len) {
     uint8_t event_type = data[_SE_OFFSET_EV_TYPE];
     if (_SERIAL_EVENT_INVALID_TYPE == event_type) {
         GT_LOG_A(GT_LOG_TAG_SERIAL, "invalid event type");
@@ -1004,6 +1110,7 @@ static gt_res_t _serial_add_event(gt_obj_st * parent, uint8_t * data, uint8_t le
 #endif
     gt_serial_event_packet_st packet = {
         .parent = parent,
+        .table = table,
         .event_type = event_type,
         .data = data,
         .len = len,
@@ -1011,6 +1118,40 @@ static gt_res_t _serial_add_event(gt_obj_st * parent, uint8_t * data, uint8_t le
     return _serial_event_init_list_cb[event_type](&packet);
 }
 
+/**
+ * @brief The page event table can not be allocated, the packets are added
+ *      one by one in the order of file, each one with its own table item.
+ *
+ * @return _serial_event_table_st* The list of the tables, NULL: none
+ */
+static _serial_event_table_st * _add_page_packets_unsorted(gt_obj_st * parent, uint16_t page_index, uint8_t count) {
+    _serial_event_table_st * head = NULL, * table = NULL;
+    uint8_t * data = NULL;
+
+    for (uint16_t i = 0; i < count; ++i) {
+        data = _event_fh.src_data + i * _event_fh.data_len;
+        if (gt_convert_parse_u16(&data[_SE_OFFSET_SRC]) >= parent->cnt_child ||
+            GT_EVENT_TYPE_NONE == _get_trigger_type(data[_SE_OFFSET_TRIGGER])) {
+            continue;
+        }
+        table = _event_table_create(page_index, 1);
+        if (NULL == table) {
+            GT_LOGE(GT_LOG_TAG_SERIAL, "alloc event failed, index: %d", i);
+            break;
+        }
+        table->single = 1;
+        _serial_add_event(parent, table, data, _event_fh.data_len);
+        if (0 == table->count) {
+            _event_table_destroy(table);
+            continue;
+        }
+        _event_info.entries += table->count;
+        table->next = head;
+        head = table;
+    }
+    return head;
+}
+
 
 /* global functions / API interface -------------------------------------*/
 void gt_serial_event_init(void)
@@ -1057,6 +1198,12 @@ void gt_serial_event_init(void)
         GT_LOGE(GT_LOG_TAG_SERIAL, "alloc event page data buffer err");
         return;
     }
+    /** All of the page event address are read once */
+    _read_page_list();
+    _event_info.index_bytes = _event_fh.data_len * _SERIAL_EVENT_MAX_EVENT_COUNT;
+    if (_event_fh.page_list) {
+        _event_info.index_bytes += _event_fh.page_count * _SERIAL_EVENT_ADDR_DATA_LEN;
+    }
 #if GT_BOOTING_INFO_MSG
     GT_LOG_A(GT_LOG_TAG_SERIAL, "Event id: %d, data len: %d total: %d", _event_fh.id, _event_fh.data_len, _SERIAL_EVENT_TOTAL_LEN);
 #endif
@@ -1068,27 +1215,54 @@ gt_res_t gt_serial_event_init_by_page(uint16_t page_index, gt_obj_st * parent)
     if (false == _event_fh.inited) {
         return GT_RES_FAIL;
     }
-    uint32_t address = _calc_abs_addr(_event_fh.addr, page_index);
-#if _GT_SERIAL_EVENT_LOG
-    GT_LOGD(GT_LOG_TAG_SERIAL, "_event_fh.addr: 0x%x, addr: 0x%x",  _event_fh.addr, address);
-#endif
-    gt_serial_event_addr_data_st addr_data = _get_event_addr_data(address);
-    address = addr_data.addr + _event_fh.addr;
+    uint8_t order[_SERIAL_EVENT_MAX_EVENT_COUNT];
+    _serial_event_table_st * table = NULL;
+    gt_serial_event_addr_data_st addr_data = _get_event_addr_data(page_index);
+    uint32_t address = addr_data.addr + _event_fh.addr;
+    uint16_t valid = 0;
+
+    if (0 == addr_data.event_count) {
+        return GT_RES_OK;
+    }
     // max event count: 0xff, 16 * 256 = 4096
     gt_fs_read_direct_physical(address, _event_fh.data_len * addr_data.event_count, _event_fh.src_data);
 #if _GT_SERIAL_EVENT_LOG
     GT_LOGD(GT_LOG_TAG_SERIAL, "page: %d, event count: %d, address: 0x%x", page_index, addr_data.event_count, address);
 #endif
+    valid = _sort_page_packets(parent, order, addr_data.event_count);
+    if (0 == valid) {
+        return GT_RES_OK;
+    }
+    table = _event_table_create(page_index, valid);
+    if (NULL == table) {
+        GT_LOGW(GT_LOG_TAG_SERIAL, "alloc page event table failed, count: %d, add one by one", valid);
+        table = _add_page_packets_unsorted(parent, page_index, addr_data.event_count);
+        if (table) {
+            gt_obj_add_event_cb(parent, _free_event_table_cb, GT_EVENT_TYPE_CHANGE_DELETED, table);
+        }
+        return GT_RES_OK;
+    }
 
-    for (uint16_t i = 0, offset = 0; i < addr_data.event_count; ++i) {
-        if (GT_RES_FAIL == _serial_add_event(parent, _event_fh.src_data + offset, _event_fh.data_len)) {
-            GT_LOGE(GT_LOG_TAG_SERIAL, "add event failed, index: %d", i);
+    for (uint16_t i = 0; i < valid; ++i) {
+        if (GT_RES_FAIL == _serial_add_event(parent, table, _event_fh.src_data + order[i] * _event_fh.data_len, _event_fh.data_len)) {
+            GT_LOGE(GT_LOG_TAG_SERIAL, "add event failed, index: %d", order[i]);
         }
-        offset += _event_fh.data_len;
     }
+    _event_info.entries += table->count;
+    /** The table is released with the parent, after all of the widgets are released */
+    gt_obj_add_event_cb(parent, _free_event_table_cb, GT_EVENT_TYPE_CHANGE_DELETED, table);
 
     return GT_RES_OK;
 }
 
+void gt_serial_event_get_info(gt_serial_event_info_st * info)
+{
+    if (NULL == info) {
+        return;
+    }
+    *info = _event_info;
+    info->attr_bytes = _event_info.entries * sizeof(gt_obj_event_attr_st);
+}
+
 /* end ------------------------------------------------------------------*/
 #endif  /** GT_USE_SERIAL && GT_USE_BIN_CONVERT */
@@ -23,10 +23,25 @@ extern "C" {
 
 
 /* define ---------------------------------------------------------------*/
-
+#ifndef GT_SERIAL_EVENT_USE_PAGE_INDEX
+    /* Read the event address of all pages into RAM once at init time,
+       0: read the event address of the page from flash when page is loaded */
+    #define GT_SERIAL_EVENT_USE_PAGE_INDEX  (1)
+#endif
 
 
 /* typedef --------------------------------------------------------------*/
+/**
+ * @brief The memory usage of the serial event bindings
+ */
+typedef struct gt_serial_event_info_s {
+    uint32_t table_bytes;   /** The memory of the page event tables in use */
+    uint32_t table_peak;    /** The peak memory of the page event tables */
+    uint32_t attr_bytes;    /** The memory of the event callbacks registered to the widgets */
+    uint32_t index_bytes;   /** The memory of the page index and the packet buffer */
+    uint16_t tables;        /** The number of the page event tables in use */
+    uint16_t entries;       /** The number of the event bindings in use */
+}gt_serial_event_info_st;
 
 
 
@@ -52,7 +67,8 @@ void gt_serial_event_init(void);
 
 /**
  * @brief Dynamically adds a callback function event template to a
- *      control. When releasing a control, the global variable is released
+ *      control. The event data of the page is kept in one table which is
+ *      shared by all of the controls, and it is released with the parent.
  *
  * @param page_index
  * @param parent
@@ -60,6 +76,13 @@ void gt_serial_event_init(void);
  */
 gt_res_t gt_serial_event_init_by_page(uint16_t page_index, gt_obj_st * parent);
 
+/**
+ * @brief Get the memory usage of the serial event bindings
+ *
+ * @param info [out]
+ */
+void gt_serial_event_get_info(gt_serial_event_info_st * info);
+
 #endif  /** GT_USE_SERIAL && GT_USE_BIN_CONVERT */
 
 #ifdef __cplusplus
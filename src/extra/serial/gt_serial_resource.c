@@ -24,16 +24,19 @@
 
 
 /* private typedef ------------------------------------------------------*/
+/**
+ * @brief The compact item of the resource directory, sorted by id.
+ *      The checksum of the file is not kept in RAM.
+ */
 typedef struct {
     uint32_t addr;
     uint32_t byte_len;
     uint8_t id;
-    uint8_t checksum[16];
 }_serial_bin_item_st;
 
 typedef struct {
     uint8_t file_count;
-    _serial_bin_item_st * items_list;   /** NULL:  */
+    _serial_bin_item_st * items_list;   /** NULL: not loaded, sorted by id */
 }_serial_resource_st;
 
 
@@ -44,6 +47,15 @@ static _serial_resource_st _serial_res = {
     .items_list = NULL,
 };
 
+/**
+ * @brief The fixed layout of the resource file record
+ */
+static const gt_bin_field_st _serial_res_fields[] = {
+    { 0, offsetof(_serial_bin_item_st, id),       1, sizeof(uint8_t) },
+    { 1, offsetof(_serial_bin_item_st, addr),     4, sizeof(uint32_t) },
+    { 5, offsetof(_serial_bin_item_st, byte_len), 4, sizeof(uint32_t) },
+};
+
 
 /* macros ---------------------------------------------------------------*/
 
@@ -65,20 +77,54 @@ static gt_res_t _get_resource_data_by(uint32_t addr, uint8_t file_count, _serial
     }
     gt_fs_read_direct_physical(addr, length, buffer);
 
-    uint8_t * ptr = buffer;
-    for (uint16_t k = 0; k < file_count; ++k) {
-        res_list_p[k].id = ptr[0];
-        res_list_p[k].addr = gt_convert_parse_u32(ptr + 1);
-        res_list_p[k].byte_len = gt_convert_parse_u32(ptr + 5);
-        gt_memcpy(res_list_p[k].checksum, ptr + 9, 16);
-        ptr += GT_SERIAL_RESOURCE_FILE_LENGTH;
-    }
+    gt_bin_convert_parse_records(res_list_p, sizeof(_serial_bin_item_st),
+                                buffer, GT_SERIAL_RESOURCE_FILE_LENGTH, file_count,
+                                _serial_res_fields, sizeof(_serial_res_fields) / sizeof(_serial_res_fields[0]));
 
     gt_mem_free(buffer);
     buffer = NULL;
     return GT_RES_OK;
 }
 
+/**
+ * @brief Sort the items by id, the directory is usually ordered already,
+ *      so the insertion sort is almost linear.
+ */
+static void _sort_items_by_id(_serial_bin_item_st * list, uint8_t count) {
+    _serial_bin_item_st tmp;
+    int16_t j = 0;
+
+    for (uint16_t i = 1; i < count; ++i) {
+        if (list[i - 1].id <= list[i].id) {
+            continue;
+        }
+        tmp = list[i];
+        for (j = i - 1; j >= 0 && list[j].id > tmp.id; --j) {
+            list[j + 1] = list[j];
+        }
+        list[j + 1] = tmp;
+    }
+}
+
+static _serial_bin_item_st * _find_item_by_id(uint8_t file_id) {
+    uint16_t low = 0, high = _serial_res.file_count, mid = 0;
+
+    if (NULL == _serial_res.items_list) {
+        return NULL;
+    }
+    while (low < high) {
+        mid = (low + high) >> 1;
+        if (_serial_res.items_list[mid].id < file_id) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low < _serial_res.file_count && file_id == _serial_res.items_list[low].id) {
+        return &_serial_res.items_list[low];
+    }
+    return NULL;
+}
 
 
 /* global functions / API interface -------------------------------------*/
@@ -92,30 +138,40 @@ gt_res_t gt_serial_resource_init(void)
     gt_fs_read_direct_physical(addr, 16, tmp);  /** get file count */
     addr += 16;
     _serial_res.file_count = tmp[_SERIAL_RESOURCE_FILE_COUNT_OFFSET];
+    if (0 == _serial_res.file_count) {
+        return GT_RES_FAIL;
+    }
     _serial_res.items_list = (_serial_bin_item_st *)gt_mem_malloc(_serial_res.file_count * sizeof(_serial_bin_item_st));
     if (NULL == _serial_res.items_list) {
+        _serial_res.file_count = 0;
         return GT_RES_FAIL;
     }
     if (GT_RES_OK != _get_resource_data_by(addr, _serial_res.file_count, _serial_res.items_list)) {
         gt_mem_free(_serial_res.items_list);
         _serial_res.items_list = NULL;
+        _serial_res.file_count = 0;
         return GT_RES_FAIL;
     }
+    _sort_items_by_id(_serial_res.items_list, _serial_res.file_count);
     GT_LOGV(GT_LOG_TAG_SERIAL, "resource file count: %d", _serial_res.file_count);
     return GT_RES_OK;
 }
 
 uint32_t gt_serial_resource_get_addr_by(uint8_t file_id)
 {
-    if (NULL == _serial_res.items_list) {
-        return GT_SERIAL_RESOURCE_INVALID_ADDR;
-    }
-    for (uint16_t k = 0; k < _serial_res.file_count; ++k) {
-        if (file_id == _serial_res.items_list[k].id) {
-            return _serial_res.items_list[k].addr;
-        }
-    }
-    return GT_SERIAL_RESOURCE_INVALID_ADDR;
+    _serial_bin_item_st * item = _find_item_by_id(file_id);
+    return item ? item->addr : GT_SERIAL_RESOURCE_INVALID_ADDR;
+}
+
+uint32_t gt_serial_resource_get_len_by(uint8_t file_id)
+{
+    _serial_bin_item_st * item = _find_item_by_id(file_id);
+    return item ? item->byte_len : 0;
+}
+
+uint8_t gt_serial_resource_get_count(void)
+{
+    return _serial_res.file_count;
 }
 
 
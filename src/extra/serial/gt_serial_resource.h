@@ -57,6 +57,21 @@ gt_res_t gt_serial_resource_init(void);
  */
 uint32_t gt_serial_resource_get_addr_by(uint8_t file_id);
 
+/**
+ * @brief Get the byte length of the resource by the file id
+ *
+ * @param file_id
+ * @return uint32_t 0: failed; other: success
+ */
+uint32_t gt_serial_resource_get_len_by(uint8_t file_id);
+
+/**
+ * @brief Get the count of the resource files which are loaded
+ *
+ * @return uint8_t
+ */
+uint8_t gt_serial_resource_get_count(void);
+
 
 #endif  /** GT_USE_SERIAL */
 
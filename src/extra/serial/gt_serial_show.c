@@ -29,6 +29,11 @@
 #define _GT_SERIAL_FILE_14                  (2)
 #define _GT_SERIAL_FILE_FONT                (4)
 #define _GT_SERIAL_FILE_ZK_AND_IMG_OFFSET   (1024)
+
+// sp init image, offset in show file head reserve[0 ~ 3], 0 or 0xFFFFFFFF: none
+#define _GT_SERIAL_SP_IMAGE_MAGIC           (0x47545350)  // GTSP
+#define _GT_SERIAL_SP_IMAGE_HEAD_SIZE       (6)     // magic[4] + segment count[2]
+#define _GT_SERIAL_SP_IMAGE_SEG_HEAD_SIZE   (4)     // reg[2] + byte len[2]
 /* private typedef ------------------------------------------------------*/
 
 typedef struct {
@@ -54,12 +59,39 @@ typedef struct {
     uint8_t reserve[6];
 }gt_serial_show_file_head_st;
 
+/**
+ * @brief The count of the controls and the address of the control table
+ */
+typedef struct {
+    uint8_t numb;
+    uint32_t addr;
+}gt_serial_page_loc_st;
+
 typedef struct {
     uint8_t numb;
     uint32_t addr;
     uint8_t control[GT_SERIAL_UI_PAGE_CONTROL_SIZE * GT_SERIAL_UI_PAGE_CONTROL_MAX_NUMB];
 }gt_serial_page_info_st;
 
+#if GT_SERIAL_UI_PAGE_CACHE_COUNT
+/**
+ * @brief The control table of the page which is read from flash
+ */
+typedef struct {
+    uint8_t* control;       /** numb * GT_SERIAL_UI_PAGE_CONTROL_SIZE bytes */
+    uint32_t addr;
+    uint32_t last_used;     /** lru clock */
+    gt_scr_id_t index;      /** -1: unused */
+    uint8_t numb;
+}gt_serial_page_cache_item_st;
+
+typedef struct {
+    gt_serial_page_cache_item_st items[GT_SERIAL_UI_PAGE_CACHE_COUNT];
+    gt_serial_page_cache_info_st info;
+    uint32_t clock;
+}gt_serial_page_cache_st;
+#endif
+
 typedef struct
 {
     gt_scr_list_st* page_list;
@@ -71,6 +103,18 @@ typedef struct
     //
     volatile gt_scr_id_t page_index;
     bool lock;
+    uint8_t * sp_seeded;    /** lazy mode, bitmap of the pages which sp param is seeded */
+    gt_serial_show_timing_st timing;
+#if GT_SERIAL_UI_USE_PAGE_DIR
+    uint32_t * page_dir;    /** page_numb items, [31:24]: control numb, [23:0]: offset of show file */
+    uint32_t show_addr;     /** The address of the show file */
+#endif
+#if GT_SERIAL_UI_PAGE_CACHE_COUNT
+    gt_serial_page_cache_st cache;
+#endif
+#if GT_USE_SERIAL_VAR && GT_SERIAL_VAR_USE_BATCH_REFRESH
+    _gt_timer_st * refresh_timer;   /** apply the dirty registers once per frame */
+#endif
 }gt_serial_ui_st;
 
 /* static prototypes ----------------------------------------------------*/
@@ -84,7 +128,17 @@ typedef struct
 static gt_serial_ui_st _serial_ui = {
     .page_list = NULL,
     .lock = false,
+    .sp_seeded = NULL,
+#if GT_SERIAL_UI_USE_PAGE_DIR
+    .page_dir = NULL,
+#endif
+};
+
+#if GT_SERIAL_UI_USE_PAGE_DIR
+static const gt_bin_field_st _page_dir_fields[] = {
+    { 0, 0, GT_SERIAL_SHOW_FILE_PAGE_INFO_SIZ, sizeof(uint32_t) },
 };
+#endif
 
 
 /* macros ---------------------------------------------------------------*/
@@ -124,14 +178,14 @@ static GT_ATTRIBUTE_LARGE_RAM_ARRAY const gt_bin_item_st _format_show_hand[] = {
 };
 
 static gt_res_t _parse_page_info(void * user_data, uint8_t const * const buffer, uint32_t len) {
-    gt_serial_page_info_st* info = (gt_serial_page_info_st*)user_data;
+    gt_serial_page_loc_st* info = (gt_serial_page_loc_st*)user_data;
     info->numb = buffer[0];
     info->addr = ((buffer[1] << 16) | (buffer[2] << 8) | buffer[3]) + gt_serial_resource_get_addr_by(_GT_SERIAL_FILE_14);
     return GT_RES_OK;
 }
 
 static gt_res_t _print_page_info(void const * const user_data, uint8_t * const buffer, uint32_t len) {
-    gt_serial_page_info_st* info = (gt_serial_page_info_st*)user_data;
+    gt_serial_page_loc_st* info = (gt_serial_page_loc_st*)user_data;
     buffer[0] = info->numb;
     buffer[1] = (info->addr >> 16) & 0xFF;
     buffer[2] = (info->addr >> 8) & 0xFF;
@@ -345,8 +399,53 @@ static void _read_show_file_page_control(gt_serial_page_info_st* info)
     gt_fs_read_direct_physical(info->addr, info->numb * GT_SERIAL_UI_PAGE_CONTROL_SIZE, info->control);
 }
 
-static void _read_show_file_page_info(gt_serial_page_info_st* info, uint16_t index)
+#if GT_SERIAL_UI_USE_PAGE_DIR
+/**
+ * @brief Load all of the page info by one flash read, the control table
+ *      of the page is still read when the page is loaded.
+ */
+static void _read_show_file_page_dir(gt_serial_show_file_head_st* head)
 {
+    uint32_t len = head->page_numb * GT_SERIAL_SHOW_FILE_PAGE_INFO_SIZ;
+    uint8_t * tmp = NULL;
+
+    if (0 == head->page_numb) {
+        return;
+    }
+    _serial_ui.page_dir = (uint32_t * )gt_mem_malloc(head->page_numb * sizeof(uint32_t));
+    tmp = (uint8_t * )gt_mem_malloc(len);
+    if (NULL == _serial_ui.page_dir || NULL == tmp) {
+        GT_LOGW(GT_LOG_TAG_SERIAL, "malloc page dir failed, read page info from flash");
+        if (_serial_ui.page_dir) {
+            gt_mem_free(_serial_ui.page_dir);
+            _serial_ui.page_dir = NULL;
+        }
+        if (tmp) {
+            gt_mem_free(tmp);
+        }
+        return;
+    }
+    _serial_ui.show_addr = gt_serial_resource_get_addr_by(_GT_SERIAL_FILE_14);
+    gt_fs_read_direct_physical(_serial_ui.show_addr + GT_SERIAL_SHOW_FILE_HEAD_SIZE, len, tmp);
+    gt_bin_convert_parse_records(_serial_ui.page_dir, sizeof(uint32_t), tmp, GT_SERIAL_SHOW_FILE_PAGE_INFO_SIZ,
+                                head->page_numb, _page_dir_fields, sizeof(_page_dir_fields) / sizeof(_page_dir_fields[0]));
+    gt_mem_free(tmp);
+    tmp = NULL;
+}
+#endif
+
+/**
+ * @brief Get the count of the controls and the address of the control table
+ */
+static void _read_show_file_page_loc(gt_serial_page_loc_st* info, uint16_t index)
+{
+#if GT_SERIAL_UI_USE_PAGE_DIR
+    if (_serial_ui.page_dir && index < _serial_ui._show_file_head.page_numb) {
+        info->numb = _serial_ui.page_dir[index] >> 24;
+        info->addr = (_serial_ui.page_dir[index] & 0xFFFFFF) + _serial_ui.show_addr;
+        return;
+    }
+#endif
     uint8_t tmp[GT_SERIAL_SHOW_FILE_PAGE_INFO_SIZ];
     uint32_t addr = gt_serial_resource_get_addr_by(_GT_SERIAL_FILE_14) + GT_SERIAL_SHOW_FILE_HEAD_SIZE;
     gt_fs_read_direct_physical( addr + (index * GT_SERIAL_SHOW_FILE_PAGE_INFO_SIZ),\
@@ -364,18 +463,154 @@ static void _read_show_file_page_info(gt_serial_page_info_st* info, uint16_t ind
     if (info->numb) {
         GT_LOGI(GT_LOG_TAG_SERIAL , "page index = %d, numb = 0x%X, addr = 0x%X, ",index, info->numb, info->addr);
     }
+}
+
+static void _read_show_file_page_info(gt_serial_page_info_st* info, uint16_t index)
+{
+    gt_serial_page_loc_st loc = {0};
+
+    _read_show_file_page_loc(&loc, index);
+    info->numb = loc.numb;
+    info->addr = loc.addr;
     // read control
     _read_show_file_page_control(info);
 }
 
+#if GT_SERIAL_UI_PAGE_CACHE_COUNT
+static gt_serial_page_cache_item_st* _page_cache_find(gt_scr_id_t index)
+{
+    gt_serial_page_cache_item_st* item = _serial_ui.cache.items;
+    for (uint16_t i = 0; i < GT_SERIAL_UI_PAGE_CACHE_COUNT; i++, item++) {
+        if (item->index == index) {
+            return item;
+        }
+    }
+    return NULL;
+}
+
+static void _page_cache_evict(gt_serial_page_cache_item_st* item)
+{
+    gt_serial_page_cache_info_st* info = &_serial_ui.cache.info;
+    if (item->control) {
+        gt_mem_free(item->control);
+        item->control = NULL;
+    }
+    info->used -= item->numb * GT_SERIAL_UI_PAGE_CONTROL_SIZE;
+    --info->count;
+    item->index = -1;
+    item->numb = 0;
+}
+
+/**
+ * @brief Get an unused item, the least recently used pages are evicted
+ *      until the page can be stored within the memory budget.
+ */
+static gt_serial_page_cache_item_st* _page_cache_alloc(uint32_t size)
+{
+    gt_serial_page_cache_st* cache = &_serial_ui.cache;
+    gt_serial_page_cache_item_st* item = NULL, * lru = NULL, * unused = NULL;
+
+    if (size > GT_SERIAL_UI_PAGE_CACHE_BUDGET) {
+        return NULL;
+    }
+    while (1) {
+        unused = NULL;
+        lru = NULL;
+        item = cache->items;
+        for (uint16_t i = 0; i < GT_SERIAL_UI_PAGE_CACHE_COUNT; i++, item++) {
+            if (item->index < 0) {
+                unused = unused ? unused : item;
+                continue;
+            }
+            if (NULL == lru || item->last_used < lru->last_used) {
+                lru = item;
+            }
+        }
+        if (unused && cache->info.used + size <= GT_SERIAL_UI_PAGE_CACHE_BUDGET) {
+            return unused;
+        }
+        if (NULL == lru) {
+            return NULL;
+        }
+        _page_cache_evict(lru);
+        ++cache->info.evictions;
+    }
+}
+
+/**
+ * @brief Store the control table of the page into cache
+ *
+ * @param loc The count of the controls and the address of the control table
+ * @param control The control table which is just read, NULL: read from flash
+ * @param index The index of the page
+ */
+static gt_serial_page_cache_item_st* _page_cache_store(gt_serial_page_loc_st const * loc, uint8_t const * control, gt_scr_id_t index)
+{
+    uint32_t size = loc->numb * GT_SERIAL_UI_PAGE_CONTROL_SIZE;
+    gt_serial_page_cache_item_st* item = _page_cache_alloc(size);
+    if (NULL == item) {
+        return NULL;
+    }
+    if (size) {
+        item->control = (uint8_t*)gt_mem_malloc(size);
+        if (NULL == item->control) {
+            GT_LOGW(GT_LOG_TAG_SERIAL, "page cache malloc failed, size: %d", size);
+            return NULL;
+        }
+        if (control) {
+            gt_memcpy(item->control, control, size);
+        } else {
+            gt_fs_read_direct_physical(loc->addr, size, item->control);
+        }
+    }
+    item->index = index;
+    item->numb = loc->numb;
+    item->addr = loc->addr;
+    item->last_used = ++_serial_ui.cache.clock;
+    _serial_ui.cache.info.used += size;
+    ++_serial_ui.cache.info.count;
+    return item;
+}
+#endif
+
+/**
+ * @brief Get the control table of the page, from page cache if it is resident
+ */
+static void _load_show_file_page_info(gt_serial_page_info_st* info, gt_scr_id_t index)
+{
+#if GT_SERIAL_UI_PAGE_CACHE_COUNT
+    gt_serial_page_cache_item_st* item = _page_cache_find(index);
+    if (item) {
+        ++_serial_ui.cache.info.hits;
+        item->last_used = ++_serial_ui.cache.clock;
+        info->numb = item->numb;
+        info->addr = item->addr;
+        gt_memset_0(info->control, GT_SERIAL_UI_PAGE_CONTROL_SIZE * GT_SERIAL_UI_PAGE_CONTROL_MAX_NUMB);
+        if (item->numb) {
+            gt_memcpy(info->control, item->control, item->numb * GT_SERIAL_UI_PAGE_CONTROL_SIZE);
+        }
+        return;
+    }
+    ++_serial_ui.cache.info.misses;
+    _read_show_file_page_info(info, index);
+    gt_serial_page_loc_st loc = {
+        .numb = info->numb,
+        .addr = info->addr,
+    };
+    _page_cache_store(&loc, info->control, index);
+#else
+    _read_show_file_page_info(info, index);
+#endif
+}
+
 static uint8_t* _get_control(gt_serial_page_info_st* info, uint16_t index)
 {
     return (index < info->numb) ? info->control + (index * GT_SERIAL_UI_PAGE_CONTROL_SIZE) : NULL;
 }
 
-static void _read_sp_param_to_var_buffer(gt_serial_show_file_head_st* head, gt_serial_page_info_st* info)
+static void _seed_page_sp_param(gt_serial_page_info_st* info)
 {
-    uint16_t i = 0, n = 0;
+    uint16_t n = 0;
     const gt_bin_item_st _format[] = {
         {8, gt_serial_var_head_parse, (print_cb_t)NULL,},
         { 0x0, (parse_cb_t)NULL, (print_cb_t)NULL },
@@ -387,20 +622,105 @@ static void _read_sp_param_to_var_buffer(gt_serial_show_file_head_st* head, gt_s
     };
     gt_bin_res_st ret = {0};
 
-    for(i = 0; i < head->page_numb; i++){
+    for(n = 0; n < info->numb; n++){
+        bin.buffer = _get_control(info, n);
+        ret = gt_bin_convert_parse(&bin, _format);
+        if (GT_RES_OK != ret.res) {
+            continue;
+        }
+        if(var_head.sp != 0xFFFF){
+            gt_serial_var_buffer_set_reg(var_head.sp, bin.buffer + 6, var_head.len_dsc*2);
+        }
+    }
+}
+
+static void _read_sp_param_to_var_buffer(gt_serial_show_file_head_st* head, gt_serial_page_info_st* info)
+{
+    for(uint16_t i = 0; i < head->page_numb; i++){
         _read_show_file_page_info(info, i);
+        _seed_page_sp_param(info);
+    }
+}
 
-        for(n = 0; n < info->numb; n++){
-            bin.buffer = _get_control(info, n);
-            ret = gt_bin_convert_parse(&bin, _format);
-            if (GT_RES_OK != ret.res) {
-                continue;
-            }
-            if(var_head.sp != 0xFFFF){
-                gt_serial_var_buffer_set_reg(var_head.sp, bin.buffer + 6, var_head.len_dsc*2);
-            }
+/**
+ * @brief Apply the sp init image which is generated into the show file,
+ *      each segment is read into var buffer directly.
+ *      image: magic[4] + count[2] + count * (reg[2] + byte_len[2] + data[byte_len])
+ */
+static gt_res_t _read_sp_init_image(gt_serial_show_file_head_st* head)
+{
+    uint8_t tmp[_GT_SERIAL_SP_IMAGE_HEAD_SIZE] = {0};
+    uint32_t offset = gt_convert_parse_u32(head->reserve);
+    if (0 == offset || 0xFFFFFFFF == offset) {
+        return GT_RES_INV;
+    }
+    uint32_t addr = gt_serial_resource_get_addr_by(_GT_SERIAL_FILE_14) + offset;
+    gt_fs_read_direct_physical(addr, _GT_SERIAL_SP_IMAGE_HEAD_SIZE, tmp);
+    if (_GT_SERIAL_SP_IMAGE_MAGIC != gt_convert_parse_u32(tmp)) {
+        GT_LOGW(GT_LOG_TAG_SERIAL, "sp init image type err! addr: 0x%08X", addr);
+        return GT_RES_INV;
+    }
+    uint16_t count = gt_convert_parse_u16(tmp + 4);
+    uint16_t reg = 0, len = 0;
+    addr += _GT_SERIAL_SP_IMAGE_HEAD_SIZE;
+
+    for (uint16_t i = 0; i < count; i++) {
+        gt_fs_read_direct_physical(addr, _GT_SERIAL_SP_IMAGE_SEG_HEAD_SIZE, tmp);
+        reg = gt_convert_parse_u16(tmp);
+        len = gt_convert_parse_u16(tmp + 2);
+        addr += _GT_SERIAL_SP_IMAGE_SEG_HEAD_SIZE;
+        if (gt_serial_var_buffer_read_physical(reg, addr, len)) {
+            GT_LOGE(GT_LOG_TAG_SERIAL, "sp init image segment err! reg: 0x%04X, len: %d", reg, len);
+            return GT_RES_FAIL;
         }
+        addr += len;
+    }
+    GT_LOGI(GT_LOG_TAG_SERIAL, "sp init image addr: 0x%08X, segment count: %d", addr, count);
+    return GT_RES_OK;
+}
+
+static void _init_sp_param(gt_serial_show_file_head_st* head, gt_serial_page_info_st* info)
+{
+    gt_serial_show_timing_st * timing = &_serial_ui.timing;
+
+    /** The bitmap of the last initialization is released */
+    if (_serial_ui.sp_seeded) {
+        gt_mem_free(_serial_ui.sp_seeded);
+        _serial_ui.sp_seeded = NULL;
+    }
+    if (GT_RES_OK == _read_sp_init_image(head)) {
+        timing->sp_mode = GT_SERIAL_SP_INIT_IMAGE;
+        return;
+    }
+#if GT_SERIAL_UI_SP_INIT_LAZY
+    _serial_ui.sp_seeded = (uint8_t * )gt_mem_malloc((head->page_numb + 7) >> 3);
+    if (_serial_ui.sp_seeded) {
+        gt_memset_0(_serial_ui.sp_seeded, (head->page_numb + 7) >> 3);
+        timing->sp_mode = GT_SERIAL_SP_INIT_LAZY;
+        return;
+    }
+    GT_LOGW(GT_LOG_TAG_SERIAL, "malloc sp seeded bitmap failed, seed all of pages");
+#endif
+    _read_sp_param_to_var_buffer(head, info);
+    timing->sp_mode = GT_SERIAL_SP_INIT_EAGER;
+    timing->sp_pages = head->page_numb;
+}
+
+/**
+ * @brief Lazy mode, seed the sp param of the page by the control table
+ *      which has been read already.
+ */
+static void _seed_page_sp_param_lazy(gt_serial_page_info_st* info, uint16_t index)
+{
+    if (NULL == _serial_ui.sp_seeded || index >= _serial_ui._show_file_head.page_numb) {
+        return;
+    }
+    if (_serial_ui.sp_seeded[index >> 3] & (1 << (index & 0x07))) {
+        return;
     }
+    _serial_ui.sp_seeded[index >> 3] |= (1 << (index & 0x07));
+    ++_serial_ui.timing.sp_pages;
+    _seed_page_sp_param(info);
 }
 
 
@@ -429,6 +749,58 @@ static gt_res_t _addr_control_to_page(gt_serial_page_info_st* info, gt_obj_st* p
     }
     return GT_RES_OK;
 }
+#if GT_USE_SERIAL_VAR && GT_SERIAL_VAR_USE_BATCH_REFRESH
+/**
+ * @brief Apply the dirty registers to the controls of current page in a single
+ *      batch, each control is refreshed once no matter how many times it is written.
+ */
+static void _refresh_dirty_controls(void)
+{
+    gt_var_st var;
+    gt_var_head_st var_head;
+    uint8_t reg_buf[GT_VAR_REG_LEN] = {0};
+    gt_var_value_st var_value = {
+        .buffer = reg_buf,
+        .len = GT_VAR_REG_LEN,
+    };
+    int32_t sp_reg = -1;
+    bool vp_dirty = false;
+
+    if(gt_serial_var_dirty_is_empty()) {return ;}
+
+    for (uint16_t index = 0; index < _serial_ui.page_info.numb; index++) {
+        var.buffer = _get_control(&_serial_ui.page_info, index);
+        gt_serial_var_head_parse(&var_head, var.buffer, GT_SERIAL_UI_PAGE_CONTROL_SIZE);
+
+        vp_dirty = gt_serial_var_dirty_find(var_head.vp, 1) >= 0;
+        sp_reg = (0xFFFF != var_head.sp) ? gt_serial_var_dirty_find(var_head.sp, var_head.len_dsc) : -1;
+        if(!vp_dirty && sp_reg < 0) {continue;}
+
+        var.len = GT_SERIAL_UI_PAGE_CONTROL_SIZE;
+        var.id = index;
+        var.obj = gt_obj_find_by_id(var.id);
+        if(var.obj == NULL) {continue;}
+
+        if(vp_dirty) {
+            gt_convert_print_u16(reg_buf, var_head.vp);
+            gt_serial_var_set_value(&var, &var_value);
+        }
+        while (sp_reg >= 0) {
+            gt_convert_print_u16(reg_buf, (uint16_t)sp_reg);
+            gt_serial_var_set_value(&var, &var_value);
+            sp_reg = gt_serial_var_dirty_find(sp_reg + 1, var_head.sp + var_head.len_dsc - (sp_reg + 1));
+        }
+    }
+    gt_serial_var_dirty_clear();
+}
+
+static void _refresh_timer_handler_cb(struct _gt_timer_s * timer)
+{
+    _gt_timer_set_paused(timer, true);
+    _refresh_dirty_controls();
+}
+#endif
+
 #define TEST_UI 0
 #if TEST_UI
 #define TEST_IS_VP   (01)
@@ -488,7 +860,8 @@ static gt_obj_st* _gt_serial_init_screen(void)
     gt_obj_st* screen = gt_obj_create(NULL);
     GT_LOGI(GT_LOG_TAG_SERIAL , "----- serial ui init! %p", screen);
     // read page info
-    _read_show_file_page_info(&_serial_ui.page_info, _serial_ui.page_index);
+    _load_show_file_page_info(&_serial_ui.page_info, _serial_ui.page_index);
+    _seed_page_sp_param_lazy(&_serial_ui.page_info, _serial_ui.page_index);
 
     if(GT_RES_OK != _addr_control_to_page(&_serial_ui.page_info, screen)){
         gt_obj_destroy(screen);
@@ -522,31 +895,61 @@ static gt_obj_st* _gt_serial_init_screen(void)
 
 static void _gt_serial_ui_init(void)
 {
+    gt_serial_show_timing_st * timing = &_serial_ui.timing;
+    uint32_t start = gt_tick_get(), tick = start;
+
     if(_serial_ui.lock){
         GT_LOGW(GT_LOG_TAG_SERIAL , "serial ui is already init");
         return;
     }
+    gt_memset_0(timing, sizeof(gt_serial_show_timing_st));
+#if GT_SERIAL_UI_PAGE_CACHE_COUNT
+    for (uint16_t i = 0; i < GT_SERIAL_UI_PAGE_CACHE_COUNT; i++) {
+        _serial_ui.cache.items[i].index = -1;
+    }
+#endif
     // read serial resource
     _read_serial_resource(&_serial_ui);
+    timing->resource = gt_tick_elapse(tick);
+    tick = gt_tick_get();
 
     // read font config
     _read_font_config_info(_serial_ui.font_list);
+    timing->font_config = gt_tick_elapse(tick);
+    tick = gt_tick_get();
 
     // read file head
     _read_show_file_head(&_serial_ui._show_file_head);
+#if GT_SERIAL_UI_USE_PAGE_DIR
+    _read_show_file_page_dir(&_serial_ui._show_file_head);
+#endif
     // create page list
     _serial_ui.page_list = (gt_scr_list_st*)gt_mem_malloc(sizeof(gt_scr_list_st) * _serial_ui._show_file_head.page_numb);
     if(!_serial_ui.page_list){
         GT_LOGE(GT_LOG_TAG_SERIAL , "malloc page list failed");
+#if GT_SERIAL_UI_USE_PAGE_DIR
+        if (_serial_ui.page_dir) {
+            gt_mem_free(_serial_ui.page_dir);
+            _serial_ui.page_dir = NULL;
+        }
+#endif
         return;
     }
     _serial_ui.lock = true;
+#if GT_USE_SERIAL_VAR && GT_SERIAL_VAR_USE_BATCH_REFRESH
+    _serial_ui.refresh_timer = _gt_timer_create(_refresh_timer_handler_cb, GT_TASK_PERIOD_TIME_REFR, NULL);
+    _gt_timer_set_paused(_serial_ui.refresh_timer, true);
+#endif
+    timing->show_head = gt_tick_elapse(tick);
+    tick = gt_tick_get();
 
 #if GT_USE_SERIAL_VAR
     gt_serial_cfg_st * const cfg = gt_serial_cfg_get_root();
     gt_serial_var_init(cfg->system_config.param_0.load_22);
-    _read_sp_param_to_var_buffer(&_serial_ui._show_file_head, &_serial_ui.page_info);
+    _init_sp_param(&_serial_ui._show_file_head, &_serial_ui.page_info);
 #endif
+    timing->var_init = gt_tick_elapse(tick);
+    tick = gt_tick_get();
 
     for(uint16_t i = 0; i < _serial_ui._show_file_head.page_numb; i++){
         _serial_ui.page_list[i].scr_id = i;
@@ -556,9 +959,13 @@ static void _gt_serial_ui_init(void)
     gt_scr_stack_register_id_list(_serial_ui.page_list, _serial_ui._show_file_head.page_numb, GT_SERIAL_UI_PAGE_STACK_DEPTH);
     gt_scr_stack_set_home_scr_id(GT_SERIAL_UI_HOME_PAGE_INDEX, false);
     gt_serial_load_page(GT_SERIAL_UI_HOME_PAGE_INDEX);
+    timing->first_page = gt_tick_elapse(tick);
+    timing->total = gt_tick_elapse(start);
 
     GT_LOGD(GT_LOG_TAG_SERIAL , "serial ui init success, _serial_ui size: %d byte, page list size: %d byte, page count: %d",\
         sizeof(gt_serial_ui_st), sizeof(gt_scr_list_st) * _serial_ui._show_file_head.page_numb, _serial_ui._show_file_head.page_numb);
+    GT_LOGI(GT_LOG_TAG_SERIAL , "startup: resource %d ms, font config %d ms, show head %d ms, var init %d ms, first page %d ms, total %d ms, sp mode: %d, sp pages: %d",\
+        timing->resource, timing->font_config, timing->show_head, timing->var_init, timing->first_page, timing->total, timing->sp_mode, timing->sp_pages);
 }
 /* global functions / API interface -------------------------------------*/
 void gt_serial_show_init(void)
@@ -616,11 +1023,51 @@ const uint8_t* gt_serial_get_info_by_obj(gt_obj_st* obj)
     return _get_control(&_serial_ui.page_info, index);
 }
 
+gt_res_t gt_serial_page_prefetch(gt_scr_id_t index)
+{
+#if GT_SERIAL_UI_PAGE_CACHE_COUNT
+    if(!_serial_ui.lock) {return GT_RES_INV;}
+    if(index < 0 || index >= _serial_ui._show_file_head.page_numb) {return GT_RES_INV;}
+    if(_page_cache_find(index)) {return GT_RES_OK;}
+
+    /** The current page table is in use, read into the cache item directly */
+    gt_serial_page_loc_st loc = {0};
+    _read_show_file_page_loc(&loc, index);
+    return _page_cache_store(&loc, NULL, index) ? GT_RES_OK : GT_RES_INV;
+#else
+    return GT_RES_INV;
+#endif
+}
+
+void gt_serial_page_cache_clear(void)
+{
+#if GT_SERIAL_UI_PAGE_CACHE_COUNT
+    for (uint16_t i = 0; i < GT_SERIAL_UI_PAGE_CACHE_COUNT; i++) {
+        if (_serial_ui.cache.items[i].index >= 0) {
+            _page_cache_evict(&_serial_ui.cache.items[i]);
+        }
+    }
+#endif
+}
+
+void gt_serial_page_cache_get_info(gt_serial_page_cache_info_st * info)
+{
+    if(!info) {return ;}
+#if GT_SERIAL_UI_PAGE_CACHE_COUNT
+    *info = _serial_ui.cache.info;
+#else
+    gt_memset_0(info, sizeof(gt_serial_page_cache_info_st));
+#endif
+}
+
+void gt_serial_show_get_timing(gt_serial_show_timing_st * timing)
+{
+    if(!timing) {return ;}
+    *timing = _serial_ui.timing;
+}
+
 void gt_serial_set_value(uint8_t *value, uint16_t len)
 {
-    int ret = -1;
-    uint16_t index = 0;
-    gt_var_st var;
     gt_var_value_st var_value;
     var_value.buffer = value;
     var_value.len = len;
@@ -633,6 +1080,17 @@ void gt_serial_set_value(uint8_t *value, uint16_t len)
     }
     if(!_serial_ui.lock) {return ;}
 
+#if GT_USE_SERIAL_VAR && GT_SERIAL_VAR_USE_BATCH_REFRESH
+    /* The whole range is marked, the controls are refreshed by the next frame */
+    uint32_t count = (len - GT_VAR_REG_LEN + 1) >> 1;
+    gt_serial_var_dirty_mark(gt_convert_parse_u16(value), count ? count : 1);
+    if (_serial_ui.refresh_timer && _gt_timer_get_paused(_serial_ui.refresh_timer)) {
+        _gt_timer_set_paused(_serial_ui.refresh_timer, false);
+    }
+#else
+    int ret = -1;
+    uint16_t index = 0;
+    gt_var_st var;
     for (index = 0; index < _serial_ui.page_info.numb;index++) {
         var.buffer = _get_control(&_serial_ui.page_info, index);
         var.len = GT_SERIAL_UI_PAGE_CONTROL_SIZE;
@@ -649,6 +1107,18 @@ void gt_serial_set_value(uint8_t *value, uint16_t len)
         gt_serial_var_set_value(&var, &var_value);
 #endif
     }
+#endif
+}
+
+void gt_serial_refresh_value(void)
+{
+#if GT_USE_SERIAL_VAR && GT_SERIAL_VAR_USE_BATCH_REFRESH
+    if(!_serial_ui.lock) {return ;}
+    if (_serial_ui.refresh_timer) {
+        _gt_timer_set_paused(_serial_ui.refresh_timer, true);
+    }
+    _refresh_dirty_controls();
+#endif
 }
 
 uint16_t gt_serial_get_value(uint8_t * res_buffer, uint8_t * value, uint16_t len)
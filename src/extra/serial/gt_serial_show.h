@@ -56,6 +56,25 @@ extern "C" {
     #define GT_SERIAL_UI_HOME_PAGE_INDEX    (0)
 #endif
 
+#ifndef GT_SERIAL_UI_PAGE_CACHE_COUNT
+    /* The max count of the resident page control tables, 0: disabled page cache
+       [Default: 0] */
+    #define GT_SERIAL_UI_PAGE_CACHE_COUNT   (0)
+#endif
+
+#ifndef GT_SERIAL_UI_PAGE_CACHE_BUDGET
+    /* The memory budget of the page cache [byte], the least recently used
+       page is evicted when it is exceeded, such as: 4 pages with 16 controls
+       [Default: 2 * 1024] */
+    #define GT_SERIAL_UI_PAGE_CACHE_BUDGET  (2 * 1024)
+#endif
+
+#ifndef GT_SERIAL_UI_USE_PAGE_DIR
+    /* 1: load the page directory (4 bytes per page) into RAM once at startup,
+       the page info is got without reading flash; 0: read flash every time */
+    #define GT_SERIAL_UI_USE_PAGE_DIR       (1)
+#endif
+
 #ifndef GT_SERIAL_UI_PAGE_CONTROL_SIZE
     #define GT_SERIAL_UI_PAGE_CONTROL_SIZE      (32)
 #endif
@@ -82,7 +101,50 @@ extern "C" {
 #endif
 
 #define GT_SERIAL_FONT_CONFIG_INFO_SIZE      ((FONT_LAN_MAX_COUNT * 2) + 1)
+
+#ifndef GT_SERIAL_UI_SP_INIT_LAZY
+    /* When the show file has no sp init image, 1: seed the sp param of the page
+       when it is loaded the first time; 0: seed the sp param of all pages at startup.
+       [Warn] lazy mode, the host writes sp of the page which has not been loaded
+       yet will be overwritten by the default value when the page is loaded.
+       [Default: 0] */
+    #define GT_SERIAL_UI_SP_INIT_LAZY       (0)
+#endif
 /* typedef --------------------------------------------------------------*/
+/**
+ * @brief The way that sp param is initialized
+ */
+typedef enum {
+    GT_SERIAL_SP_INIT_NONE = 0,
+    GT_SERIAL_SP_INIT_IMAGE,    /** read the sp init image of the show file */
+    GT_SERIAL_SP_INIT_LAZY,     /** seed by page, when the page is loaded the first time */
+    GT_SERIAL_SP_INIT_EAGER,    /** seed all of pages at startup */
+}gt_serial_sp_init_mode_et;
+
+/**
+ * @brief Startup phase timing report [ms]
+ */
+typedef struct gt_serial_show_timing_s {
+    uint32_t resource;      /** font and image resource table */
+    uint32_t font_config;   /** font config table */
+    uint32_t show_head;     /** show file head and page list */
+    uint32_t var_init;      /** vp init file and sp param */
+    uint32_t first_page;    /** create the home page */
+    uint32_t total;
+    uint16_t sp_pages;      /** The count of the pages which sp param is seeded */
+    uint8_t sp_mode;        /** @ref gt_serial_sp_init_mode_et */
+}gt_serial_show_timing_st;
+
+/**
+ * @brief The status of the page control table cache
+ */
+typedef struct gt_serial_page_cache_info_s {
+    uint32_t hits;          /** The count of the page loaded from cache */
+    uint32_t misses;        /** The count of the page read from flash */
+    uint32_t evictions;     /** The count of the page evicted by lru */
+    uint32_t used;          /** The memory used [byte] */
+    uint16_t count;         /** The count of the resident pages */
+}gt_serial_page_cache_info_st;
 
 
 
@@ -140,13 +202,49 @@ gt_scr_id_t gt_serial_go_back(int16_t step);
 const uint8_t* gt_serial_get_info_by_obj(gt_obj_st* obj);
 
 /**
- * @brief
+ * @brief Read the control table of the page into page cache in advance,
+ *      such as: the host knows which page is likely to be loaded next.
+ *
+ * @param index page index
+ * @return gt_res_t GT_RES_OK: cached; GT_RES_INV: cache disabled or over budget;
+ */
+gt_res_t gt_serial_page_prefetch(gt_scr_id_t index);
+
+/**
+ * @brief Free all of the resident pages of the page cache
+ */
+void gt_serial_page_cache_clear(void);
+
+/**
+ * @brief get the status of the page cache
+ *
+ * @param info [out]
+ */
+void gt_serial_page_cache_get_info(gt_serial_page_cache_info_st * info);
+
+/**
+ * @brief get the startup phase timing report
+ *
+ * @param timing [out]
+ */
+void gt_serial_show_get_timing(gt_serial_show_timing_st * timing);
+
+/**
+ * @brief Write the registers, when GT_SERIAL_VAR_USE_BATCH_REFRESH is enabled,
+ *      all of the controls within the written range are refreshed on the next frame.
  *
  * @param value 0x0000(vp / sp) + (0x00 ...)data
  * @param len byte length
  */
 void gt_serial_set_value(uint8_t *value, uint16_t len);
 
+/**
+ * @brief Apply the registers which are written by gt_serial_set_value()
+ *      to the controls immediately, without waiting for the next frame.
+ *      @ref GT_SERIAL_VAR_USE_BATCH_REFRESH
+ */
+void gt_serial_refresh_value(void);
+
 uint16_t gt_serial_get_value(uint8_t * res_buffer, uint8_t * value, uint16_t len);
 
 /**
@@ -23,6 +23,8 @@
 #include "../../widgets/gt_img.h"
 #include "../../core/gt_disp.h"
 #include "../../core/gt_style.h"
+#include "../../core/gt_fs.h"
+#include "../../others/gt_crc.h"
 
 
 /* private define -------------------------------------------------------*/
@@ -48,7 +50,24 @@ typedef struct {
     _system_read_cb_t sys_read_cb;
 }_serial_system_st;
 
+#if GT_SERIAL_SYS_USE_FLASH_STREAM
+typedef struct {
+    gt_serial_flash_stream_st info;
+    uint32_t crc;           /** The running CRC32 value, info.crc = crc ^ 0xFFFFFFFF */
+    uint32_t crc_begin;     /** The running CRC32 value before the buffered range */
+    uint32_t page_addr;     /** The flash page address of the page buffer */
+    uint16_t begin;         /** The buffered range [begin, end) of the page */
+    uint16_t end;
+    bool active;
+    uint8_t page[GT_HAL_FLASH_PAGE_SIZE];
+}_serial_flash_stream_st;
+#endif
+
 /* static variables -----------------------------------------------------*/
+#if GT_SERIAL_SYS_USE_FLASH_STREAM
+static _serial_flash_stream_st _flash_stream = {0};
+#endif
+
 static gt_res_t _write_buffer_direct(_serial_sys_pack_st * const pack_p) {
     gt_var_value_st var_value = {
         .buffer = pack_p->unpack.buffer,
@@ -105,6 +124,65 @@ static gt_res_t _write_update_cmd(_serial_sys_pack_st * const pack_p) {
  * @return gt_res_t
  */
 static gt_res_t _write_nor_flash(_serial_sys_pack_st * const pack_p) {
+#if GT_SERIAL_SYS_USE_FLASH_STREAM
+    uint8_t * buffer = pack_p->unpack.buffer;
+    uint8_t const * vp_data = NULL;
+    uint8_t type = 0, status[8] = {0};
+    uint32_t addr = 0, len = 0;
+    uint16_t vp = 0, count = 0;
+    gt_res_t ret = GT_RES_FAIL;
+
+    if (pack_p->unpack.len < 8) {
+        return GT_RES_FAIL;
+    }
+    type = buffer[0];
+    addr = gt_convert_parse_by_len(&buffer[1], 3);
+    vp = gt_convert_parse_u16(&buffer[4]);
+    count = gt_convert_parse_u16(&buffer[6]);
+
+    switch (type) {
+        case GT_SERIAL_SYS_FLASH_READ: {
+            /** The buffered data must be programmed before read back */
+            if ((uint32_t)vp + count > 0xFFFF || GT_RES_OK != gt_serial_flash_flush()) {
+                break;
+            }
+            if (0 == gt_serial_var_buffer_read_physical(vp, addr, (uint32_t)count << 1)) {
+#if GT_USE_SERIAL_VAR && GT_SERIAL_VAR_USE_BATCH_REFRESH
+                gt_serial_var_dirty_mark(vp, count);
+#endif
+                ret = GT_RES_OK;
+            }
+            break;
+        }
+        case GT_SERIAL_SYS_FLASH_WRITE: {
+            len = gt_serial_var_buffer_get_pointer(vp, &vp_data, count);
+            if (count && len == count) {
+                ret = gt_serial_flash_write(addr, vp_data, (uint32_t)count << 1);
+            }
+            break;
+        }
+        case GT_SERIAL_SYS_FLASH_ERASE: {
+            ret = gt_serial_flash_erase(addr, (uint32_t)(count ? count : 1) * GT_HAL_FLASH_SECTOR_SIZE);
+            break;
+        }
+        case GT_SERIAL_SYS_FLASH_VERIFY: {
+            if (gt_serial_var_buffer_get_pointer(vp, &vp_data, 4) < 4) {
+                break;
+            }
+            ret = gt_serial_flash_verify(addr, gt_convert_parse_u32(vp_data), gt_convert_parse_u32(vp_data + 4));
+            break;
+        }
+        default:
+            return GT_RES_FAIL;
+    }
+
+    /** Report the result and the progress to the host by the same registers */
+    status[0] = GT_RES_OK == ret ? GT_SERIAL_SYS_FLASH_DONE : GT_SERIAL_SYS_FLASH_ERROR;
+    gt_convert_print_by_len(&status[1], _flash_stream.info.offset, 3);
+    gt_convert_print_u32(&status[4], GT_SERIAL_SYS_FLASH_VERIFY == type ? _flash_stream.info.verify_crc : _flash_stream.info.crc);
+    gt_serial_var_buffer_set_reg(GT_SERIAL_SYS_ADDR_NOR_FLASH, status, sizeof(status));
+    return ret;
+#else
     uint8_t type = pack_p->unpack.buffer[0];
     uint32_t addr = gt_convert_parse_by_len(&pack_p->unpack.buffer[1], 3);
     if (0x5a == type) {
@@ -118,6 +196,11 @@ static gt_res_t _write_nor_flash(_serial_sys_pack_st * const pack_p) {
     /** write */
 
     return GT_RES_OK;
+#endif
+}
+
+static uint16_t _read_nor_flash(_serial_sys_pack_st * const pack_p) {
+    return _read_buffer_direct(pack_p);
 }
 
 // gt_res_t _write_uart2(_serial_sys_pack_st * const pack_p) {
@@ -614,7 +697,7 @@ static GT_ATTRIBUTE_LARGE_RAM_ARRAY const _serial_system_st _system_list[] = {
     // { 0x00, 4, (_system_write_cb_t)NULL, (_system_read_cb_t)NULL },
     { GT_SERIAL_SYS_ADDR_RESET, 2, _write_system_reset, (_system_read_cb_t)NULL },
     { GT_SERIAL_SYS_ADDR_UPDATE_CMD, 2, _write_update_cmd, (_system_read_cb_t)NULL },
-    { GT_SERIAL_SYS_ADDR_NOR_FLASH, 4, _write_nor_flash, (_system_read_cb_t)NULL },
+    { GT_SERIAL_SYS_ADDR_NOR_FLASH, 4, _write_nor_flash, _read_nor_flash },
     // { 0x0c, 2, _write_uart2, (_system_read_cb_t)NULL },
     { GT_SERIAL_SYS_ADDR_VER, 2, (_system_write_cb_t)NULL, _read_ver },
     { GT_SERIAL_SYS_ADDR_RTC, 4, _write_rtc, _read_rtc },
@@ -686,7 +769,20 @@ static GT_ATTRIBUTE_LARGE_RAM_ARRAY const _serial_system_st _system_list[] = {
 
 
 /* static functions -----------------------------------------------------*/
-
+#if GT_SERIAL_SYS_USE_FLASH_STREAM
+static void _flash_stream_restart(uint32_t addr) {
+    _serial_flash_stream_st * s = &_flash_stream;
+    s->info.start = addr;
+    s->info.offset = addr;
+    s->info.programmed = 0;
+    s->info.pages = 0;
+    s->crc = GT_CRC_START_32;
+    s->crc_begin = s->crc;
+    s->info.crc = s->crc ^ 0xFFFFFFFFul;
+    s->begin = s->end = 0;
+    s->active = true;
+}
+#endif
 
 
 /* global functions / API interface -------------------------------------*/
@@ -757,6 +853,135 @@ uint16_t gt_serial_system_get_value_by_addr(uint8_t * const res, uint16_t addr,
     return gt_serial_system_get_value(res, tmp, cnt);
 }
 
+#if GT_SERIAL_SYS_USE_FLASH_STREAM
+gt_res_t gt_serial_flash_erase(uint32_t addr, uint32_t len)
+{
+    if (GT_RES_OK != gt_serial_flash_flush()) {
+        return GT_RES_FAIL;
+    }
+    if (GT_FS_RES_OK != gt_fs_erase_direct_physical(addr, len)) {
+        GT_LOGE(GT_LOG_TAG_SERIAL, "erase flash failed, addr: 0x%x len: %d", addr, len);
+        return GT_RES_FAIL;
+    }
+    /** The accepted data is erased, the same address is written as a new stream */
+    _flash_stream.active = false;
+    return GT_RES_OK;
+}
+
+gt_res_t gt_serial_flash_write(uint32_t addr, uint8_t const * data, uint32_t len)
+{
+    _serial_flash_stream_st * s = &_flash_stream;
+    uint32_t skip = 0, part = 0, page_addr = 0;
+
+    if (NULL == data) {
+        return GT_RES_FAIL;
+    }
+    /** The data is resent after the link is broken, skip the accepted data */
+    if (s->active && addr >= s->info.start && addr < s->info.offset) {
+        skip = s->info.offset - addr;
+        if (skip >= len) {
+            return GT_RES_OK;
+        }
+        addr += skip;
+        data += skip;
+        len -= skip;
+    }
+    if (false == s->active || addr != s->info.offset) {
+        if (GT_RES_OK != gt_serial_flash_flush()) {
+            return GT_RES_FAIL;
+        }
+        _flash_stream_restart(addr);
+    }
+
+    while (len) {
+        page_addr = addr - (addr % GT_HAL_FLASH_PAGE_SIZE);
+        if (s->end > s->begin && page_addr != s->page_addr) {
+            if (GT_RES_OK != gt_serial_flash_flush()) {
+                return GT_RES_FAIL;
+            }
+        }
+        if (s->end == s->begin) {
+            s->page_addr = page_addr;
+            s->begin = s->end = (uint16_t)(addr - page_addr);
+        }
+        part = GT_HAL_FLASH_PAGE_SIZE - s->end;
+        if (part > len) {
+            part = len;
+        }
+        gt_memcpy(&s->page[s->end], data, part);
+        s->crc = gt_crc32_update_buf(s->crc, data, part);
+        s->end += part;
+        addr += part;
+        data += part;
+        len -= part;
+        s->info.offset = addr;
+        s->info.crc = s->crc ^ 0xFFFFFFFFul;
+
+        if (GT_HAL_FLASH_PAGE_SIZE == s->end && GT_RES_OK != gt_serial_flash_flush()) {
+            return GT_RES_FAIL;
+        }
+    }
+    return GT_RES_OK;
+}
+
+gt_res_t gt_serial_flash_flush(void)
+{
+    _serial_flash_stream_st * s = &_flash_stream;
+    uint32_t len = s->end - s->begin;
+    uint32_t ret = 0;
+
+    if (s->end <= s->begin) {
+        return GT_RES_OK;
+    }
+    ret = gt_fs_write_direct_physical(s->page_addr + s->begin, len, &s->page[s->begin]);
+    if (ret != len) {
+        GT_LOGE(GT_LOG_TAG_SERIAL, "program flash failed, addr: 0x%x len: %d", s->page_addr, len);
+        /** The buffered data is dropped, the host resumes from the start of it */
+        s->info.offset = s->page_addr + s->begin;
+        s->crc = s->crc_begin;
+        s->info.crc = s->crc ^ 0xFFFFFFFFul;
+        s->begin = s->end = 0;
+        return GT_RES_FAIL;
+    }
+    s->begin = s->end = 0;
+    s->crc_begin = s->crc;
+    s->info.programmed += len;
+    ++s->info.pages;
+    return GT_RES_OK;
+}
+
+gt_res_t gt_serial_flash_verify(uint32_t addr, uint32_t len, uint32_t crc)
+{
+    _serial_flash_stream_st * s = &_flash_stream;
+    uint32_t value = GT_CRC_START_32, part = 0;
+
+    if (GT_RES_OK != gt_serial_flash_flush()) {
+        return GT_RES_FAIL;
+    }
+    /** The page buffer is empty after flush, which is used to read back */
+    while (len) {
+        part = len > GT_HAL_FLASH_PAGE_SIZE ? GT_HAL_FLASH_PAGE_SIZE : len;
+        gt_fs_read_direct_physical(addr, part, s->page);
+        value = gt_crc32_update_buf(value, s->page, part);
+        addr += part;
+        len -= part;
+    }
+    s->info.verify_crc = value ^ 0xFFFFFFFFul;
+    if (s->info.verify_crc != crc) {
+        GT_LOGE(GT_LOG_TAG_SERIAL, "verify flash failed, crc: 0x%x, expected: 0x%x", s->info.verify_crc, crc);
+        return GT_RES_FAIL;
+    }
+    return GT_RES_OK;
+}
+
+void gt_serial_flash_get_stream(gt_serial_flash_stream_st * info)
+{
+    if (NULL == info) {
+        return;
+    }
+    *info = _flash_stream.info;
+}
+#endif  /** GT_SERIAL_SYS_USE_FLASH_STREAM */
 
 /* end ------------------------------------------------------------------*/
 #endif /** GT_USE_SERIAL && GT_USE_SERIAL_SYSTEM */
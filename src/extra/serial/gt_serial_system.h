@@ -61,8 +61,30 @@ extern "C" {
     #define GT_POINTER_ICON_ID              (-100)
 #endif
 
+/** The operation type of GT_SERIAL_SYS_ADDR_NOR_FLASH */
+#define GT_SERIAL_SYS_FLASH_READ            0x5A    /** 5A addr[3] vp[2] len[2]: flash -> vp, len: short */
+#define GT_SERIAL_SYS_FLASH_WRITE           0xA5    /** A5 addr[3] vp[2] len[2]: vp -> flash, len: short */
+#define GT_SERIAL_SYS_FLASH_ERASE           0xE5    /** E5 addr[3] 0000 count[2]: erase count sectors */
+#define GT_SERIAL_SYS_FLASH_VERIFY          0x55    /** 55 addr[3] vp[2] 0000: vp: len[4] crc32[4] */
+#define GT_SERIAL_SYS_FLASH_DONE            0x00    /** Finished, reg: 00 offset[3] crc32[4] */
+#define GT_SERIAL_SYS_FLASH_ERROR           0xEE    /** Failed, reg: EE offset[3] crc32[4] */
+
 
 /* typedef --------------------------------------------------------------*/
+#if GT_SERIAL_SYS_USE_FLASH_STREAM
+/**
+ * @brief The status of the nor flash stream
+ */
+typedef struct gt_serial_flash_stream_s {
+    uint32_t start;         /** The start address of the current stream */
+    uint32_t offset;        /** The next address to be written, the host can resume from it,
+                                which is rolled back when the page program failed */
+    uint32_t crc;           /** The CRC32 of the data [start, offset) */
+    uint32_t verify_crc;    /** The CRC32 read back by the last verify */
+    uint32_t programmed;    /** The number of bytes programmed into flash */
+    uint32_t pages;         /** The number of page program */
+}gt_serial_flash_stream_st;
+#endif
 
 
 
@@ -105,6 +127,55 @@ uint16_t gt_serial_system_get_value(uint8_t * const res, uint8_t const * const b
  */
 uint16_t gt_serial_system_get_value_by_addr(uint8_t * const res, uint16_t addr, uint8_t short_len);
 
+#if GT_SERIAL_SYS_USE_FLASH_STREAM
+/**
+ * @brief Erase the flash sectors which are covered by [addr, addr + len),
+ *      the buffered page is programmed before, and the stream is ended.
+ *
+ * @param addr
+ * @param len [byte]
+ * @return gt_res_t
+ */
+gt_res_t gt_serial_flash_erase(uint32_t addr, uint32_t len);
+
+/**
+ * @brief Write the data into the flash stream. The data is continued when addr is
+ *      equal to the stream offset, the data which has been accepted is skipped when
+ *      it is resent, otherwise a new stream is started at addr.
+ *      The data is programmed when the page buffer is full or flushed.
+ *
+ * @param addr
+ * @param data
+ * @param len
+ * @return gt_res_t
+ */
+gt_res_t gt_serial_flash_write(uint32_t addr, uint8_t const * data, uint32_t len);
+
+/**
+ * @brief Program the data remaining in the page buffer
+ *
+ * @return gt_res_t
+ */
+gt_res_t gt_serial_flash_flush(void);
+
+/**
+ * @brief Read back the flash [addr, addr + len) and check the CRC32
+ *
+ * @param addr
+ * @param len
+ * @param crc The expected CRC32
+ * @return gt_res_t GT_RES_OK: matched
+ */
+gt_res_t gt_serial_flash_verify(uint32_t addr, uint32_t len, uint32_t crc);
+
+/**
+ * @brief Get the status of the flash stream
+ *
+ * @param info [out]
+ */
+void gt_serial_flash_get_stream(gt_serial_flash_stream_st * info);
+#endif
+
 #endif  /** GT_USE_SERIAL */
 
 #ifdef __cplusplus
@@ -45,7 +45,25 @@
 
 #define _REFACTOR_PARSE     0
 
+/* dirty bitmap, one bit per register */
+#define _GT_SERIAL_VAR_REG_COUNT            (0x10000)
+#define _GT_SERIAL_VAR_DIRTY_WORDS          (_GT_SERIAL_VAR_REG_COUNT >> 5)
+
 /* private typedef ------------------------------------------------------*/
+#if GT_SERIAL_VAR_EOF_CACHE_COUNT
+/**
+ * @brief The terminator offset of the text which begin at reg
+ */
+typedef struct {
+    uint32_t len;       /** byte offset of the terminator, valid when found */
+    uint32_t clean;     /** there is no terminator begin within [0, clean) */
+    uint16_t reg;
+    uint16_t eof;
+    uint8_t valid : 1;
+    uint8_t found : 1;
+    uint8_t aligned : 1;    /** only the even offsets are matched */
+}_serial_var_eof_st;
+#endif
 
 
 
@@ -59,6 +77,21 @@
  */
 static GT_ATTRIBUTE_LARGE_RAM_ARRAY uint8_t _serial_var_buf[GT_SERIAL_UI_VAR_SIZE] = {0};
 
+#if GT_SERIAL_VAR_EOF_CACHE_COUNT
+static GT_ATTRIBUTE_LARGE_RAM_ARRAY _serial_var_eof_st _serial_var_eof[GT_SERIAL_VAR_EOF_CACHE_COUNT] = {0};
+static uint8_t _serial_var_eof_next = 0;
+#endif
+
+#if GT_SERIAL_VAR_USE_BATCH_REFRESH
+/**
+ * @brief The registers written since the last refresh, the words
+ *      within [begin, end) may be non-zero.
+ */
+static GT_ATTRIBUTE_LARGE_RAM_ARRAY uint32_t _serial_var_dirty[_GT_SERIAL_VAR_DIRTY_WORDS] = {0};
+static uint16_t _serial_var_dirty_begin = _GT_SERIAL_VAR_DIRTY_WORDS;
+static uint16_t _serial_var_dirty_end = 0;
+#endif
+
 static GT_ATTRIBUTE_LARGE_RAM_ARRAY const gt_var_handler_item_st _var_handler_list[] = {
     {VAR_TYPE_ICON, gt_serial_var_icon_create, gt_serial_var_icon_set_value},
     {VAR_TYPE_ANIM_ICON, gt_serial_var_anim_icon_create, gt_serial_var_anim_icon_set_value},
@@ -150,11 +183,165 @@ static gt_res_t _var_set_value(gt_var_handler_st *handler)
     return GT_RES_OK;
 }
 
+/**
+ * @brief Exact 0x80 flag at each zero byte of the word
+ */
+static inline uint32_t _zero_byte_mask(uint32_t v)
+{
+    uint32_t t = (v & 0x7F7F7F7FUL) + 0x7F7F7F7FUL;
+    return ~(t | v | 0x7F7F7F7FUL);
+}
+
+/**
+ * @brief Word-at-a-time search the first position which ptr[0] == hi and ptr[1] == lo,
+ *      ptr[1] of the last position must be readable.
+ *
+ * @return const uint8_t* NULL: not found
+ */
+static const uint8_t * _find_eof(const uint8_t * ptr, const uint8_t * end, uint8_t hi, uint8_t lo)
+{
+    uint32_t rep_hi = hi * 0x01010101UL, rep_lo = lo * 0x01010101UL;
+    uint32_t x = 0, y = 0;
+
+    while (ptr + 4 <= end) {
+        memcpy(&x, ptr, 4);
+        memcpy(&y, ptr + 1, 4);
+        if (_zero_byte_mask(x ^ rep_hi) & _zero_byte_mask(y ^ rep_lo)) {
+            break;
+        }
+        ptr += 4;
+    }
+    for (; ptr < end; ++ptr) {
+        if (hi == ptr[0] && lo == ptr[1]) {
+            return ptr;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Search the terminator within [from, limit - 1) of the text which
+ *      begin at start, the 2 bytes encoding only match the even offsets.
+ *
+ * @return uint32_t The offset of the terminator, limit: not found
+ */
+static uint32_t _scan_eof(uint32_t start, uint32_t from, uint32_t limit, uint16_t eof_value, bool aligned)
+{
+    const uint8_t * base = &_serial_var_buf[start];
+    const uint8_t * ptr = base + from + (aligned ? (from & 0x01) : 0);
+    const uint8_t * end = base + limit - 1;
+    const uint8_t * found = NULL;
+
+    while (ptr < end) {
+        found = _find_eof(ptr, end, eof_value >> 8, eof_value & 0xFF);
+        if (NULL == found) {
+            break;
+        }
+        if (!aligned || 0 == ((found - base) & 0x01)) {
+            return found - base;
+        }
+        ptr = found + 1;
+    }
+    return limit;
+}
+
+#if GT_SERIAL_VAR_EOF_CACHE_COUNT
+/**
+ * @brief The bytes which are written may move the terminator, the prefix
+ *      before the write is still known no terminator, so that an append
+ *      only rescans the new part.
+ */
+static void _eof_cache_invalidate(uint32_t begin, uint32_t len)
+{
+    _serial_var_eof_st * item = _serial_var_eof;
+    uint32_t start = 0, rel = 0;
+
+    for (uint8_t i = 0; i < GT_SERIAL_VAR_EOF_CACHE_COUNT; i++, item++) {
+        if (!item->valid) {
+            continue;
+        }
+        start = (uint32_t)item->reg << 1;
+        if (begin + len <= start) {
+            continue;
+        }
+        if (item->found && begin >= start + item->len + 2) {
+            continue;
+        }
+        rel = begin > start ? begin - start : 0;
+        rel = rel ? rel - 1 : 0;
+        if (rel < item->clean) {
+            item->clean = rel;
+        }
+        item->found = 0;
+    }
+}
+
+static void _eof_cache_clear(void)
+{
+    gt_memset_0(_serial_var_eof, sizeof(_serial_var_eof));
+}
+#endif
+
+/**
+ * @brief Get the offset of the terminator of the text which begin at reg,
+ *      only the first limit bytes are searched, the result is cached.
+ *
+ * @return uint32_t The offset of the terminator, limit: not found
+ */
+static uint32_t _get_len_by_eof(uint16_t reg, uint16_t eof_value, uint32_t limit, bool aligned)
+{
+    uint32_t start = (uint32_t)reg << 1, from = 0, offset = 0;
+
+    if(limit > GT_SERIAL_UI_VAR_SIZE - start) { limit = GT_SERIAL_UI_VAR_SIZE - start; }
+    if(limit < 2) { return limit; }
+
+#if GT_SERIAL_VAR_EOF_CACHE_COUNT
+    _serial_var_eof_st * item = NULL;
+    for (uint8_t i = 0; i < GT_SERIAL_VAR_EOF_CACHE_COUNT; i++) {
+        if (_serial_var_eof[i].valid && reg == _serial_var_eof[i].reg &&
+            eof_value == _serial_var_eof[i].eof && aligned == _serial_var_eof[i].aligned) {
+            item = &_serial_var_eof[i];
+            break;
+        }
+    }
+    if (item && item->found) {
+        return item->len + 2 <= limit ? item->len : limit;
+    }
+    if (item && item->clean + 1 >= limit) {
+        return limit;
+    }
+    if (item) {
+        from = item->clean;
+    } else {
+        item = &_serial_var_eof[_serial_var_eof_next];
+        _serial_var_eof_next = (_serial_var_eof_next + 1) % GT_SERIAL_VAR_EOF_CACHE_COUNT;
+        item->reg = reg;
+        item->eof = eof_value;
+        item->aligned = aligned;
+        item->valid = 1;
+        item->found = 0;
+        item->clean = 0;
+    }
+#endif
+
+    offset = _scan_eof(start, from, limit, eof_value, aligned);
+
+#if GT_SERIAL_VAR_EOF_CACHE_COUNT
+    item->found = offset < limit ? 1 : 0;
+    item->len = offset;
+    item->clean = offset < limit ? offset : limit - 1;
+#endif
+    return offset;
+}
+
 /* global functions / API interface -------------------------------------*/
 void gt_serial_var_init(bool load)
 {
     // memset(_serial_var_buf, 0, GT_SERIAL_UI_VAR_SIZE);
 
+#if GT_SERIAL_VAR_EOF_CACHE_COUNT
+    _eof_cache_clear();
+#endif
     if(!load) { return; }
     uint32_t addr = gt_serial_resource_get_addr_by(_GT_SERIAL_FILE_22) + (2 * _GT_SERIAL_VAR_ADDR_OFFSET);
 
@@ -181,18 +368,22 @@ int gt_serial_var_buffer_get_reg(uint16_t reg, uint8_t* data, uint16_t len)
 
 uint32_t gt_serial_var_buffer_get_len_by_eof(uint16_t reg, uint16_t eof_value)
 {
-    uint16_t end = 0xFFFF - 1;
-    uint8_t * ptr = (uint8_t * )&_serial_var_buf[reg << 1];
-    uint8_t * end_ptr = (uint8_t * )&_serial_var_buf[end << 1];
-    uint8_t check[2] = {0};
-    gt_convert_print_u16(check, eof_value);
-    while (ptr < end_ptr) {
-        if (0 == gt_memcmp(ptr, check, 2)) {
-            return ptr - (uint8_t * )&_serial_var_buf[reg << 1];
-        }
-        ++ptr;
-    }
-    return 0;
+    uint32_t start = (uint32_t)reg << 1, offset = 0;
+    uint32_t end = (uint32_t)(0xFFFF - 1) << 1;
+    if(end > GT_SERIAL_UI_VAR_SIZE - 1) { end = GT_SERIAL_UI_VAR_SIZE - 1; }
+    if(start >= end) { return 0; }
+
+    offset = _get_len_by_eof(reg, eof_value, end - start + 1, false);
+    return offset < end - start + 1 ? offset : 0;
+}
+
+uint16_t gt_serial_var_buffer_get_len_by_eof_within(uint16_t reg, uint16_t eof_value, uint16_t len, bool aligned)
+{
+    uint32_t start = (uint32_t)reg << 1;
+    if(start + 1 >= GT_SERIAL_UI_VAR_SIZE) { return 0; }
+    if(len > GT_SERIAL_UI_VAR_SIZE - start) { len = GT_SERIAL_UI_VAR_SIZE - start; }
+
+    return _get_len_by_eof(reg, eof_value, len, aligned);
 }
 
 int gt_serial_var_buffer_set_reg(uint16_t reg, uint8_t* data, uint16_t len)
@@ -200,9 +391,79 @@ int gt_serial_var_buffer_set_reg(uint16_t reg, uint8_t* data, uint16_t len)
     if(!data){return -1;}
     if(reg + len > 0xFFFF) {return -1;}
     memcpy(&_serial_var_buf[reg * 2], data, len);
+#if GT_SERIAL_VAR_EOF_CACHE_COUNT
+    _eof_cache_invalidate((uint32_t)reg << 1, len);
+#endif
     return 0;
 }
 
+int gt_serial_var_buffer_read_physical(uint16_t reg, uint32_t addr, uint32_t len)
+{
+    if(((uint32_t)reg << 1) + len > GT_SERIAL_UI_VAR_SIZE) {return -1;}
+    gt_fs_read_direct_physical(addr, len, &_serial_var_buf[reg << 1]);
+#if GT_SERIAL_VAR_EOF_CACHE_COUNT
+    _eof_cache_invalidate((uint32_t)reg << 1, len);
+#endif
+    return 0;
+}
+
+#if GT_SERIAL_VAR_USE_BATCH_REFRESH
+void gt_serial_var_dirty_mark(uint16_t reg, uint32_t count)
+{
+    uint32_t r = reg, end = reg + count, n = 0, bit = 0;
+    if(end > _GT_SERIAL_VAR_REG_COUNT) { end = _GT_SERIAL_VAR_REG_COUNT; }
+    if(r >= end) { return; }
+
+    if((r >> 5) < _serial_var_dirty_begin) { _serial_var_dirty_begin = r >> 5; }
+    if(((end - 1) >> 5) + 1 > _serial_var_dirty_end) { _serial_var_dirty_end = ((end - 1) >> 5) + 1; }
+
+    while (r < end) {
+        bit = r & 0x1F;
+        n = 32 - bit;
+        if(n > end - r) { n = end - r; }
+        _serial_var_dirty[r >> 5] |= (32 == n) ? 0xFFFFFFFF : (((1UL << n) - 1) << bit);
+        r += n;
+    }
+}
+
+int32_t gt_serial_var_dirty_find(uint16_t reg, uint32_t count)
+{
+    uint32_t r = reg, end = reg + count, word = 0;
+    if(end > _GT_SERIAL_VAR_REG_COUNT) { end = _GT_SERIAL_VAR_REG_COUNT; }
+    if(r < ((uint32_t)_serial_var_dirty_begin << 5)) { r = (uint32_t)_serial_var_dirty_begin << 5; }
+    if(end > ((uint32_t)_serial_var_dirty_end << 5)) { end = (uint32_t)_serial_var_dirty_end << 5; }
+
+    while (r < end) {
+        /** skip the clean bits of the word at once */
+        word = _serial_var_dirty[r >> 5] >> (r & 0x1F);
+        if(0 == word) {
+            r = (r | 0x1F) + 1;
+            continue;
+        }
+        while (0 == (word & 0x01)) {
+            word >>= 1;
+            ++r;
+        }
+        return r < end ? (int32_t)r : -1;
+    }
+    return -1;
+}
+
+bool gt_serial_var_dirty_is_empty(void)
+{
+    return _serial_var_dirty_begin >= _serial_var_dirty_end;
+}
+
+void gt_serial_var_dirty_clear(void)
+{
+    if(_serial_var_dirty_begin < _serial_var_dirty_end) {
+        gt_memset_0(&_serial_var_dirty[_serial_var_dirty_begin], (_serial_var_dirty_end - _serial_var_dirty_begin) << 2);
+    }
+    _serial_var_dirty_begin = _GT_SERIAL_VAR_DIRTY_WORDS;
+    _serial_var_dirty_end = 0;
+}
+#endif
+
 int gt_serial_var_buffer_get(gt_var_value_st* value, uint8_t* data, uint16_t len)
 {
     if(!value || !data || !value->buffer) {return -1;}
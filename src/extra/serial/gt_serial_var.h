@@ -32,6 +32,28 @@ extern "C" {
 //
 #if GT_USE_SERIAL_VAR && GT_USE_BIN_CONVERT
 //
+#ifndef GT_SERIAL_VAR_USE_BATCH_REFRESH
+    /**
+     * @brief The written registers are tracked by a dirty bitmap over the 64K
+     *      register space, the affected controls are refreshed once per frame
+     *      @ref GT_TASK_PERIOD_TIME_REFR, the writes within the same frame are coalesced.
+     *      RAM cost: 8K bytes.
+     *      [default: 1]
+     */
+    #define GT_SERIAL_VAR_USE_BATCH_REFRESH     1
+#endif
+
+#ifndef GT_SERIAL_VAR_EOF_CACHE_COUNT
+    /**
+     * @brief The count of the cached terminator offsets of the text variables,
+     *      @ref gt_serial_var_buffer_get_len_by_eof() and
+     *      @ref gt_serial_var_buffer_get_len_by_eof_within(), the cache is invalidated
+     *      by the range of each write. 0: disabled
+     *      [default: 8]
+     */
+    #define GT_SERIAL_VAR_EOF_CACHE_COUNT       8
+#endif
+
 #define GT_VAR_REG_LEN  2
 #define GT_VAR_IS_VP(reg, vp) ((reg) == (vp))
 #define GT_VAR_IS_SP(reg, sp, len_dsc) (((reg) >= (sp)) && ((reg) < (sp) + (len_dsc)))
@@ -146,6 +168,19 @@ int gt_serial_var_buffer_get_reg(uint16_t reg, uint8_t* data, uint16_t len);
  */
 uint32_t gt_serial_var_buffer_get_len_by_eof(uint16_t reg, uint16_t eof_value);
 
+/**
+ * @brief Get the byte length of the field, which end with eof_value or the
+ *      field length, only the bytes of the field are searched.
+ *
+ * @param reg
+ * @param eof_value
+ * @param len The byte length of the field
+ * @param aligned true: the terminator only begin at the even offsets,
+ *      used by the 2 bytes encoding such as unicode.
+ * @return uint16_t The byte length of the data
+ */
+uint16_t gt_serial_var_buffer_get_len_by_eof_within(uint16_t reg, uint16_t eof_value, uint16_t len, bool aligned);
+
 /**
  * @brief get var buffer
  *
@@ -166,6 +201,47 @@ int gt_serial_var_buffer_get(gt_var_value_st* value, uint8_t* data, uint16_t len
  */
 int gt_serial_var_buffer_set_reg(uint16_t reg, uint8_t* data, uint16_t len);
 
+/**
+ * @brief read the flash data into var buffer directly, without temp buffer
+ *
+ * @param reg   is sp or vp
+ * @param addr  physical address of the flash
+ * @param len   byte length
+ * @return int [0] : success [-1] : error
+ */
+int gt_serial_var_buffer_read_physical(uint16_t reg, uint32_t addr, uint32_t len);
+
+#if GT_SERIAL_VAR_USE_BATCH_REFRESH
+/**
+ * @brief mark the registers which are written as dirty
+ *
+ * @param reg   the first register
+ * @param count register count, out of 64K register space is ignored
+ */
+void gt_serial_var_dirty_mark(uint16_t reg, uint32_t count);
+
+/**
+ * @brief find the first dirty register within the range
+ *
+ * @param reg   the first register
+ * @param count register count
+ * @return int32_t [-1]: no dirty register; >= 0: the dirty register
+ */
+int32_t gt_serial_var_dirty_find(uint16_t reg, uint32_t count);
+
+/**
+ * @brief there is no dirty register or not
+ *
+ * @return true no dirty register
+ */
+bool gt_serial_var_dirty_is_empty(void);
+
+/**
+ * @brief clear all of the dirty registers
+ */
+void gt_serial_var_dirty_clear(void);
+#endif
+
 /**
  * @brief set var buffer
  *
@@ -137,8 +137,13 @@ static void _set_text(gt_obj_st* obj, gt_var_text_st* icon, uint16_t reg)
     const uint8_t * data = NULL;
     uint16_t len = gt_serial_var_buffer_get_pointer(reg, &data, icon->param.len);
     if(0 == len) {return;}
+    /** The text end with the double '\0' terminator or the fields length, which is cached by var buffer */
+    uint16_t eof_len = gt_serial_var_buffer_get_len_by_eof_within(reg, 0x0000, len, 5 == encode);
+    if(eof_len) {
+        len = eof_len;
+    }
 
-    switch(ver_align){
+    switch(encode){
         case 0:
             // ascii
             gt_label_set_font_encoding(obj, GT_ENCODING_UTF8);
@@ -69,10 +69,12 @@ extern "C" {
 /* user: Timer task handler timer [ms] */
 #define GT_TASK_PERIOD_TIME_INDEV   10
 #define GT_TASK_PERIOD_TIME_EVENT   10
-#define GT_TASK_PERIOD_TIME_ANIM    10
 #define GT_TASK_PERIOD_TIME_REFR    10
 #define GT_TASK_PERIOD_TIME_SERIAL  20
 
+/** The animation is advanced within refresh task, kept for compatibility */
+#define GT_TASK_PERIOD_TIME_ANIM    GT_TASK_PERIOD_TIME_REFR
+
 /** Free object memory after N ms timer */
 #define GT_TASK_PERIOD_TIME_DESTROY 10
 
@@ -109,6 +111,48 @@ extern "C" {
     #define GT_MEM_CUSTOM_BLOCK_SIZE    NULL
 #endif
 
+#ifndef GT_USE_MEM_SLAB
+    /**
+     * @brief Slab allocator for the small blocks, such as widgets object,
+     *      timer, animation, event attribute and child array. The blocks
+     *      which have the same size class are packed into fixed size pages,
+     *      the pages are reserved from the heap once by gt_mem_init().
+     *      The block which is larger than the biggest class or the slab is
+     *      exhausted will be allocated from the heap.
+     * [Default: 0]
+     */
+    #define GT_USE_MEM_SLAB         0
+#endif
+
+#if GT_USE_MEM_SLAB
+    #ifndef GT_MEM_SLAB_SIZE
+        /**
+         * @brief The memory size of the slab, reserved from the heap [Byte]
+         * [Default: 6 * 1024]
+         */
+        #define GT_MEM_SLAB_SIZE        (6 * 1024U)
+    #endif
+
+    #ifndef GT_MEM_SLAB_PAGE_SIZE
+        /**
+         * @brief The size of a slab page [Byte], a free page can be
+         *      reused by any size class. Multiple of 8, max 255 pages.
+         * [Default: 512]
+         */
+        #define GT_MEM_SLAB_PAGE_SIZE   512
+    #endif
+
+    #ifndef GT_MEM_SLAB_STYLE_CLASS_COUNT
+        /**
+         * @brief The count of the size classes which are sized by the style
+         *      struct of the widgets, such as: _gt_btn_st, _gt_label_st.
+         *      The class is added when the first widget of the type is created.
+         * [Default: 2]
+         */
+        #define GT_MEM_SLAB_STYLE_CLASS_COUNT   2
+    #endif
+#endif
+
 
 
 /* Compiler prefix for a big array declaration in RAM */
@@ -281,6 +325,78 @@ extern "C" {
     #define GT_USE_CUSTOM_TOUCH_EXPAND_SIZE     0
 #endif
 
+#ifndef GT_USE_OBJ_HIT_GRID
+    /**
+     * @brief Enabled uniform grid spatial index to find out the clicked
+     *      widget, the cost of each point query is independent of the
+     *      widgets count. @ref gt_hit_grid.h
+     * [Default: 0] walk all of the object tree
+     */
+    #define GT_USE_OBJ_HIT_GRID     0
+#endif
+
+#if GT_USE_OBJ_HIT_GRID
+    #ifndef GT_OBJ_HIT_GRID_CELL_SIZE
+        /**
+         * @brief The width and height of each grid cell, pixel.
+         *      [default: 64]
+         */
+        #define GT_OBJ_HIT_GRID_CELL_SIZE   64
+    #endif
+#endif
+
+#ifndef GT_USE_EVENT_QUEUE
+    /**
+     * @brief Enabled deferred event queue @ref gt_event_post(), the consecutive
+     *      same object and event type is coalesced before dispatch, and then
+     *      dispatch by priority within @ref GT_TASK_PERIOD_TIME_EVENT task.
+     * [Default: 0]
+     */
+    #define GT_USE_EVENT_QUEUE      0
+#endif
+
+#if GT_USE_EVENT_QUEUE
+    #ifndef GT_EVENT_QUEUE_SIZE
+        /**
+         * @brief The maximum count of the pending events of each priority
+         *      @ref gt_event_priority_et
+         *      [default: 16]
+         */
+        #define GT_EVENT_QUEUE_SIZE                 16
+    #endif
+
+    #ifndef GT_EVENT_QUEUE_OVERFLOW_DROP_OLDEST
+        /**
+         * @brief The policy when the queue is full:
+         *      0: discard the new posted event, gt_event_post() return GT_RES_FAIL;
+         *      1: discard the oldest pending event of the same priority.
+         *      [default: 1]
+         */
+        #define GT_EVENT_QUEUE_OVERFLOW_DROP_OLDEST 1
+    #endif
+#endif
+
+#ifndef GT_ANIM_POOL_SIZE
+    /**
+     * @brief The count of the animation slots which are pre-allocated,
+     *      the animation is allocated from heap when the pool is exhausted.
+     *      All of the animations are advanced before the display refresh
+     *      pass, @ref GT_TASK_PERIOD_TIME_REFR.
+     * [Default: 16]
+     */
+    #define GT_ANIM_POOL_SIZE       16
+#endif
+
+#ifndef GT_USE_DISP_COPY_AREA
+    /**
+     * @brief Enabled scroll blit: the pixels of the scrolled container are
+     *      moved by the display driver copy_area_cb(), then only the newly
+     *      exposed strip is redrawn. @ref gt_disp_drv_st
+     * [Default: 0]
+     */
+    #define GT_USE_DISP_COPY_AREA   0
+#endif
+
 /** display refresh time */
 #define GT_USE_DISPLAY_PREF_MSG         0
 
@@ -309,6 +425,18 @@ extern "C" {
         #define GT_SERIAL_USE_TIMER_RECV_UNPACK 1
     #endif
 
+    #ifndef GT_SERIAL_USE_EVENT_RECV
+        /**
+         * @brief Event driven receive, the port rx isr or dma callback push the bytes
+         *      by @ref gt_serial_client_send() and then call @ref gt_serial_client_notify(),
+         *      the frames are parsed on the next gt_task_handler() pass instead of
+         *      waiting for @ref GT_TASK_PERIOD_TIME_SERIAL polling period.
+         *      Must be used with GT_SERIAL_USE_TIMER_RECV_UNPACK.
+         *      [default: 0]
+         */
+        #define GT_SERIAL_USE_EVENT_RECV        0
+    #endif
+
     #ifndef GT_SERIAL_MASTER_CACHE_SIZE
         /**
          * @brief The size of the send cache cycle buffer
@@ -373,6 +501,15 @@ extern "C" {
         #define GT_SERIAL_GET_ONLY_VALID_DATA   1
     #endif
 
+    #ifndef GT_SERIAL_SYS_USE_FLASH_STREAM
+        /**
+         * @brief Enabled the nor flash stream update by GT_SERIAL_SYS_ADDR_NOR_FLASH,
+         *      sequential writes are combined by a page buffer @ref GT_HAL_FLASH_PAGE_SIZE
+         *      [default: GT_USE_MODE_FLASH]
+         */
+        #define GT_SERIAL_SYS_USE_FLASH_STREAM  GT_USE_MODE_FLASH
+    #endif
+
     #undef GT_QUEUE_USE_PRE_CHECK_VALID
     /**
      * @brief [Warn] Force Use pre-check data by callback function, such as: check uart data is valid.
@@ -387,6 +524,16 @@ extern "C" {
      */
     #define GT_USE_CRC          1
 
+    #if GT_SERIAL_SYS_USE_FLASH_STREAM
+    #undef GT_ENABLED_CRC32
+    /**
+     * @brief [Warn] Force enabled CRC32 function, which is used to verify
+     *      the flash stream @ref gt_serial_system.h
+     *      Must be used with GT_SERIAL_SYS_USE_FLASH_STREAM.
+     */
+    #define GT_ENABLED_CRC32    1
+    #endif
+
     #undef GT_USE_BIN_CONVERT
     /**
      * @brief [Warn] Force enabled bin convert function @ref gt_bin_convert.h
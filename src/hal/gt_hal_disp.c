@@ -20,6 +20,7 @@
 #include "../others/gt_area.h"
 #include "../others/gt_gc.h"
 #include "../widgets/gt_obj_class.h"
+#include "../others/gt_anim.h"
 
 /* private define -------------------------------------------------------*/
 #define OBJ_TYPE    GT_TYPE_LAYER_TOP
@@ -63,6 +64,7 @@ static GT_ATTRIBUTE_RAM_TEXT inline gt_size_t _gt_disp_area_get_idx(gt_size_t id
 
 static GT_ATTRIBUTE_RAM_TEXT void _gt_disp_task_handler(struct _gt_timer_s * timer) {
     GT_UNUSED(timer);
+    _gt_anim_frame_handler();
     gt_refr_timer();
 }
 
@@ -129,6 +131,10 @@ void gt_disp_drv_init(gt_disp_drv_st * drv)
 {
     drv->res_hor = GT_SCREEN_WIDTH;
     drv->res_ver = GT_SCREEN_HEIGHT;
+#if GT_USE_DISP_COPY_AREA
+    drv->copy_area_cb = NULL;
+    drv->frame_buf = NULL;
+#endif
 }
 
 void gt_disp_drv_register(gt_disp_drv_st * drv)
@@ -160,6 +166,30 @@ bool gt_disp_drv_check_flushing(gt_disp_drv_st * drv)
     return drv->flushing;
 }
 
+#if GT_USE_DISP_COPY_AREA
+void gt_disp_drv_copy_area_by_frame_buf(gt_disp_drv_st * drv, gt_area_st const * src, gt_point_st const * dst)
+{
+    GT_CHECK_BACK(drv);
+    GT_CHECK_BACK(drv->frame_buf);
+    uint16_t stride = drv->res_hor;
+    uint32_t len = src->w * sizeof(gt_color_t);
+    gt_size_t y = 0;
+
+    if (dst->y > src->y) {
+        /** Moving down, copy from the last line to avoid overwriting the source */
+        for (y = src->h - 1; y >= 0; y--) {
+            gt_memmove(&drv->frame_buf[(dst->y + y) * stride + dst->x],
+                       &drv->frame_buf[(src->y + y) * stride + src->x], len);
+        }
+        return ;
+    }
+    for (y = 0; y < src->h; y++) {
+        gt_memmove(&drv->frame_buf[(dst->y + y) * stride + dst->x],
+                   &drv->frame_buf[(src->y + y) * stride + src->x], len);
+    }
+}
+#endif
+
 /*************************************/
 /*                disp               */
 /*************************************/
@@ -315,6 +345,23 @@ void _gt_disp_refr_append_area(gt_area_st * area)
     }
 }
 
+#if GT_USE_DISP_COPY_AREA
+bool _gt_disp_refr_is_pending(gt_area_st const * const area)
+{
+    gt_disp_st * disp = gt_disp_get_default();
+    gt_size_t idx = disp->refr.idx_r;
+    gt_size_t len = (disp->refr.idx_w < idx ? _GT_REFR_AREA_MAX : 0) + disp->refr.idx_w - idx;
+
+    for (gt_size_t i = 0; i < len; i++) {
+        if (!disp->refr.joined[idx] && gt_area_is_intersect_screen(area, &disp->refr.areas[idx])) {
+            return true;
+        }
+        idx = _gt_disp_area_get_idx(++idx);
+    }
+    return false;
+}
+#endif
+
 uint8_t _gt_disp_refr_check(gt_disp_st * disp)
 {
     return disp->refr.idx_w != disp->refr.idx_r;
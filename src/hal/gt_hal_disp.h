@@ -55,6 +55,20 @@ typedef struct _gt_disp_drv_s
     void (* flush_cb)(struct _gt_disp_drv_s * drv, gt_area_st * area, gt_color_t * color);
     void (* wait_cb)(struct _gt_disp_drv_s * drv);
 
+#if GT_USE_DISP_COPY_AREA
+    /**
+     * @brief [optional] display copy area callback, move the pixels which
+     *      are already displayed, the source and destination may be overlapped.
+     *      NULL: not supported, the scrolled container is redrawn entirely.
+     *      Software implementation: @ref gt_disp_drv_copy_area_by_frame_buf()
+     * @param drv display driver
+     * @param src The source area of the physical screen
+     * @param dst The destination position of the source area
+     */
+    void (* copy_area_cb)(struct _gt_disp_drv_s * drv, gt_area_st const * src, gt_point_st const * dst);
+    gt_color_t * frame_buf; ///< [optional] full screen frame buffer which is scanned by panel, stride: res_hor
+#endif
+
     uint8_t rotated: 2;    ///< display rotation @ref gt_rotated_et
     uint8_t busy:1;        ///< display busy state
     uint8_t flushing:1;
@@ -90,6 +104,7 @@ typedef struct _gt_disp_s {
 
     gt_obj_st ** screens;       // Array of screen
     uint16_t cnt_scr;           // Count screens nub
+    uint16_t cap_scr;           // Capacity of the screens array
 
     /* flush */
     gt_area_st     area_act;            //Location of physical screen on virtual screen
@@ -119,6 +134,27 @@ gt_disp_st * gt_disp_get_default(void);
 void gt_disp_drv_set_flushing(gt_disp_drv_st * drv, bool state);
 bool gt_disp_drv_check_flushing(gt_disp_drv_st * drv);
 
+#if GT_USE_DISP_COPY_AREA
+/**
+ * @brief Software copy_area_cb() for full frame buffer mode, such as:
+ *      drv.frame_buf = fb; drv.copy_area_cb = gt_disp_drv_copy_area_by_frame_buf;
+ *
+ * @param drv drv->frame_buf must be the full screen buffer which is scanned by panel
+ * @param src The source area of the physical screen
+ * @param dst The destination position of the source area
+ */
+void gt_disp_drv_copy_area_by_frame_buf(gt_disp_drv_st * drv, gt_area_st const * src, gt_point_st const * dst);
+
+/**
+ * @brief Check the area is overlapped with any pending refresh area
+ *
+ * @param area
+ * @return true The area is waiting to be redrawn
+ * @return false
+ */
+bool _gt_disp_refr_is_pending(gt_area_st const * const area);
+#endif
+
 /**
  * @brief Get horizontal resolution value
  *
@@ -61,6 +61,85 @@ static GT_ATTRIBUTE_RAM_TEXT void _gt_vf_set_fp_by_list(gt_fs_fp_st * fp, gt_vfs
     fp->msg.pic.is_alpha = item->is_alpha;
 }
 
+/**
+ * @brief Fill the command and the address, 4 bytes address is used when
+ *      the address is over 16MB.
+ *
+ * @return uint8_t The length of the command and address
+ */
+static GT_ATTRIBUTE_RAM_TEXT uint8_t _flash_fill_cmd(uint8_t * buf, uint8_t cmd, uint32_t addr) {
+    buf[0] = cmd;
+    if (addr > 0xffffff) {
+        buf[1] = (uint8_t)(addr >> 24);
+        buf[2] = (uint8_t)(addr >> 16);
+        buf[3] = (uint8_t)(addr >> 8);
+        buf[4] = (uint8_t)addr;
+        return 5;
+    }
+    buf[1] = (uint8_t)(addr >> 16);
+    buf[2] = (uint8_t)(addr >> 8);
+    buf[3] = (uint8_t)addr;
+    return 4;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT bool _flash_wait_ready(gt_fs_drv_st * drv) {
+    uint8_t cmd = GT_HAL_FLASH_READ_STATUS_CMD;
+    uint8_t status = 0;
+    uint32_t retry = GT_HAL_FLASH_BUSY_RETRY;
+
+    do {
+        drv->rw_cb(&cmd, 1, &status, 1);
+        if (0 == (status & 0x01)) {
+            return true;
+        }
+    } while (--retry);
+
+    GT_LOGW(GT_LOG_TAG_GUI, "flash busy timeout");
+    return false;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _flash_write_enable(gt_fs_drv_st * drv) {
+    uint8_t cmd = GT_HAL_FLASH_WRITE_ENABLE_CMD;
+    drv->rw_cb(&cmd, 1, NULL, 0);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT bool _flash_erase_sector(gt_fs_drv_st * drv, uint32_t addr) {
+    uint8_t data_write[5] = {0};
+    uint8_t len_write = _flash_fill_cmd(data_write, GT_HAL_FLASH_SECTOR_ERASE_CMD, addr);
+
+    _flash_write_enable(drv);
+    drv->rw_cb(data_write, len_write, NULL, 0);
+    return _flash_wait_ready(drv);
+}
+
+/**
+ * @brief The data is split by the page boundary, each page is sent
+ *      with the command and address by one transfer.
+ */
+static GT_ATTRIBUTE_RAM_TEXT uint32_t _flash_program(gt_fs_drv_st * drv, uint32_t addr, uint8_t const * data, uint32_t len) {
+    static uint8_t data_write[5 + GT_HAL_FLASH_PAGE_SIZE];
+    uint32_t done = 0, part = 0;
+    uint8_t len_write = 0;
+
+    while (done < len) {
+        part = GT_HAL_FLASH_PAGE_SIZE - (addr % GT_HAL_FLASH_PAGE_SIZE);
+        if (part > len - done) {
+            part = len - done;
+        }
+        len_write = _flash_fill_cmd(data_write, GT_HAL_FLASH_PAGE_PROGRAM_CMD, addr);
+        gt_memcpy(&data_write[len_write], &data[done], part);
+
+        _flash_write_enable(drv);
+        drv->rw_cb(data_write, len_write + part, NULL, 0);
+        if (false == _flash_wait_ready(drv)) {
+            break;
+        }
+        addr += part;
+        done += part;
+    }
+    return done;
+}
+
 #if GT_USE_FILE_HEADER
 static GT_ATTRIBUTE_RAM_TEXT void * _fh_open_cb(struct _gt_fs_drv_s * drv, gt_file_header_param_st const * const fh_param, gt_fs_mode_et mode) {
     /* check drv state */
@@ -279,26 +358,21 @@ static GT_ATTRIBUTE_RAM_TEXT gt_fs_res_et _write_cb(struct _gt_fs_drv_s * drv, v
         return GT_FS_RES_NULL;
     }
 
+    uint32_t addr = vfp->pos + _vf_dev->addr_start;
+
     /* set state busy */
     _state = GT_FS_RES_BUSY;
 
-    /* start read */
-    // uint32_t addr = vfp->start + vfp->pos + _vf_dev->addr_start;
-    // uint8_t data_write[4] = {0x02, addr>>16, addr>>8, addr>>0 };
-    // drv->rw_cb(data_write, 4, data, 0);
-
-    /* write enable */
-    // 0x06
-    /*  */
-    /* write start */
-
-    /* write disable */
+    /* start write, the target range must be erased before */
+    *ret_len = _flash_program(drv, addr, data, len);
+    drv->seek_cb(drv, vfp, *ret_len, GT_FS_SEEK_CUR);
 
     /* set state ready */
     _state = GT_FS_RES_READY;
 
-    *ret_len = len;
-
+    if (*ret_len != len) {
+        return GT_FS_RES_HW_ERR;
+    }
     return GT_FS_RES_OK;
 }
 
@@ -430,5 +504,134 @@ gt_fs_drv_st * gt_vf_get_drv(void)
     return &_vf_dev->drv;
 }
 
+gt_fs_res_et gt_vf_flash_erase(uint32_t addr, uint32_t len)
+{
+    gt_fs_drv_st * drv = gt_vf_get_drv();
+    uint32_t end = addr + len;
+    gt_fs_res_et ret = GT_FS_RES_OK;
+
+    if (!drv || !drv->rw_cb) {
+        return GT_FS_RES_HW_ERR;
+    }
+    if (_state != GT_FS_RES_READY) {
+        return GT_FS_RES_BUSY;
+    }
+    _state = GT_FS_RES_BUSY;
+
+    addr -= addr % GT_HAL_FLASH_SECTOR_SIZE;
+    for (; addr < end; addr += GT_HAL_FLASH_SECTOR_SIZE) {
+        if (false == _flash_erase_sector(drv, addr)) {
+            ret = GT_FS_RES_HW_ERR;
+            break;
+        }
+    }
+
+    _state = GT_FS_RES_READY;
+    return ret;
+}
+
+uint32_t gt_vf_flash_program(uint32_t addr, uint8_t const * data, uint32_t len)
+{
+    gt_fs_drv_st * drv = gt_vf_get_drv();
+    uint32_t ret = 0;
+
+    if (!drv || !drv->rw_cb || !data) {
+        return 0;
+    }
+    if (_state != GT_FS_RES_READY) {
+        return 0;
+    }
+    _state = GT_FS_RES_BUSY;
+    ret = _flash_program(drv, addr, data, len);
+    _state = GT_FS_RES_READY;
+    return ret;
+}
+
+#if GT_HAL_FLASH_USE_RAM_MODEL
+static uint8_t * _model_mem = NULL;
+static uint32_t _model_size = 0;
+static bool _model_wel = false;
+
+void gt_vf_flash_model_init(uint8_t * mem, uint32_t size)
+{
+    _model_mem = mem;
+    _model_size = mem ? GT_MIN(size, 0x1000000) : 0;
+    _model_wel = false;
+    if (_model_mem) {
+        gt_memset(_model_mem, 0xFF, _model_size);
+    }
+}
+
+uint32_t gt_vf_flash_model_rw(uint8_t * data_write, uint32_t len_write, uint8_t * data_read, uint32_t len_read)
+{
+    uint8_t addr_len = 0;
+    uint32_t addr = 0, i = 0, page = 0;
+
+    if (!_model_mem || !data_write || 0 == len_write) {
+        return 0;
+    }
+    switch (data_write[0]) {
+        case GT_HAL_FLASH_WRITE_ENABLE_CMD:
+            _model_wel = true;
+            return len_write;
+        case GT_HAL_FLASH_READ_STATUS_CMD:
+            if (data_read && len_read) {
+                /** program and erase are finished immediately */
+                data_read[0] = _model_wel ? 0x02 : 0x00;
+                return 1;
+            }
+            return 0;
+        default:
+            break;
+    }
+    /** The model only supports 3 bytes address, max size: 16MB */
+    addr_len = 3;
+    if (len_write < 1u + addr_len) {
+        return 0;
+    }
+    for (i = 0; i < addr_len; ++i) {
+        addr = (addr << 8) | data_write[1 + i];
+    }
+
+    switch (data_write[0]) {
+        case GT_HAL_FLASH_READ_CMD: {
+            for (i = 0; i < len_read && data_read; ++i) {
+                data_read[i] = addr + i < _model_size ? _model_mem[addr + i] : 0xFF;
+            }
+            return len_read;
+        }
+        case GT_HAL_FLASH_PAGE_PROGRAM_CMD: {
+            if (false == _model_wel) {
+                return 0;
+            }
+            _model_wel = false;
+            /** The address wraps in the page, the bits can only be cleared */
+            page = addr - (addr % GT_HAL_FLASH_PAGE_SIZE);
+            for (i = 1 + addr_len; i < len_write; ++i) {
+                if (addr < _model_size) {
+                    _model_mem[addr] &= data_write[i];
+                }
+                addr = page + ((addr + 1) % GT_HAL_FLASH_PAGE_SIZE);
+            }
+            return len_write;
+        }
+        case GT_HAL_FLASH_SECTOR_ERASE_CMD: {
+            if (false == _model_wel) {
+                return 0;
+            }
+            _model_wel = false;
+            addr -= addr % GT_HAL_FLASH_SECTOR_SIZE;
+            if (addr < _model_size) {
+                gt_memset(&_model_mem[addr], 0xFF, GT_MIN(GT_HAL_FLASH_SECTOR_SIZE, _model_size - addr));
+            }
+            return len_write;
+        }
+        default:
+            break;
+    }
+    return 0;
+}
+#endif  /** GT_HAL_FLASH_USE_RAM_MODEL */
+
 #endif  /** GT_USE_MODE_FLASH */
 /* end ------------------------------------------------------------------*/
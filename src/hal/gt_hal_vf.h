@@ -28,6 +28,66 @@ extern "C" {
     #define GT_HAL_FLASH_READ_CMD       0x03
 #endif
 
+#ifndef GT_HAL_FLASH_WRITE_ENABLE_CMD
+    /**
+     * @brief Flash write enable command, which is sent before program and erase
+     */
+    #define GT_HAL_FLASH_WRITE_ENABLE_CMD   0x06
+#endif
+
+#ifndef GT_HAL_FLASH_READ_STATUS_CMD
+    /**
+     * @brief Flash read status register command, bit0: WIP(write in progress)
+     */
+    #define GT_HAL_FLASH_READ_STATUS_CMD    0x05
+#endif
+
+#ifndef GT_HAL_FLASH_PAGE_PROGRAM_CMD
+    /**
+     * @brief Flash page program command
+     */
+    #define GT_HAL_FLASH_PAGE_PROGRAM_CMD   0x02
+#endif
+
+#ifndef GT_HAL_FLASH_SECTOR_ERASE_CMD
+    /**
+     * @brief Flash sector erase command
+     */
+    #define GT_HAL_FLASH_SECTOR_ERASE_CMD   0x20
+#endif
+
+#ifndef GT_HAL_FLASH_PAGE_SIZE
+    /**
+     * @brief The page size of the flash program command [byte], the data of
+     *      one program command can not cross the page boundary.
+     */
+    #define GT_HAL_FLASH_PAGE_SIZE      256
+#endif
+
+#ifndef GT_HAL_FLASH_SECTOR_SIZE
+    /**
+     * @brief The minimum erase unit of the flash [byte]
+     */
+    #define GT_HAL_FLASH_SECTOR_SIZE    4096
+#endif
+
+#ifndef GT_HAL_FLASH_BUSY_RETRY
+    /**
+     * @brief The max times of polling the status register until the
+     *      program or erase is finished.
+     */
+    #define GT_HAL_FLASH_BUSY_RETRY     0x100000
+#endif
+
+#ifndef GT_HAL_FLASH_USE_RAM_MODEL
+    /**
+     * @brief Enabled a NOR flash model which is backed by RAM, it can be registered
+     *      by gt_vf_drv_register(gt_vf_flash_model_rw) to simulate the flash.
+     *      [default: 0]
+     */
+    #define GT_HAL_FLASH_USE_RAM_MODEL  0
+#endif
+
 
 /* typedef --------------------------------------------------------------*/
 
@@ -71,6 +131,42 @@ void gt_vf_drv_register(rw_cb_t rw_cb);
  */
 gt_fs_drv_st * gt_vf_get_drv(void);
 
+/**
+ * @brief Erase all of the sectors which are covered by [addr, addr + len)
+ *
+ * @param addr The physical address of the flash
+ * @param len The length of the range [byte]
+ * @return gt_fs_res_et GT_FS_RES_OK: all of the sectors erased
+ */
+gt_fs_res_et gt_vf_flash_erase(uint32_t addr, uint32_t len);
+
+/**
+ * @brief Program the data into the flash, which is split by the page boundary.
+ *      The target range must be erased before.
+ *
+ * @param addr The physical address of the flash
+ * @param data
+ * @param len
+ * @return uint32_t The number of bytes programmed
+ */
+uint32_t gt_vf_flash_program(uint32_t addr, uint8_t const * data, uint32_t len);
+
+#if GT_HAL_FLASH_USE_RAM_MODEL
+/**
+ * @brief Set the memory of the NOR flash model, the memory is filled with 0xFF
+ *
+ * @param mem
+ * @param size The size of the flash model [byte], 3 bytes address only, max: 16MB
+ */
+void gt_vf_flash_model_init(uint8_t * mem, uint32_t size);
+
+/**
+ * @brief The rw_cb of the NOR flash model, which supports the read, write enable,
+ *      read status, page program and sector erase commands.
+ */
+uint32_t gt_vf_flash_model_rw(uint8_t * data_write, uint32_t len_write, uint8_t * data_read, uint32_t len_read);
+#endif
+
 #endif  /** GT_USE_MODE_FLASH */
 
 #ifdef __cplusplus
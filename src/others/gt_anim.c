@@ -17,8 +17,12 @@
 #include "../others/gt_log.h"
 #include "../others/gt_types.h"
 #include "../others/gt_math.h"
+#include "../others/gt_area.h"
 #include "../widgets/gt_obj.h"
 #include "../core/gt_obj_pos.h"
+#include "../core/gt_hit_grid.h"
+#include "../hal/gt_hal_disp.h"
+#include "../core/gt_disp.h"
 
 
 /* private define -------------------------------------------------------*/
@@ -27,14 +31,28 @@
 
 
 /* private typedef ------------------------------------------------------*/
-
+/**
+ * @brief The running animations, the order is kept as the starting order.
+ *      The removed entries are compacted after the frame.
+ */
+typedef struct _gt_anim_table_s {
+    gt_anim_st ** items;
+    uint16_t cnt;
+    uint16_t cap;
+    uint16_t holes;     /* The count of the removed entries */
+}_gt_anim_table_st;
 
 
 /* static variables -----------------------------------------------------*/
-static _gt_timer_st * _anim_timer = NULL;
-static uint32_t _time_last_run    = 0;
-static bool _is_list_change       = false;
-static bool _is_run_same_time     = false;
+static GT_ATTRIBUTE_LARGE_RAM_ARRAY gt_anim_st _pool[GT_ANIM_POOL_SIZE];
+static GT_ATTRIBUTE_LARGE_RAM_ARRAY uint16_t _pool_free[GT_ANIM_POOL_SIZE];
+static uint16_t _pool_free_cnt    = 0;
+static _gt_anim_table_st _table   = {0};
+static uint32_t _time_last_frame  = 0;
+static uint32_t _time_frame       = 0;
+static bool _is_walking           = false;
+static bool _is_frame_dirty       = false;
+static gt_area_st _frame_dirty    = {0};
 static gt_anim_st * _anim_act     = NULL;
 
 /* macros ---------------------------------------------------------------*/
@@ -68,31 +86,217 @@ static inline bool _gt_anim_free_data(gt_anim_st * anim) {
     return true;
 }
 
-static inline _gt_timer_st * _gt_anim_get_timer(void) {
-    return _anim_timer;
-}
-
-static inline void _gt_anim_set_timer(struct _gt_timer_s * timer) {
-    _anim_timer = timer;
+static inline bool _gt_anim_is_pooled(gt_anim_st const * const anim) {
+    return anim >= &_pool[0] && anim < &_pool[GT_ANIM_POOL_SIZE];
 }
 
-static void _gt_anim_change_list(void)
-{
-    _is_list_change = true;
-    if (_gt_gc_is_ll_empty(&_GT_GC_GET_ROOT(_gt_anim_ll))) {
-        _gt_timer_set_paused(_gt_anim_get_timer(), true);
-    } else {
-        _gt_timer_set_paused(_gt_anim_get_timer(), false);
+static GT_ATTRIBUTE_RAM_TEXT gt_anim_st * _gt_anim_alloc(void) {
+    if (_pool_free_cnt) {
+        return &_pool[_pool_free[--_pool_free_cnt]];
     }
+    return (gt_anim_st * )gt_mem_malloc(sizeof(gt_anim_st));
 }
 
-static void _gt_anim_free_task(gt_anim_st * anim) {
-    _gt_list_del(&anim->list);
-    _gt_anim_change_list();
+static GT_ATTRIBUTE_RAM_TEXT void _gt_anim_release(gt_anim_st * anim) {
     _gt_anim_free_data(anim);
+    if (anim->pooled) {
+        _pool_free[_pool_free_cnt++] = (uint16_t)(anim - &_pool[0]);
+        return ;
+    }
     gt_mem_free(anim);
 }
 
+/**
+ * @brief Drop the removed entries and keep the order of the others.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_anim_compact(void) {
+    gt_anim_st * ptr = NULL;
+    uint16_t w = 0;
+
+    for (uint16_t i = 0; i < _table.cnt; i++) {
+        ptr = _table.items[i];
+        if (NULL == ptr) {
+            continue;
+        }
+        if (ptr->removed) {
+            _gt_anim_release(ptr);
+            continue;
+        }
+        ptr->_idx = w;
+        _table.items[w++] = ptr;
+    }
+    _table.cnt = w;
+    _table.holes = 0;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT bool _gt_anim_table_push(gt_anim_st * anim) {
+    if (_table.cnt == _table.cap && _table.holes && !_is_walking) {
+        _gt_anim_compact();
+    }
+    if (_table.cnt == _table.cap) {
+        uint16_t cap = _table.cap ? (_table.cap << 1) : GT_ANIM_POOL_SIZE;
+        gt_anim_st ** items = (gt_anim_st ** )gt_mem_realloc(_table.items, cap * sizeof(gt_anim_st * ));
+        if (NULL == items) {
+            GT_LOGW(GT_LOG_TAG_GUI, "anim table realloc failed, size: %d", cap);
+            return false;
+        }
+        _table.items = items;
+        _table.cap = cap;
+    }
+    anim->_idx = _table.cnt;
+    _table.items[_table.cnt++] = anim;
+    return true;
+}
+
+/**
+ * @brief O(1) remove, the entry is released immediately, or marked and
+ *      released after the frame while the animations are advancing, so
+ *      that the walk need not restart and the callbacks are able to check
+ *      the removed flag safely.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_anim_remove(gt_anim_st * anim) {
+    if (anim->removed) {
+        return ;
+    }
+    anim->removed = 1;
+    if (anim->deleted_cb) { anim->deleted_cb(anim); }
+    ++_table.holes;
+    if (_is_walking) {
+        return ;
+    }
+    _table.items[anim->_idx] = NULL;
+    _gt_anim_release(anim);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT bool _gt_anim_is_running(gt_anim_st const * const anim) {
+    if (_gt_anim_is_pooled(anim)) {
+        return anim->_idx < _table.cnt && _table.items[anim->_idx] == anim && !anim->removed;
+    }
+    for (uint16_t i = 0; i < _table.cnt; i++) {
+        if (_table.items[i] == anim) {
+            return !anim->removed;
+        }
+    }
+    return false;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _gt_anim_mark_dirty(gt_area_st const * const area) {
+    if (0 == area->w || 0 == area->h) {
+        return ;
+    }
+    if (false == _is_frame_dirty) {
+        _frame_dirty = *area;
+        _is_frame_dirty = true;
+        return ;
+    }
+    gt_area_join(&_frame_dirty, &_frame_dirty, area);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _gt_anim_submit_dirty(void) {
+    if (false == _is_frame_dirty) {
+        return ;
+    }
+    _is_frame_dirty = false;
+    _gt_disp_refr_append_area(&_frame_dirty);
+}
+
+/**
+ * @brief The geometry track is written by gt_obj_set_pos() / gt_obj_set_size()
+ *      at the last step of each pass, so that the GT_EVENT_TYPE_UPDATE_STYLE
+ *      event is sent once the object arrived. The virtual object and the
+ *      widget within layer top are always written by the setters.
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _gt_anim_track_by_setter(gt_anim_st const * const anim, gt_obj_st * obj) {
+    if (anim->time_act >= anim->time || gt_obj_get_virtual(obj)) {
+        return true;
+    }
+#if GT_USE_LAYER_TOP
+    gt_obj_st * layer_top = gt_disp_get_layer_top();
+    if (NULL == layer_top) {
+        return false;
+    }
+    while (obj->parent) {
+        obj = obj->parent;
+    }
+    return obj == layer_top;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Write the track value into the target object without any event,
+ *      the old and new area are merged into the frame dirty area.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_anim_write_track(gt_anim_st * anim) {
+    gt_obj_st * obj = (gt_obj_st * )anim->tar;
+    int32_t value = anim->value_current;
+    GT_CHECK_BACK(obj);
+    gt_area_st area_old = obj->area;
+
+    switch (anim->track) {
+        case GT_ANIM_TRACK_X: {
+            if (_gt_anim_track_by_setter(anim, obj)) {
+                gt_obj_set_pos(obj, value, obj->area.y);
+                return ;
+            }
+            _gt_obj_move_child_by(obj, value - obj->area.x, 0);
+            obj->area.x = value;
+            break;
+        }
+        case GT_ANIM_TRACK_Y: {
+            if (_gt_anim_track_by_setter(anim, obj)) {
+                gt_obj_set_pos(obj, obj->area.x, value);
+                return ;
+            }
+            _gt_obj_move_child_by(obj, 0, value - obj->area.y);
+            obj->area.y = value;
+            break;
+        }
+        case GT_ANIM_TRACK_W: {
+            if (_gt_anim_track_by_setter(anim, obj)) {
+                gt_obj_set_size(obj, value < 0 ? 0 : value, obj->area.h);
+                return ;
+            }
+            obj->area.w = value < 0 ? 0 : value;
+            break;
+        }
+        case GT_ANIM_TRACK_H: {
+            if (_gt_anim_track_by_setter(anim, obj)) {
+                gt_obj_set_size(obj, obj->area.w, value < 0 ? 0 : value);
+                return ;
+            }
+            obj->area.h = value < 0 ? 0 : value;
+            break;
+        }
+        case GT_ANIM_TRACK_OPA: {
+            obj->opa = (gt_opa_t)value;
+            if (gt_obj_get_visible(obj)) {
+                _gt_anim_mark_dirty(&obj->area);
+            }
+            return ;
+        }
+        case GT_ANIM_TRACK_VALUE: {
+            if (anim->exec_cb) {
+                anim->exec_cb(anim->tar, value);
+            }
+            if (anim->removed) {
+                return ;
+            }
+            _gt_anim_mark_dirty(&obj->area);
+            return ;
+        }
+        default:
+            return ;
+    }
+#if GT_USE_OBJ_HIT_GRID
+    _gt_hit_grid_update(obj);
+#endif
+    _gt_disp_update_max_area(&obj->area, _gt_obj_is_ignore_calc_max_area(obj));
+    _gt_anim_mark_dirty(&area_old);
+    _gt_anim_mark_dirty(&obj->area);
+}
+
 static int32_t _gt_anim_path_linear(const struct gt_anim_s * anim) {
     int32_t step = gt_map(anim->time_act, 0, anim->time, 0, _GT_ANIM_PATH_RESOLUTION);
     int32_t value = (anim->value_end - anim->value_start) * step;
@@ -197,8 +401,7 @@ static void _gt_anim_ready_handler(gt_anim_st * anim) {
 
     if (!anim->repeat_count && (anim->invert || !anim->playback_time)) {
         if (anim->ready_cb) { anim->ready_cb(anim); }
-        if (anim->deleted_cb) { anim->deleted_cb(anim); }
-        _gt_anim_free_task(anim);
+        _gt_anim_remove(anim);
         return ;
     }
 
@@ -224,73 +427,68 @@ static void _gt_anim_ready_handler(gt_anim_st * anim) {
     }
 }
 
-static void _gt_anim_task_handler(struct _gt_timer_s * timer)
-{
-    GT_UNUSED(timer);
-    if (_gt_gc_is_ll_empty(&_GT_GC_GET_ROOT(_gt_anim_ll))) {
+/**
+ * @brief Advance the animation to the frame timestamp
+ *
+ * @param ptr
+ * @param elapsed The time from the previous frame [ms]
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_anim_advance(gt_anim_st * ptr, uint32_t elapsed) {
+    int32_t new_value = 0;
+
+    if (ptr->paused) {
+        ptr->tick_create += elapsed;
         return ;
     }
-
-    int32_t    new_value    = 0;
-    gt_anim_st * ptr        = NULL;
-    gt_anim_st * backup_ptr = NULL;
-
-    _is_run_same_time = _is_run_same_time ? false : true;
-refresh_lb:
-    _gt_list_for_each_entry_safe(ptr, backup_ptr, &_GT_GC_GET_ROOT(_gt_anim_ll), gt_anim_st, list) {
-        _is_list_change = false;
-
-        if (ptr->run_already == _is_run_same_time) {
-            continue;
-        }
-        ptr->run_already = _is_run_same_time ? 1 : 0;
-
-        if (ptr->paused) {
-            ptr->tick_create = gt_tick_elapse(ptr->tick_create);
-            continue;
-        }
-        if (ptr->time_delay_start > 0) {
-            if (gt_tick_elapse(ptr->tick_create) < ptr->time_delay_start) {
-                continue;
-            }
-            ptr->time_delay_start = 0;
+    if (ptr->time_delay_start > 0) {
+        if ((int32_t)(_time_frame - ptr->tick_create) < ptr->time_delay_start) {
+            return ;
         }
+        elapsed = _time_frame - ptr->tick_create - ptr->time_delay_start;
+        ptr->time_delay_start = 0;
+        ptr->run_already = 1;
+    }
+    else if (!ptr->run_already) {
+        /* started between two frames */
+        elapsed = _time_frame - ptr->tick_create;
+        ptr->run_already = 1;
+    }
 
-        _gt_anim_set_act(ptr);
+    _gt_anim_set_act(ptr);
 
-        if (ptr->time_act <= 0 && ptr->start_cb) {
-            ptr->start_cb(ptr);
+    if (ptr->time_act <= 0 && ptr->start_cb) {
+        ptr->start_cb(ptr);
+        if (ptr->removed) {
+            return ;
         }
+    }
 
-        ptr->time_act += gt_tick_elapse(_time_last_run);    // time has gone
-        if (ptr->time_act < 0) {
-            continue;
-        }
-        if (ptr->time_act > ptr->time) {
-            ptr->time_act = ptr->time;
-        }
-        new_value = ptr->_path_cb(ptr);
-        if (new_value != ptr->value_current) {
+    ptr->time_act += elapsed;    // time has gone
+    if (ptr->time_act < 0) {
+        return ;
+    }
+    if (ptr->time_act > ptr->time) {
+        ptr->time_act = ptr->time;
+    }
+    new_value = ptr->_path_cb(ptr);
+    if (GT_ANIM_TRACK_NONE != ptr->track) {
+        /* The last step is always written, even if the path arrived early */
+        if (new_value != ptr->value_current || ptr->time_act >= ptr->time) {
             ptr->value_current = new_value;
-            if (ptr->exec_cb) {
-                ptr->exec_cb(ptr->tar, ptr->value_current);
-            }
+            _gt_anim_write_track(ptr);
         }
-        if (ptr->time_act >= ptr->time) {
-            _gt_anim_ready_handler(ptr);
-        }
-
-        if (_is_list_change) {
-            break;
+    } else if (new_value != ptr->value_current) {
+        ptr->value_current = new_value;
+        if (ptr->exec_cb) {
+            ptr->exec_cb(ptr->tar, ptr->value_current);
         }
     }
-
-    if (_is_list_change) {
-        _is_list_change = false;
-        goto refresh_lb;
+    if (ptr->removed) {
+        return ;
+    }
+    if (ptr->time_act >= ptr->time) {
+        _gt_anim_ready_handler(ptr);
     }
-    _gt_anim_clr_act();
-    _time_last_run = gt_tick_get();
 }
 
 static void _default_exec_cb(void * obj, int32_t value) {
@@ -349,11 +547,59 @@ void gt_anim_pos_move(gt_obj_st * obj, gt_anim_param_st * param)
 
 void _gt_anim_core_init(void)
 {
-    _GT_INIT_LIST_HEAD(&_GT_GC_GET_ROOT(_gt_anim_ll));
+    for (uint16_t i = 0; i < GT_ANIM_POOL_SIZE; i++) {
+        _pool_free[i] = GT_ANIM_POOL_SIZE - 1 - i;
+    }
+    _pool_free_cnt = GT_ANIM_POOL_SIZE;
+    _time_last_frame = gt_tick_get();
+}
+
+void _gt_anim_frame_handler(void)
+{
+    gt_anim_st * ptr = NULL;
+    uint32_t elapsed = 0;
+
+    _time_frame = gt_tick_get();
+    elapsed = _time_frame - _time_last_frame;
+    _time_last_frame = _time_frame;
+    if (0 == _table.cnt) {
+        return ;
+    }
+
+    _is_walking = true;
+    /** The animations which are started by callbacks run from the next frame */
+    for (uint16_t i = 0, cnt = _table.cnt; i < cnt; i++) {
+        ptr = _table.items[i];
+        if (NULL == ptr || ptr->removed) {
+            continue;
+        }
+        _gt_anim_advance(ptr, elapsed);
+    }
+    _is_walking = false;
+    _gt_anim_clr_act();
+
+    if (_table.holes) {
+        _gt_anim_compact();
+    }
+    _gt_anim_submit_dirty();
+}
+
+void _gt_anim_remove_target(void const * const target)
+{
+    gt_anim_st * ptr = NULL;
+
+    for (uint16_t i = 0; i < _table.cnt; i++) {
+        ptr = _table.items[i];
+        if (NULL == ptr || ptr->tar != target) {
+            continue;
+        }
+        _gt_anim_remove(ptr);
+    }
+}
 
-    _gt_anim_set_timer(_gt_timer_create(_gt_anim_task_handler, GT_TASK_PERIOD_TIME_ANIM, NULL));
-    _gt_anim_change_list();
-    _is_list_change = false;
+uint16_t gt_anim_get_count(void)
+{
+    return _table.cnt - _table.holes;
 }
 
 void gt_anim_init(gt_anim_st * anim)
@@ -361,7 +607,6 @@ void gt_anim_init(gt_anim_st * anim)
     if (!anim) { return ; }
 
     gt_memset_0(anim, sizeof(gt_anim_st));
-    _GT_INIT_LIST_HEAD(&anim->list);
     anim->time_delay_start = 0;
     anim->time = 500;
     anim->time_act = 0;
@@ -375,37 +620,35 @@ gt_anim_st * gt_anim_start(const gt_anim_st * anim)
 {
     if (!anim) { return NULL; }
 
-    gt_anim_st * ptr        = NULL;
-    gt_anim_st * backup_ptr = NULL;
-    gt_anim_st * new_obj = (gt_anim_st * )gt_mem_malloc(sizeof(gt_anim_st));
+    gt_anim_st * ptr     = NULL;
+    gt_anim_st * new_obj = _gt_anim_alloc();
     GT_CHECK_BACK_VAL(new_obj, NULL);
 
-    if (_gt_gc_is_ll_empty(&_GT_GC_GET_ROOT(_gt_anim_ll))) {
-        _time_last_run = gt_tick_get();
-    }
-
     gt_memcpy(new_obj, anim, sizeof(gt_anim_st));
     new_obj->tick_create = gt_tick_get();
-
-    if (new_obj->list.next != &new_obj->list || new_obj->list.prev != &new_obj->list) {
-        _GT_INIT_LIST_HEAD(&new_obj->list);
-    }
+    new_obj->pooled      = _gt_anim_is_pooled(new_obj) ? 1 : 0;
+    new_obj->removed     = 0;
+    new_obj->run_already = 0;
 
     // remove before the same exec callback
-    _gt_list_for_each_entry_safe(ptr, backup_ptr, &_GT_GC_GET_ROOT(_gt_anim_ll), gt_anim_st, list) {
+    for (uint16_t i = 0; i < _table.cnt; i++) {
+        ptr = _table.items[i];
+        if (NULL == ptr || ptr->removed) {
+            continue;
+        }
         if (new_obj->tar != ptr->tar) {
             continue;
         }
-        if (new_obj->exec_cb != ptr->exec_cb) {
+        if (new_obj->exec_cb != ptr->exec_cb || new_obj->track != ptr->track) {
             continue;
         }
-        if (ptr->deleted_cb) { ptr->deleted_cb(ptr); }
-        _gt_anim_free_task(ptr);
+        _gt_anim_remove(ptr);
     }
 
-    _gt_list_add(&new_obj->list, &_GT_GC_GET_ROOT(_gt_anim_ll));
-    _gt_anim_change_list();
-
+    if (false == _gt_anim_table_push(new_obj)) {
+        _gt_anim_release(new_obj);
+        return NULL;
+    }
     return new_obj;
 }
 
@@ -420,24 +663,22 @@ void gt_anim_restart(gt_anim_st * anim)
     if (!anim) { return ; }
     if (anim->paused) { anim->paused = false; }
     anim->time_act = 0;
+    anim->run_already = 0;
     anim->tick_create = gt_tick_get();
 }
 
 bool gt_anim_del(void const * const target, gt_anim_exec_cb_t exec_cb)
 {
     bool ret = false;
-    gt_anim_st * ptr        = NULL;
-    gt_anim_st * backup_ptr = NULL;
-
-    if (_gt_gc_is_ll_empty(&_GT_GC_GET_ROOT(_gt_anim_ll))) {
-        return ret;
-    }
+    gt_anim_st * ptr = NULL;
 
-    _gt_list_for_each_entry_safe(ptr, backup_ptr, &_GT_GC_GET_ROOT(_gt_anim_ll), gt_anim_st, list) {
+    for (uint16_t i = 0; i < _table.cnt; i++) {
+        ptr = _table.items[i];
+        if (NULL == ptr || ptr->removed) {
+            continue;
+        }
         if ((ptr->tar == target || NULL == ptr->tar) && (ptr->exec_cb == exec_cb || NULL == ptr->exec_cb)) {
-            if (ptr->deleted_cb) { ptr->deleted_cb(ptr); }
-            ptr->exec_cb = NULL;
-            _gt_anim_free_task(ptr);
+            _gt_anim_remove(ptr);
             ret = true;
         }
     }
@@ -447,45 +688,23 @@ bool gt_anim_del(void const * const target, gt_anim_exec_cb_t exec_cb)
 
 bool gt_anim_del_by(gt_anim_st * anim)
 {
-    bool ret = false;
-    gt_anim_st * ptr        = NULL;
-    gt_anim_st * backup_ptr = NULL;
-
-    if (_gt_gc_is_ll_empty(&_GT_GC_GET_ROOT(_gt_anim_ll))) {
-        return ret;
-    }
-
-    _gt_list_for_each_entry_safe(ptr, backup_ptr, &_GT_GC_GET_ROOT(_gt_anim_ll), gt_anim_st, list) {
-        if (ptr == anim) {
-            if (ptr->deleted_cb) { ptr->deleted_cb(ptr); }
-            _gt_anim_free_task(ptr);
-            ret = true;
-        }
+    if (NULL == anim || false == _gt_anim_is_running(anim)) {
+        return false;
     }
-
-    return ret;
+    _gt_anim_remove(anim);
+    return true;
 }
 
 void gt_anim_del_all(void)
 {
-    bool ret = false;
-    gt_anim_st * ptr        = NULL;
-    gt_anim_st * backup_ptr = NULL;
-
-    if (_gt_gc_is_ll_empty(&_GT_GC_GET_ROOT(_gt_anim_ll))) {
-        return ;
-    }
+    gt_anim_st * ptr = NULL;
 
-    _gt_list_for_each_entry_safe(ptr, backup_ptr, &_GT_GC_GET_ROOT(_gt_anim_ll), gt_anim_st, list) {
-        if (ptr) {
-            if (ptr->deleted_cb) { ptr->deleted_cb(ptr); }
-            _gt_anim_free_task(ptr);
-            ret = true;
+    for (uint16_t i = 0; i < _table.cnt; i++) {
+        ptr = _table.items[i];
+        if (NULL == ptr) {
+            continue;
         }
-    }
-
-    if (ret) {
-        _gt_anim_change_list();
+        _gt_anim_remove(ptr);
     }
 }
 
@@ -44,6 +44,24 @@ typedef enum {
     GT_ANIM_PATH_TYPE_COUNT,
 }gt_anim_path_type_em;
 
+/**
+ * @brief anim property track type enum, the value is written into the
+ *      target object directly by the animation core, the changed areas
+ *      of all tracks are merged and submitted once per frame.
+ */
+typedef enum {
+    GT_ANIM_TRACK_NONE = 0,     /* default: using exec_cb */
+    GT_ANIM_TRACK_X,            /* gt_obj_st area.x, childs moved together */
+    GT_ANIM_TRACK_Y,            /* gt_obj_st area.y, childs moved together */
+    GT_ANIM_TRACK_W,            /* gt_obj_st area.w */
+    GT_ANIM_TRACK_H,            /* gt_obj_st area.h */
+    GT_ANIM_TRACK_OPA,          /* gt_obj_st opa */
+    GT_ANIM_TRACK_VALUE,        /* exec_cb only save the value, redraw by animation core */
+
+    /* get track type max count */
+    GT_ANIM_TRACK_COUNT,
+}gt_anim_track_type_em;
+
 
 struct gt_anim_s;
 
@@ -93,7 +111,6 @@ typedef struct gt_anim_param_s {
  * [Core using: User do not modified]
  */
 typedef struct gt_anim_s {
-    struct _gt_list_head list;          /* Do not modified it, Core need to use it */
     void * tar;                         // Target object
     gt_anim_exec_cb_t exec_cb;          // The path execution callback which object run
     gt_anim_start_cb_t start_cb;        // When the animation starts need to be executed
@@ -117,13 +134,17 @@ typedef struct gt_anim_s {
     uint32_t repeat_delay;      // The time to repeat playback animation [ms]
     uint16_t repeat_count;      // The number of times to repeat playback animation, infinite: GT_ANIM_REPEAT_INFINITE
     gt_anim_path_type_em type;  // The path which is animation object to run
+    uint8_t track;              // The property written directly @ref gt_anim_track_type_em
 
     /* Warn: anim core system used these - user should not modified it */
-    uint8_t run_already : 1;    // Determines whether the current moment has been executed
+    uint16_t _idx;              // The index of the animation table
+    uint8_t run_already : 1;    // The animation has been advanced by frame
     uint8_t invert      : 1;    // remark playback current status [0: forward, 1: backward]
     uint8_t playback    : 1;    // TODO enabled playback
     uint8_t paused      : 1;    // paused status
-    uint8_t reserved    : 4;
+    uint8_t pooled      : 1;    // 1: allocated from pool; 0: allocated from heap
+    uint8_t removed     : 1;    // removed, waiting to be released after the frame
+    uint8_t reserved    : 2;
 }gt_anim_st;
 
 
@@ -188,6 +209,17 @@ static inline void gt_anim_set_start_cb(gt_anim_st * anim, gt_anim_start_cb_t st
     anim->start_cb = start_cb;
 }
 
+/**
+ * @brief Set the property which is written directly by the animation core,
+ *      the exec_cb is not required except GT_ANIM_TRACK_VALUE.
+ *
+ * @param anim
+ * @param track @ref gt_anim_track_type_em
+ */
+static inline void gt_anim_set_track(gt_anim_st * anim, gt_anim_track_type_em track) {
+    anim->track = (uint8_t)track;
+}
+
 static inline void gt_anim_set_exec_cb(gt_anim_st * anim, gt_anim_exec_cb_t exec_cb) {
     anim->exec_cb = exec_cb;
 }
@@ -291,10 +323,31 @@ void gt_anim_param_init(gt_anim_param_st * param);
 void gt_anim_pos_move(gt_obj_st * obj, gt_anim_param_st * param);
 
 /**
- * @brief [only kernel calling] initialize the animation timer by core
+ * @brief [only kernel calling] initialize the animation pool by core
  */
 void _gt_anim_core_init(void);
 
+/**
+ * @brief [only kernel calling] Advance all of the animations against the
+ *      same frame timestamp, called right before the display refresh pass.
+ */
+void _gt_anim_frame_handler(void);
+
+/**
+ * @brief [only kernel calling] Delete all of the animations which target
+ *      is the object, called before the object is freed.
+ *
+ * @param target
+ */
+void _gt_anim_remove_target(void const * const target);
+
+/**
+ * @brief Get the count of the running animations
+ *
+ * @return uint16_t
+ */
+uint16_t gt_anim_get_count(void);
+
 /**
  * @brief initialize the animation object
  *
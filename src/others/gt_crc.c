@@ -13,7 +13,11 @@
 #if GT_USE_CRC
 
 /* private define -------------------------------------------------------*/
-
+#if GT_ENABLED_CRC16
+    #if GT_CRC16_SLICE_BY != 1 && GT_CRC16_SLICE_BY != 4 && GT_CRC16_SLICE_BY != 8
+        #error "GT_CRC16_SLICE_BY must be 1, 4 or 8"
+    #endif
+#endif
 
 
 /* private typedef ------------------------------------------------------*/
@@ -31,7 +35,11 @@ static GT_ATTRIBUTE_LARGE_RAM_ARRAY uint8_t crc8_table[256] = {0};
 #if GT_ENABLED_CRC16
 
 static bool crc16_init_flag         = false;
-static GT_ATTRIBUTE_LARGE_RAM_ARRAY uint16_t crc16_table[256] = {0};
+/**
+ * @brief crc16_table[0] is the byte table, crc16_table[k][i] is the CRC of
+ *      byte i followed by k zero bytes, used by slice-by-N.
+ */
+static GT_ATTRIBUTE_LARGE_RAM_ARRAY uint16_t crc16_table[GT_CRC16_SLICE_BY][256] = {0};
 
 #endif  /** GT_ENABLED_CRC16 */
 
@@ -45,7 +53,7 @@ static GT_ATTRIBUTE_LARGE_RAM_ARRAY uint32_t crc32_table[256] = {0};
 /* macros ---------------------------------------------------------------*/
 
 #if GT_ENABLED_CRC16
-    #define _crc16_calc(crc, val)     		((crc >> 8) ^ crc16_table[ (crc ^ (uint16_t)val) & 0x00FF ])
+    #define _crc16_calc(crc, val)     		((crc >> 8) ^ crc16_table[0][ (crc ^ (uint16_t)val) & 0x00FF ])
 #endif  /** GT_ENABLED_CRC16 */
 
 #if GT_ENABLED_CRC32
@@ -95,7 +103,13 @@ static void init_crc16_tab(void) {
 
 			c = c >> 1;
 		}
-		crc16_table[i] = crc;
+		crc16_table[0][i] = crc;
+	}
+	for (j = 1; j < GT_CRC16_SLICE_BY; ++j) {
+		for (i = 0; i < 256; ++i) {
+			crc = crc16_table[j - 1][i];
+			crc16_table[j][i] = (crc >> 8) ^ crc16_table[0][crc & 0x00FF];
+		}
 	}
 	crc16_init_flag = true;
 }
@@ -147,61 +161,74 @@ uint8_t gt_update_crc8(uint8_t crc, uint8_t val) {
 #if GT_ENABLED_CRC16
 uint16_t gt_crc16(const uint8_t * input_str, size_t num_bytes)
 {
-	uint16_t crc = GT_CRC16_START;
-	const uint8_t * ptr = input_str;
-	size_t a = 0;
-
-	if ( ! crc16_init_flag ) init_crc16_tab();
-
-	if (NULL == ptr) { return crc; }
-    for (; a < num_bytes; ++a) {
-        crc = _crc16_calc(crc, *ptr++);
-	}
-	return crc;
+	return gt_crc16_update_buf(GT_CRC16_START, input_str, num_bytes);
 }
 
 uint16_t gt_crc16_mod_bus(const uint8_t * input_str, size_t num_bytes)
 {
-	uint16_t crc = GT_CRC16_START_MOD_BUS;
-	const uint8_t * ptr = input_str;
-	size_t a = 0;
+	return gt_crc16_update_buf(GT_CRC16_START_MOD_BUS, input_str, num_bytes);
+}
 
+uint16_t gt_update_crc16(uint16_t crc, uint8_t c)
+{
 	if ( ! crc16_init_flag ) init_crc16_tab();
 
-	if (NULL == ptr) { return crc; }
-	for (; a < num_bytes; ++a) {
-        crc = _crc16_calc(crc, *ptr++);
-	}
-	return crc;
+	return _crc16_calc(crc, c);
 }
 
-uint16_t gt_update_crc16(uint16_t crc, uint8_t c)
+uint16_t gt_crc16_update_buf(uint16_t crc, const uint8_t * buf, size_t len)
 {
+	const uint8_t * ptr = buf;
+
 	if ( ! crc16_init_flag ) init_crc16_tab();
 
-	return _crc16_calc(crc, c);
+	if (NULL == ptr) { return crc; }
+#if GT_CRC16_SLICE_BY > 1
+	/** The 16 bits CRC only overlaps the first two bytes of each round */
+	for (; len >= GT_CRC16_SLICE_BY; len -= GT_CRC16_SLICE_BY, ptr += GT_CRC16_SLICE_BY) {
+		crc ^= (uint16_t)ptr[0] | ((uint16_t)ptr[1] << 8);
+#if GT_CRC16_SLICE_BY == 8
+		crc = crc16_table[7][crc & 0x00FF] ^ crc16_table[6][crc >> 8] ^
+			  crc16_table[5][ptr[2]] ^ crc16_table[4][ptr[3]] ^
+			  crc16_table[3][ptr[4]] ^ crc16_table[2][ptr[5]] ^
+			  crc16_table[1][ptr[6]] ^ crc16_table[0][ptr[7]];
+#else
+		crc = crc16_table[3][crc & 0x00FF] ^ crc16_table[2][crc >> 8] ^
+			  crc16_table[1][ptr[2]] ^ crc16_table[0][ptr[3]];
+#endif
+	}
+#endif
+	for (; len; --len) {
+		crc = _crc16_calc(crc, *ptr++);
+	}
+	return crc;
 }
 #endif  /** GT_ENABLED_CRC16 */
 
 #if GT_ENABLED_CRC32
 uint32_t gt_crc32(const uint8_t * input_str, size_t num_bytes)
 {
-	uint32_t crc = GT_CRC_START_32;
-	const uint8_t * ptr = input_str;
-	size_t a = 0;
+	return (gt_crc32_update_buf(GT_CRC_START_32, input_str, num_bytes) ^ 0xFFFFFFFFul);
+}
 
+uint32_t gt_update_crc32(uint32_t crc, uint8_t c)
+{
 	if ( ! crc32_init_flag ) init_crc32_tab();
 
-	if (NULL == ptr) { return crc; }
-    for (a = 0; a < num_bytes; ++a) {
-        crc = _crc32_calc(crc, *ptr++);
-	}
-	return (crc ^ 0xFFFFFFFFul);
+	return _crc32_calc(crc, c);
 }
 
-uint32_t gt_update_crc32(uint32_t crc, uint8_t c)
+uint32_t gt_crc32_update_buf(uint32_t crc, const uint8_t * buf, size_t len)
 {
-	return _crc32_calc(crc, c);
+	const uint8_t * ptr = buf;
+
+	if ( ! crc32_init_flag ) init_crc32_tab();
+
+	if (NULL == ptr) { return crc; }
+	for (; len; --len) {
+		crc = _crc32_calc(crc, *ptr++);
+	}
+	return crc;
 }
 #endif  /** GT_ENABLED_CRC32 */
 
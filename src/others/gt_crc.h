@@ -38,6 +38,16 @@ extern "C" {
     #define GT_ENABLED_CRC16        01
 #endif
 
+#ifndef GT_CRC16_SLICE_BY
+    /**
+     * @brief The count of the bytes processed by each lookup round of
+     *      @ref gt_crc16_update_buf(), 1: classic byte table;
+     *      4 / 8: slice-by-4 / slice-by-8, RAM cost: 512 * N bytes.
+     *  [default: 4]
+     */
+    #define GT_CRC16_SLICE_BY       4
+#endif
+
 #ifndef GT_ENABLED_CRC32
     /**
      * @brief crc32 enable flag
@@ -128,6 +138,17 @@ uint16_t gt_crc16_mod_bus(const uint8_t * input_str, size_t num_bytes);
  * @return uint16_t
  */
 uint16_t gt_update_crc16(uint16_t crc, uint8_t c);
+
+/**
+ * @brief Calculates a new CRC-16 value based on the previous value of the CRC
+ *      and the next bytes of data, which can be used to calc the CRC of the
+ *      data stream piece by piece. @ref GT_CRC16_SLICE_BY
+ * @param crc The previous value of the CRC value, such as: GT_CRC16_START_MOD_BUS
+ * @param buf The next bytes of the data to be checked
+ * @param len The length of the bytes
+ * @return uint16_t
+ */
+uint16_t gt_crc16_update_buf(uint16_t crc, const uint8_t * buf, size_t len);
 #endif  /** GT_ENABLED_CRC16 */
 
 #if GT_ENABLED_CRC32
@@ -149,6 +170,17 @@ uint32_t gt_crc32(const uint8_t * input_str, size_t num_bytes);
  * @return uint32_t
  */
 uint32_t gt_update_crc32(uint32_t crc, uint8_t c);
+
+/**
+ * @brief Calculates a new CRC-32 value based on the previous value of the CRC
+ *      and the next bytes of data, which can be used to calc the CRC of the
+ *      data stream piece by piece. The final CRC value is: crc ^ 0xFFFFFFFF.
+ * @param crc The previous value of the CRC value, such as: GT_CRC_START_32
+ * @param buf The next bytes of the data to be checked
+ * @param len The length of the bytes
+ * @return uint32_t
+ */
+uint32_t gt_crc32_update_buf(uint32_t crc, const uint8_t * buf, size_t len);
 #endif  /** GT_ENABLED_CRC32 */
 
 
@@ -65,7 +65,6 @@ typedef struct _gt_gc_ascii_width_cache_s {
 #endif
 
 typedef struct gt_gc_s {
-    struct _gt_list_head _gt_anim_ll;
     struct _gt_list_head _gt_timer_ll;
     struct _gt_list_head _gt_img_decoder_ll;
     struct _gt_event_s * _gt_event_node_header_ll;
@@ -9,6 +9,7 @@
 
 /* include --------------------------------------------------------------*/
 #include "./gt_bin_convert.h"
+#include "../core/gt_mem.h"
 
 #if GT_USE_BIN_CONVERT
 
@@ -110,11 +111,41 @@ gt_bin_res_st gt_bin_convert_print(gt_bin_convert_st const * const bin, gt_bin_i
     return ret;
 }
 
+uint32_t gt_bin_convert_parse_records(void * tar, uint32_t tar_size,
+                                    uint8_t const * buffer, uint32_t rec_len, uint32_t count,
+                                    gt_bin_field_st const * fields, uint16_t field_count)
+{
+    uint8_t * dst = (uint8_t * )tar;
+    uint32_t n = 0, val = 0;
+    uint16_t i = 0;
+    uint8_t k = 0;
+
+    if (NULL == tar || NULL == buffer || NULL == fields) { return 0; }
+
+    for (n = 0; n < count; ++n, buffer += rec_len, dst += tar_size) {
+        for (i = 0; i < field_count; ++i) {
+            if (0 == fields[i].dst_size) {
+                gt_memcpy(dst + fields[i].dst, buffer + fields[i].src, fields[i].len);
+                continue;
+            }
+            for (val = 0, k = 0; k < fields[i].len; ++k) {
+                val = (val << 8) | buffer[fields[i].src + k];
+            }
+            switch (fields[i].dst_size) {
+                case 1: *(uint8_t * )(dst + fields[i].dst) = (uint8_t)val; break;
+                case 2: *(uint16_t * )(dst + fields[i].dst) = (uint16_t)val; break;
+                default: *(uint32_t * )(dst + fields[i].dst) = val; break;
+            }
+        }
+    }
+    return n;
+}
+
 /* ------------------- convert api ------------------- */
 
 uint64_t  gt_convert_parse_by_len(uint8_t const * const buffer, uint8_t len)
 {
-    uint32_t val = 0;
+    uint64_t val = 0;
     for (uint8_t i = 0; i < len; ++i) {
         val <<= 8;
         val |= buffer[i] & 0xff;
@@ -68,6 +68,16 @@ typedef struct gt_bin_res_s {
     uint16_t index;    /** The index of the current bin item get error or inv */
 }gt_bin_res_st;
 
+/**
+ * @brief The field of the fixed layout record, which is parsed without callback
+ */
+typedef struct gt_bin_field_s {
+    uint16_t src;       /** The byte offset of the field in the record */
+    uint16_t dst;       /** The byte offset of the member in the target, such as: offsetof() */
+    uint8_t len;        /** The byte length of the field in the record */
+    uint8_t dst_size;   /** The size of the member: 1/2/4: big-endian unsigned integer; 0: raw bytes copy */
+}gt_bin_field_st;
+
 /* macros ---------------------------------------------------------------*/
 
 
@@ -124,6 +134,28 @@ gt_bin_res_st gt_bin_convert_parse(gt_bin_convert_st const * const bin, gt_bin_i
  */
 gt_bin_res_st gt_bin_convert_print(gt_bin_convert_st const * const bin, gt_bin_item_st const * const list);
 
+/**
+ * @brief Parse the fixed layout records into the target array by the field table,
+ *      which is faster than the callback list when a lot of records are parsed.
+ *
+ * @param tar The target array
+ * @param tar_size The size of each target item, such as: sizeof(item)
+ * @param buffer The records data
+ * @param rec_len The byte length of each record
+ * @param count The count of the records
+ * @param fields such as:
+ *              gt_bin_field_st fields[] = {
+ *                  // { src_offset, offsetof(item, member), len, sizeof(member) },
+ *                  { 0, offsetof(item_st, id), 1, 1 },
+ *                  { 1, offsetof(item_st, addr), 4, 4 },
+ *              };
+ * @param field_count
+ * @return uint32_t The count of the records parsed
+ */
+uint32_t gt_bin_convert_parse_records(void * tar, uint32_t tar_size,
+                                    uint8_t const * buffer, uint32_t rec_len, uint32_t count,
+                                    gt_bin_field_st const * fields, uint16_t field_count);
+
 
 /* ------------------- convert api ------------------- */
 
@@ -15,7 +15,15 @@
 
 
 /* private define -------------------------------------------------------*/
-
+/** The max count of the elements, head and tail run within [0, 2 * max_count) */
+#define _QUEUE_MAX_COUNT    0x7FFF
+
+#if defined(__GNUC__) || defined(__clang__)
+    /** Make sure the elements are written / read before the index is published */
+    #define _QUEUE_BARRIER()    __sync_synchronize()
+#else
+    #define _QUEUE_BARRIER()
+#endif
 
 
 /* private typedef ------------------------------------------------------*/
@@ -35,36 +43,36 @@
 
 
 /* static functions -----------------------------------------------------*/
-static inline uint16_t _head_ptr_inc(gt_queue_st * queue) {
-    if (++queue->head >= queue->max_count) {
-        queue->head = 0;
+static inline uint16_t _idx_add(gt_queue_st const * const queue, uint16_t idx, uint16_t n) {
+    uint32_t ret = (uint32_t)idx + n;
+    uint32_t range = (uint32_t)queue->max_count << 1;
+    if (ret >= range) {
+        ret -= range;
     }
-    return queue->head;
+    return (uint16_t)ret;
 }
 
-static inline uint16_t _tail_ptr_inc(gt_queue_st * queue) {
-    if (++queue->tail >= queue->max_count) {
-        queue->tail = 0;
-    }
-    return queue->tail;
+/**
+ * @brief The element position within the buffer
+ */
+static inline uint16_t _idx_pos(gt_queue_st const * const queue, uint16_t idx) {
+    return idx >= queue->max_count ? idx - queue->max_count : idx;
 }
 
-static inline uint16_t _item_count_inc(gt_queue_st * queue) {
-    if (queue->el_count < queue->max_count) {
-        ++queue->el_count;
+static inline uint16_t _count_of(gt_queue_st const * const queue, uint16_t head, uint16_t tail) {
+    int32_t diff = (int32_t)head - tail;
+    if (diff < 0) {
+        diff += (int32_t)queue->max_count << 1;
     }
-    return queue->el_count;
+    return (uint16_t)diff;
 }
 
-static inline uint16_t _item_count_dec(gt_queue_st * queue) {
-    if (queue->el_count > 0) {
-        --queue->el_count;
-    }
-    return queue->el_count;
+static inline uint8_t * _elem_ptr(gt_queue_st const * const queue, uint16_t idx) {
+    return (uint8_t * )queue->buffer + _idx_pos(queue, idx) * queue->instance;
 }
 
 static gt_res_t _get_item_by(gt_queue_st const * const queue, uint16_t idx, void * res) {
-    uint8_t * ptr = (uint8_t * )queue->buffer + idx * queue->instance;
+    uint8_t * ptr = _elem_ptr(queue, idx);
     if (queue->instance > 1) {
         gt_memcpy(res, ptr, queue->instance);
     } else if (1 == queue->instance) {
@@ -75,28 +83,56 @@ static gt_res_t _get_item_by(gt_queue_st const * const queue, uint16_t idx, void
     return GT_RES_OK;
 }
 
-#if GT_QUEUE_USE_PRE_CHECK_VALID
-static inline uint16_t _get_tail_ptr_by(gt_queue_st const * const queue, uint16_t offset) {
-    uint16_t idx = queue->tail + offset;
-    while (idx >= queue->max_count) {
-        idx -= queue->max_count;
+/**
+ * @brief Copy the elements into / out of the buffer from idx,
+ *      split into two segments when crossing the end of buffer.
+ *
+ * @param to_queue true: copy data into the queue; false: copy out
+ */
+static void _copy_span(gt_queue_st const * const queue, uint16_t idx, void * data, uint16_t count, bool to_queue) {
+    uint16_t pos = _idx_pos(queue, idx);
+    uint16_t first = queue->max_count - pos;
+    uint8_t * ptr = (uint8_t * )queue->buffer + pos * queue->instance;
+
+    if (first > count) {
+        first = count;
+    }
+    if (to_queue) {
+        gt_memcpy(ptr, data, first * queue->instance);
+        gt_memcpy(queue->buffer, (uint8_t * )data + first * queue->instance, (count - first) * queue->instance);
+    } else {
+        gt_memcpy(data, ptr, first * queue->instance);
+        gt_memcpy((uint8_t * )data + first * queue->instance, queue->buffer, (count - first) * queue->instance);
     }
-    return idx;
 }
 
+#if GT_QUEUE_USE_PRE_CHECK_VALID
 static gt_res_t _get_value_cb(struct gt_queue_s const * const queue, uint16_t offset, void * res) {
     if (NULL == res) {
         return GT_RES_FAIL;
     }
-    if (offset >= queue->el_count) {
+    if (offset >= _count_of(queue, queue->head, queue->tail)) {
         return GT_RES_FAIL;
     }
-    uint16_t idx = _get_tail_ptr_by(queue, offset);
-    return _get_item_by(queue, idx, res);
+    return _get_item_by(queue, _idx_add(queue, queue->tail, offset), res);
 }
 
 static uint16_t _get_count_cb(struct gt_queue_s const * const queue) {
-    return queue->el_count;
+    return _count_of(queue, queue->head, queue->tail);
+}
+
+static void const * _get_span_cb(struct gt_queue_s const * const queue, uint16_t offset, uint16_t * count) {
+    uint16_t valid = _count_of(queue, queue->head, queue->tail);
+    uint16_t pos = 0;
+
+    *count = 0;
+    if (offset >= valid) {
+        return NULL;
+    }
+    pos = _idx_pos(queue, _idx_add(queue, queue->tail, offset));
+    valid -= offset;
+    *count = queue->max_count - pos < valid ? queue->max_count - pos : valid;
+    return (uint8_t * )queue->buffer + pos * queue->instance;
 }
 #endif
 
@@ -121,7 +157,8 @@ gt_queue_st * gt_queue_init(uint16_t instance, void * buffer, uint32_t byte_size
     queue->instance = instance;
     queue->buffer = buffer;
     queue->byte_size = byte_size;
-    queue->max_count = queue->byte_size / instance;
+    size = queue->byte_size / instance;
+    queue->max_count = size > _QUEUE_MAX_COUNT ? _QUEUE_MAX_COUNT : size;
     return queue;
 }
 
@@ -157,13 +194,7 @@ bool gt_queue_is_empty(gt_queue_st * queue)
     if (NULL == queue) {
         return true;
     }
-    if (queue->el_count) {
-        return false;
-    }
-    if (queue->head != queue->tail) {
-        return false;
-    }
-    return true;
+    return queue->head == queue->tail;
 }
 
 uint16_t gt_queue_get_count(gt_queue_st * queue)
@@ -174,7 +205,15 @@ uint16_t gt_queue_get_count(gt_queue_st * queue)
     if (0 == queue->instance) {
         return 0;
     }
-    return queue->el_count;
+    return _count_of(queue, queue->head, queue->tail);
+}
+
+uint16_t gt_queue_get_free(gt_queue_st * queue)
+{
+    if (NULL == queue) {
+        return 0;
+    }
+    return queue->max_count - _count_of(queue, queue->head, queue->tail);
 }
 
 gt_res_t gt_queue_clear(gt_queue_st * queue)
@@ -184,7 +223,6 @@ gt_res_t gt_queue_clear(gt_queue_st * queue)
     }
     queue->head = 0;
     queue->tail = 0;
-    queue->el_count = 0;
     return GT_RES_OK;
 }
 
@@ -196,23 +234,44 @@ gt_res_t gt_queue_push(gt_queue_st * queue, void * data)
     if (NULL == data) {
         return GT_RES_FAIL;
     }
+    if (0 == queue->instance) {
+        return GT_RES_FAIL;
+    }
 
-    uint8_t * ptr = (uint8_t * )queue->buffer + queue->head * queue->instance;
+    uint16_t head = queue->head;
+    uint8_t * ptr = _elem_ptr(queue, head);
+    if (_count_of(queue, head, queue->tail) == queue->max_count) {
+        /** drop the oldest item */
+        queue->tail = _idx_add(queue, queue->tail, 1);
+    }
     if (queue->instance > 1) {
         gt_memcpy(ptr, data, queue->instance);
-    } else if (1 == queue->instance) {
-        *ptr = (uint8_t)(*(uint8_t *)data);
     } else {
-        return GT_RES_FAIL;
+        *ptr = (uint8_t)(*(uint8_t *)data);
     }
+    _QUEUE_BARRIER();
+    queue->head = _idx_add(queue, head, 1);
+    return GT_RES_OK;
+}
 
-    if (queue->el_count && queue->head == queue->tail) {
-        /** drop the oldest item */
-        _tail_ptr_inc(queue);
+uint16_t gt_queue_push_n(gt_queue_st * queue, void const * data, uint16_t count)
+{
+    uint16_t head = 0, free_cnt = 0;
+    if (NULL == queue || NULL == data) {
+        return 0;
     }
-    _head_ptr_inc(queue);
-    _item_count_inc(queue);
-    return GT_RES_OK;
+    head = queue->head;
+    free_cnt = queue->max_count - _count_of(queue, head, queue->tail);
+    if (count > free_cnt) {
+        count = free_cnt;
+    }
+    if (0 == count) {
+        return 0;
+    }
+    _copy_span(queue, head, (void * )data, count, true);
+    _QUEUE_BARRIER();
+    queue->head = _idx_add(queue, head, count);
+    return count;
 }
 
 gt_res_t gt_queue_pop(gt_queue_st * queue, void * res)
@@ -224,19 +283,101 @@ gt_res_t gt_queue_pop(gt_queue_st * queue, void * res)
     if (NULL == queue) {
         return GT_RES_FAIL;
     }
-    if (queue->el_count < 1) {
+    uint16_t tail = queue->tail;
+    if (queue->head == tail) {
         return GT_RES_INV;
     }
-
-    gt_res_t ret = _get_item_by(queue, queue->tail, res);
+    _QUEUE_BARRIER();
+    gt_res_t ret = _get_item_by(queue, tail, res);
     if (GT_RES_OK != ret) {
         return ret;
     }
-    _tail_ptr_inc(queue);
-    _item_count_dec(queue);
+    _QUEUE_BARRIER();
+    queue->tail = _idx_add(queue, tail, 1);
     return GT_RES_OK;
 }
 
+uint16_t gt_queue_pop_n(gt_queue_st * queue, void * res, uint16_t count)
+{
+    uint16_t tail = 0, valid = 0;
+    if (NULL == queue) {
+        return 0;
+    }
+    tail = queue->tail;
+    valid = _count_of(queue, queue->head, tail);
+    if (count > valid) {
+        count = valid;
+    }
+    if (0 == count) {
+        return 0;
+    }
+    _QUEUE_BARRIER();
+    if (res) {
+        _copy_span(queue, tail, res, count, false);
+        _QUEUE_BARRIER();
+    }
+    queue->tail = _idx_add(queue, tail, count);
+    return count;
+}
+
+void * gt_queue_peek_contiguous(gt_queue_st * queue, uint16_t * count)
+{
+    uint16_t head = 0, pos = 0, free_cnt = 0;
+    GT_CHECK_BACK_VAL(count, NULL);
+    *count = 0;
+    if (NULL == queue) {
+        return NULL;
+    }
+    head = queue->head;
+    free_cnt = queue->max_count - _count_of(queue, head, queue->tail);
+    if (0 == free_cnt) {
+        return NULL;
+    }
+    pos = _idx_pos(queue, head);
+    *count = queue->max_count - pos < free_cnt ? queue->max_count - pos : free_cnt;
+    return (uint8_t * )queue->buffer + pos * queue->instance;
+}
+
+gt_res_t gt_queue_commit(gt_queue_st * queue, uint16_t count)
+{
+    uint16_t head = 0;
+    if (NULL == queue) {
+        return GT_RES_FAIL;
+    }
+    head = queue->head;
+    if (count > queue->max_count - _count_of(queue, head, queue->tail)) {
+        return GT_RES_FAIL;
+    }
+    _QUEUE_BARRIER();
+    queue->head = _idx_add(queue, head, count);
+    return GT_RES_OK;
+}
+
+void const * gt_queue_peek_data_contiguous(gt_queue_st * queue, uint16_t * count)
+{
+    return gt_queue_peek_data_at(queue, 0, count);
+}
+
+void const * gt_queue_peek_data_at(gt_queue_st * queue, uint16_t offset, uint16_t * count)
+{
+    uint16_t tail = 0, pos = 0, valid = 0;
+    GT_CHECK_BACK_VAL(count, NULL);
+    *count = 0;
+    if (NULL == queue) {
+        return NULL;
+    }
+    tail = queue->tail;
+    valid = _count_of(queue, queue->head, tail);
+    if (offset >= valid) {
+        return NULL;
+    }
+    _QUEUE_BARRIER();
+    pos = _idx_pos(queue, _idx_add(queue, tail, offset));
+    valid -= offset;
+    *count = queue->max_count - pos < valid ? queue->max_count - pos : valid;
+    return (uint8_t * )queue->buffer + pos * queue->instance;
+}
+
 #if GT_QUEUE_USE_PRE_CHECK_VALID
 gt_res_t gt_queue_set_check_valid_cb(gt_queue_st * queue, gt_queue_check_valid_cb_t check_valid_cb)
 {
@@ -263,16 +404,16 @@ gt_queue_check_valid_res_st gt_queue_pop_by_check_valid(gt_queue_st * queue, voi
     if (NULL == queue) {
         return ret;
     }
-    if (queue->el_count < 1) {
+    if (queue->head == queue->tail) {
         ret.res = GT_RES_INV;
         return ret;
     }
 
-    uint8_t * ptr = (uint8_t * )queue->buffer + queue->tail * queue->instance;
     gt_queue_check_valid_st check_valid = {
         .queue = queue,
         .get_count = _get_count_cb,
         .get_value = _get_value_cb,
+        .get_span = _get_span_cb,
     };
     while (GT_RES_FAIL == ret.res) {
         ret = queue->check_valid_cb(&check_valid);
@@ -284,23 +425,16 @@ gt_queue_check_valid_res_st gt_queue_pop_by_check_valid(gt_queue_st * queue, voi
         } else if (GT_RES_INV == ret.res) {
             return ret;
         }
-        ptr = (uint8_t * )queue->buffer + _tail_ptr_inc(queue) * queue->instance;
-        if (0 == _item_count_dec(queue)) {
+        /** skip the invalid element and check from the next one */
+        gt_queue_pop_n(queue, NULL, 1);
+        if (gt_queue_is_empty(queue)) {
             ret.res = GT_RES_FAIL;
             return ret;
         }
     }
 
-    uint8_t * res_ptr = (uint8_t * )res;
-    for (uint16_t i = 0; i < ret.valid_data_len; ++i) {
-        gt_res_t tmp_ret = _get_item_by(queue, queue->tail, res_ptr);
-        if (GT_RES_OK != tmp_ret) {
-            ret.res = GT_RES_FAIL;
-            return ret;
-        }
-        _tail_ptr_inc(queue);
-        _item_count_dec(queue);
-        res_ptr += queue->instance;
+    if (ret.valid_data_len != gt_queue_pop_n(queue, res, ret.valid_data_len)) {
+        ret.res = GT_RES_FAIL;
     }
     return ret;
 }
@@ -55,10 +55,22 @@ typedef gt_res_t ( * get_value_cb_t)(struct gt_queue_s const * const, uint16_t,
  */
 typedef uint16_t ( * get_count_cb_t)(struct gt_queue_s const * const);
 
+/**
+ * @brief Get the contiguous valid elements from the index / offset, the valid
+ *      data may be split into two spans by the end of the cycle buffer.
+ * @param queue The object of gt_queue_check_valid_cb_t callback function param
+ *          @ref gt_queue_check_valid_st -> queue
+ * @param index 0 <= index < get_count_cb_t()
+ * @param count [out] The count of the contiguous elements
+ * @return void const * The first element, NULL: index out of range
+ */
+typedef void const * ( * get_span_cb_t)(struct gt_queue_s const * const, uint16_t, uint16_t * );
+
 typedef struct gt_queue_check_valid_s {
     struct gt_queue_s const * const queue;
     get_count_cb_t get_count;
     get_value_cb_t get_value;
+    get_span_cb_t get_span;
 }gt_queue_check_valid_st;
 
 /**
@@ -85,15 +97,20 @@ typedef struct gt_queue_check_valid_res_s {
 typedef gt_queue_check_valid_res_st ( * gt_queue_check_valid_cb_t)(struct gt_queue_check_valid_s const * const);
 #endif
 
+/**
+ * @brief The cycle queue, head and tail run within [0, 2 * max_count),
+ *      so that full and empty can be distinguished without a shared counter.
+ *      Single producer (push) and single consumer (pop) can run concurrently,
+ *      such as: UART ISR push and task pop, without lock.
+ */
 typedef struct gt_queue_s {
-    uint16_t head;          /** index of push position offset */
-    uint16_t tail;          /** index of pop position offset */
-    uint16_t el_count;      /** element_count */
+    volatile uint16_t head; /** index of push position offset, only written by producer */
+    volatile uint16_t tail; /** index of pop position offset, only written by consumer */
     uint16_t instance;      /** element instance byte size */
 
     void * buffer;          /** queue cache buffer */
     uint32_t byte_size;     /** queue cache buffer byte length */
-    uint16_t max_count;     /** max count = byte_size / instance */
+    uint16_t max_count;     /** max count = byte_size / instance, max: 0x7FFF */
 
 #if GT_QUEUE_USE_PRE_CHECK_VALID
     /**
@@ -162,7 +179,16 @@ bool gt_queue_is_empty(gt_queue_st * queue);
 uint16_t gt_queue_get_count(gt_queue_st * queue);
 
 /**
- * @brief
+ * @brief Get the number of elements which can be pushed into the queue
+ *
+ * @param queue
+ * @return uint16_t
+ */
+uint16_t gt_queue_get_free(gt_queue_st * queue);
+
+/**
+ * @brief [Warn] Reset both of head and tail, the producer and consumer
+ *      must not be running at the same time.
  *
  * @param queue
  * @return gt_res_t
@@ -170,7 +196,8 @@ uint16_t gt_queue_get_count(gt_queue_st * queue);
 gt_res_t gt_queue_clear(gt_queue_st * queue);
 
 /**
- * @brief Push data into queue
+ * @brief Push data into queue, the oldest item is dropped when the queue is full,
+ *      [Warn] dropping moves the tail, which is not safe for concurrent consumer.
  *
  * @param queue
  * @param data The data want to push into queue, must be instance byte size as @ref gt_queue_init()
@@ -178,6 +205,71 @@ gt_res_t gt_queue_clear(gt_queue_st * queue);
  */
 gt_res_t gt_queue_push(gt_queue_st * queue, void * data);
 
+/**
+ * @brief Push multiple elements by at most two memory copies,
+ *      the elements which exceed the free space are not pushed.
+ *
+ * @param queue
+ * @param data The elements array
+ * @param count The count of the elements
+ * @return uint16_t The count of the elements pushed
+ */
+uint16_t gt_queue_push_n(gt_queue_st * queue, void const * data, uint16_t count);
+
+/**
+ * @brief Pop multiple elements by at most two memory copies
+ *
+ * @param queue
+ * @param res The buffer to store the elements, NULL: drop the elements
+ * @param count The count of the elements want to pop
+ * @return uint16_t The count of the elements popped
+ */
+uint16_t gt_queue_pop_n(gt_queue_st * queue, void * res, uint16_t count);
+
+/**
+ * @brief [Producer] Get the contiguous free space at push position, which can
+ *      be written directly, such as: UART DMA receive, then call
+ *      @ref gt_queue_commit() to publish the written elements.
+ *
+ * @param queue
+ * @param count [out] The count of the contiguous free elements
+ * @return void* The push position, NULL: queue is full
+ */
+void * gt_queue_peek_contiguous(gt_queue_st * queue, uint16_t * count);
+
+/**
+ * @brief [Producer] Publish the elements which have been written into the space
+ *      returned by @ref gt_queue_peek_contiguous()
+ *
+ * @param queue
+ * @param count The count of the elements written
+ * @return gt_res_t GT_RES_OK: success; GT_RES_FAIL: count is larger than the free space
+ */
+gt_res_t gt_queue_commit(gt_queue_st * queue, uint16_t count);
+
+/**
+ * @brief [Consumer] Get the contiguous valid elements at pop position, which
+ *      can be read directly, then call @ref gt_queue_pop_n() with NULL buffer
+ *      to release them.
+ *
+ * @param queue
+ * @param count [out] The count of the contiguous valid elements
+ * @return void const* The pop position, NULL: queue is empty
+ */
+void const * gt_queue_peek_data_contiguous(gt_queue_st * queue, uint16_t * count);
+
+/**
+ * @brief [Consumer] As @ref gt_queue_peek_data_contiguous(), but begin from
+ *      the offset of the pop position, such as: parse the data which is
+ *      still in the queue.
+ *
+ * @param queue
+ * @param offset The offset from the pop position
+ * @param count [out] The count of the contiguous valid elements
+ * @return void const* The element at offset, NULL: offset out of range
+ */
+void const * gt_queue_peek_data_at(gt_queue_st * queue, uint16_t offset, uint16_t * count);
+
 /**
  * @brief Pop data from queue
  *
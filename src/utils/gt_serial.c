@@ -5,7 +5,6 @@
  *      please check defined is enabled:
  *          @ref GT_USE_CRC
  *          @ref GT_ENABLED_CRC16
- *          @ref GT_QUEUE_USE_PRE_CHECK_VALID
  *          @ref GT_USE_SERIAL
  *      buffer size @ref GT_SERIAL_MASTER_CACHE_SIZE, @ref GT_SERIAL_CLIENT_CACHE_SIZE;
  *      unpack store buffer size @ref GT_SERIAL_UNPACK_CACHE_SIZE;
@@ -43,11 +42,15 @@
 #include "../core/gt_mem.h"
 #include "../others/gt_crc.h"
 #include "../core/gt_timer.h"
+#include "../hal/gt_hal_tick.h"
 
 
 /* private define -------------------------------------------------------*/
 #define _SERIAL_CRC16_BYTE_LEN   2
 
+/** The count of the receive tick stamps of the bytes pushed into client queue */
+#define _SERIAL_STAMP_COUNT      16
+
 
 
 /* private typedef ------------------------------------------------------*/
@@ -55,10 +58,40 @@ typedef struct _serial_reg_s {
     uint8_t crc16 : 1;
 }_serial_reg_st;
 
+typedef enum {
+    _SERIAL_DECODE_HEADER = 0,  /** matching the header bytes */
+    _SERIAL_DECODE_LENGTH,      /** waiting for the length bytes */
+    _SERIAL_DECODE_PAYLOAD,     /** updating crc16 by the payload bytes */
+    _SERIAL_DECODE_CRC,         /** waiting for the crc16 bytes */
+}_serial_decode_state_em;
+
+/**
+ * @brief The stream frame decoder, the bytes of the frame are kept within
+ *      the queue until the frame is complete, every byte is parsed once.
+ */
+typedef struct {
+    gt_serial_stat_st stat;
+    uint16_t scanned;       /** The count of the bytes of current frame which are parsed */
+    uint16_t frame_len;     /** The total length of current frame, include headers and crc16 */
+    uint16_t crc;
+    uint8_t state;          /** @ref _serial_decode_state_em */
+    uint8_t synced;         /** 0: lost the frame boundary, already counted into resyncs */
+}_serial_decoder_st;
+
 typedef struct {
+    _serial_decoder_st decoder;
     uint8_t width_byte_len;
 }_serial_custom_data_st;
 
+/**
+ * @brief The tick of the bytes received, the bytes before end which are
+ *      not covered by the previous stamp are received at tick.
+ */
+typedef struct {
+    uint32_t end;           /** The total count of bytes pushed into client queue */
+    uint32_t tick;
+}_serial_stamp_st;
+
 typedef struct gt_serial_s {
     gt_queue_st * master;   /** HMI as master */
     gt_queue_st * client;   /** HMI as client */
@@ -67,6 +100,15 @@ typedef struct gt_serial_s {
     uint8_t * const unpack_buffer;  /** cache to store unpack data */
     _gt_timer_st * timer_p;
     gt_serial_handler_cb_t handler_cb;
+#if GT_SERIAL_USE_EVENT_RECV
+    gt_serial_ready_cb_t ready_cb;
+    volatile uint8_t pending;       /** The isr notified that a frame boundary is possible */
+#endif
+    gt_serial_latency_st latency;
+    _serial_stamp_st stamps[_SERIAL_STAMP_COUNT];   /** The receive tick of the bytes in client queue */
+    uint32_t recv_total;            /** The total count of bytes pushed into client queue */
+    volatile uint8_t stamp_head;    /** The oldest stamp, updated by the task */
+    volatile uint8_t stamp_tail;    /** The next stamp, updated by the sender, such as isr */
 #endif
 
     _serial_reg_st reg;
@@ -107,6 +149,10 @@ static gt_serial_st _serial = {
     .timer_p = NULL,
     .unpack_buffer = _serial_unpack_cache,
     .handler_cb = NULL,
+#if GT_SERIAL_USE_EVENT_RECV
+    .ready_cb = NULL,
+    .pending = false,
+#endif
 #endif
     .reg = {
         .crc16 = false,
@@ -131,113 +177,199 @@ static inline uint16_t _serial_get_crc16_byte_length(void) {
 
 /* static functions -----------------------------------------------------*/
 /**
- * @brief Check package data is valid or not
- *
- * @param cv param
- * @return gt_queue_check_valid_res_st:
- * @returns gt_res_t        GT_RES_OK: success;
- *                          GT_RES_FAIL: failed;
- *                          GT_RES_INV: invalid, need to waiting for more data byte recv to pre-check
- *          valid_data_len  valid data byte length
+ * @brief Get the byte at offset of the pop position, the caller makes sure
+ *      the byte has been received.
  */
-static gt_queue_check_valid_res_st _serial_queue_check_valid_cb(gt_queue_check_valid_st const * const cv) {
-    gt_queue_check_valid_res_st ret = {
-        .res = GT_RES_FAIL,
-        .valid_data_len = 0,
-    };
-    _serial_custom_data_st * custom_data = (_serial_custom_data_st *)cv->queue->custom_data;
-	uint16_t count = cv->get_count(cv->queue);
-    uint16_t i = 0, idx = 0;
-	uint8_t data = 0;
-
-    /** check valid headers content */
-    for (i = 0; i < _serial.headers_len; ++i) {
-        cv->get_value(cv->queue, idx++, &data);
-        if (_serial.headers[i] != data) {
-            return ret;
-        }
-    }
-
-    /** check valid byte data has recv done */
-    for (i = 0; i < custom_data->width_byte_len; ++i) {
-        ret.valid_data_len <<= 8;
-        cv->get_value(cv->queue, idx++, &data);
-        ret.valid_data_len |= data;
-    }
-
-    ret.valid_data_len += _serial.headers_len + custom_data->width_byte_len;
-    if (count < ret.valid_data_len) {
-        /** Wait for the complete data */
-        ret.res = GT_RES_INV;
-        return ret;
-    }
-    /** check crc16 */
-#if GT_ENABLED_CRC16
-    if (_serial.reg.crc16) {
-        uint16_t checksum = GT_CRC16_START_MOD_BUS;
-        uint16_t target = 0;
-        uint16_t end = ret.valid_data_len - _serial_get_crc16_byte_length();
-
-        for (i = _serial.headers_len + custom_data->width_byte_len; i < end; ++i) {
-            cv->get_value(cv->queue, i, &data);
-            checksum = gt_update_crc16(checksum, data);
-        }
-        checksum = _serial_checksum_switch_byte(checksum);
-
-        for (i = end; i < ret.valid_data_len; ++i) {
-            target <<= 8;
-            cv->get_value(cv->queue, i, &data);
-            target |= data;
-        }
+static inline uint8_t _serial_peek_byte(gt_queue_st * queue, uint16_t offset) {
+    uint16_t span = 0;
+    return *(uint8_t const * )gt_queue_peek_data_at(queue, offset, &span);
+}
 
-        if (checksum != target) {
-            GT_LOGW(GT_LOG_TAG_SERIAL, "Failed crc16 calc: %x, target: %x", checksum, target);
-            return ret;
-        }
-    }
-#endif
-    ret.res = GT_RES_OK;
-    return ret;
+static void _serial_decoder_reset(_serial_decoder_st * dec) {
+    dec->state = _SERIAL_DECODE_HEADER;
+    dec->scanned = 0;
+    dec->frame_len = 0;
 }
 
-static gt_res_t _serial_common_send(gt_queue_st * queue, uint8_t const * const data, uint16_t len) {
-    if (NULL == data || 0 == len) {
-        return GT_RES_FAIL;
+/**
+ * @brief Drop the bytes which can not be the beginning of a frame
+ */
+static void _serial_decoder_drop(gt_queue_st * queue, _serial_decoder_st * dec, uint16_t len) {
+    len = gt_queue_pop_n(queue, NULL, len);
+    dec->stat.bytes += len;
+    dec->stat.dropped += len;
+    if (dec->synced) {
+        dec->synced = false;
+        ++dec->stat.resyncs;
     }
-    uint8_t * p = (uint8_t *)data;
-    gt_res_t ret = GT_RES_OK;
+    _serial_decoder_reset(dec);
+}
 
-    for (uint16_t i = 0; i < len; ++i) {
-        ret = gt_queue_push(queue, p++);
-        if (GT_RES_OK != ret) {
-            break;
+/**
+ * @brief Parse the received bytes from where stopped last time.
+ *
+ * @param queue
+ * @return uint16_t The length of the complete frame at the pop position, 0: not ready
+ */
+static uint16_t _serial_decode(gt_queue_st * queue) {
+    _serial_custom_data_st * custom_data = (_serial_custom_data_st *)queue->custom_data;
+    _serial_decoder_st * dec = &custom_data->decoder;
+    uint16_t count = 0, span = 0, end = 0, i = 0;
+    uint16_t crc_len = _serial_get_crc16_byte_length();
+    uint16_t offset = _serial.headers_len + custom_data->width_byte_len;
+    uint32_t value = 0;
+    uint8_t const * p = NULL;
+
+    while (true) {
+        count = gt_queue_get_count(queue);
+        switch (dec->state) {
+            case _SERIAL_DECODE_HEADER: {
+                if (dec->scanned >= count) {
+                    return 0;
+                }
+                if (_serial.headers[dec->scanned] != _serial_peek_byte(queue, dec->scanned)) {
+                    /** The header is short, restart matching from the next byte */
+                    _serial_decoder_drop(queue, dec, 1);
+                    break;
+                }
+                if (++dec->scanned == _serial.headers_len) {
+                    dec->state = _SERIAL_DECODE_LENGTH;
+                }
+                break;
+            }
+            case _SERIAL_DECODE_LENGTH: {
+                if (count < offset) {
+                    return 0;
+                }
+                for (value = 0, i = _serial.headers_len; i < offset; ++i) {
+                    value = (value << 8) | _serial_peek_byte(queue, i);
+                }
+                value += offset;
+                if (value < offset + crc_len || value > queue->max_count) {
+                    ++dec->stat.len_errors;
+                    _serial_decoder_drop(queue, dec, 1);
+                    break;
+                }
+                dec->frame_len = (uint16_t)value;
+                dec->scanned = offset;
+#if GT_ENABLED_CRC16
+                dec->crc = GT_CRC16_START_MOD_BUS;
+#endif
+                dec->state = _SERIAL_DECODE_PAYLOAD;
+                break;
+            }
+            case _SERIAL_DECODE_PAYLOAD: {
+                end = dec->frame_len - crc_len;
+                while (dec->scanned < end) {
+                    p = (uint8_t const * )gt_queue_peek_data_at(queue, dec->scanned, &span);
+                    if (NULL == p) {
+                        return 0;
+                    }
+                    if (span > end - dec->scanned) {
+                        span = end - dec->scanned;
+                    }
+#if GT_ENABLED_CRC16
+                    if (crc_len) {
+                        dec->crc = gt_crc16_update_buf(dec->crc, p, span);
+                    }
+#endif
+                    dec->scanned += span;
+                }
+                if (0 == crc_len) {
+                    _serial_decoder_reset(dec);
+                    dec->synced = true;
+                    return end;
+                }
+                dec->state = _SERIAL_DECODE_CRC;
+                break;
+            }
+            case _SERIAL_DECODE_CRC: {
+                if (count < dec->frame_len) {
+                    return 0;
+                }
+                for (value = 0, i = dec->scanned; i < dec->frame_len; ++i) {
+                    value = (value << 8) | _serial_peek_byte(queue, i);
+                }
+                if (_serial_checksum_switch_byte(dec->crc) != value) {
+                    GT_LOGW(GT_LOG_TAG_SERIAL, "Failed crc16 calc: %x, target: %x", _serial_checksum_switch_byte(dec->crc), value);
+                    ++dec->stat.crc_errors;
+                    /** The length may be corrupted, resync from the next byte of the header */
+                    _serial_decoder_drop(queue, dec, 1);
+                    break;
+                }
+                end = dec->frame_len;
+                _serial_decoder_reset(dec);
+                dec->synced = true;
+                return end;
+            }
+            default:
+                _serial_decoder_reset(dec);
+                break;
         }
     }
-    return ret;
+    return 0;
 }
 
 /**
- * @brief Unpack the valid data from the queue,
+ * @brief Pop the complete frame from the queue, only the valid data is kept
+ *      when GT_SERIAL_GET_ONLY_VALID_DATA is enabled,
  *      such as: [0x5A, 0xA5, 0x83, 0x00, 0x10, 0x04, 0x25, 0xA3],
  *      result:              [0x83, 0x00, 0x10, 0x04, 0x00]
  *
- * @param ret_p
+ * @param queue
  * @param res_buffer
- * @return uint16_t
+ * @return uint16_t The byte length of res_buffer, 0: no complete frame
  */
-static uint16_t _serial_common_unpack_valid_data(gt_queue_st * queue, gt_queue_check_valid_res_st * ret_p, uint8_t * res_buffer) {
+static uint16_t _serial_common_recv(gt_queue_st * queue, uint8_t * res_buffer) {
+    _serial_custom_data_st * custom_data = NULL;
+    uint16_t frame_len = 0, len = 0;
+
+    if (NULL == queue || NULL == res_buffer) {
+        return 0;
+    }
+    frame_len = _serial_decode(queue);
+    if (0 == frame_len) {
+        return 0;
+    }
+    custom_data = (_serial_custom_data_st *)queue->custom_data;
+    ++custom_data->decoder.stat.frames;
+    custom_data->decoder.stat.bytes += frame_len;
 #if GT_SERIAL_GET_ONLY_VALID_DATA
-    _serial_custom_data_st * custom_data = (_serial_custom_data_st *)queue->custom_data;
-    uint16_t i = 0;
     uint16_t offset = _serial.headers_len + custom_data->width_byte_len;
+    uint16_t crc_len = _serial_get_crc16_byte_length();
 
-    ret_p->valid_data_len -= offset + _serial_get_crc16_byte_length();
-    for (i = 0; i < ret_p->valid_data_len; ++i) {
-        res_buffer[i] = res_buffer[offset + i];
-    }
-    res_buffer[i] = 0;
+    gt_queue_pop_n(queue, NULL, offset);
+    len = gt_queue_pop_n(queue, res_buffer, frame_len - offset - crc_len);
+    gt_queue_pop_n(queue, NULL, crc_len);
+    res_buffer[len] = 0;
+#else
+    len = gt_queue_pop_n(queue, res_buffer, frame_len);
 #endif
-    return ret_p->valid_data_len;
+    return len;
+}
+
+static void _serial_common_get_stat(gt_queue_st * queue, gt_serial_stat_st * stat) {
+    GT_CHECK_BACK(stat);
+    if (NULL == queue || NULL == queue->custom_data) {
+        gt_memset_0(stat, sizeof(gt_serial_stat_st));
+        return;
+    }
+    *stat = ((_serial_custom_data_st *)queue->custom_data)->decoder.stat;
+}
+
+/**
+ * @brief Push the data into queue by span copy, all or nothing.
+ */
+static gt_res_t _serial_common_send(gt_queue_st * queue, uint8_t const * const data, uint16_t len) {
+    if (NULL == data || 0 == len) {
+        return GT_RES_FAIL;
+    }
+    if (gt_queue_get_free(queue) < len) {
+        GT_LOGW(GT_LOG_TAG_SERIAL, "Serial queue is full, free: %d, want: %d", gt_queue_get_free(queue), len);
+        return GT_RES_FAIL;
+    }
+    gt_queue_push_n(queue, data, len);
+    return GT_RES_OK;
 }
 
 #if GT_SERIAL_USE_AUTO_PACK
@@ -273,6 +405,13 @@ static gt_res_t _serial_common_send_pack(gt_queue_st * queue, uint8_t const * co
     _serial_custom_data_st * custom_data = (_serial_custom_data_st *)queue->custom_data;
     uint32_t checksum = 0;
     gt_res_t ret = GT_RES_OK;
+    uint32_t total = _serial.headers_len + custom_data->width_byte_len + len + _serial_get_crc16_byte_length();
+
+    /** The whole packet is pushed or nothing, a partial packet would break the frame */
+    if (gt_queue_get_free(queue) < total) {
+        GT_LOGW(GT_LOG_TAG_SERIAL, "Serial queue is full, free: %d, want: %d", gt_queue_get_free(queue), total);
+        return GT_RES_FAIL;
+    }
 
     /** push headers */
     ret = _serial_common_send(queue, _serial.headers, _serial.headers_len);
@@ -288,20 +427,14 @@ static gt_res_t _serial_common_send_pack(gt_queue_st * queue, uint8_t const * co
     }
 
     /** push data and calc checksum value */
-    uint8_t * p = (uint8_t *)data;
+    if (len) {
+        gt_queue_push_n(queue, data, len);
+    }
 #if GT_ENABLED_CRC16
     checksum = GT_CRC16_START_MOD_BUS;
-#endif
     for (uint16_t i = 0; i < len; ++i) {
-        ret = gt_queue_push(queue, p);
-        if (GT_RES_OK != ret) {
-            return ret;
-        }
-#if GT_ENABLED_CRC16
-        checksum = gt_update_crc16(checksum, *p++);
-#endif
+        checksum = gt_update_crc16(checksum, data[i]);
     }
-#if GT_ENABLED_CRC16
     checksum = _serial_checksum_switch_byte(checksum);
 #endif
 
@@ -312,23 +445,126 @@ static gt_res_t _serial_common_send_pack(gt_queue_st * queue, uint8_t const * co
 
 #if GT_SERIAL_USE_TIMER_RECV_UNPACK
 /**
- * @brief Get data from client queue
+ * @brief Upper limit (ms) of each latency bucket, the last bucket is unbounded
+ */
+static const uint16_t _serial_latency_limit[GT_SERIAL_LATENCY_BUCKET_COUNT - 1] = {
+    1, 2, 5, 10, 20, 50, 100,
+};
+
+static GT_ATTRIBUTE_RAM_TEXT void _serial_latency_record(uint32_t ms) {
+    gt_serial_latency_st * latency = &_serial.latency;
+    uint8_t i = 0;
+
+    for (; i < GT_SERIAL_LATENCY_BUCKET_COUNT - 1; i++) {
+        if (ms < _serial_latency_limit[i]) {
+            break;
+        }
+    }
+    ++latency->hist[i];
+    ++latency->count;
+    latency->total += ms;
+    if (ms > latency->max) {
+        latency->max = ms;
+    }
+}
+
+/**
+ * @brief Stamp the bytes pushed into client queue by the sender, such as isr.
+ *      The bytes are added to the latest stamp when the stamps are used up,
+ *      which measure them from the earlier tick.
  *
- * @param timer
+ * @param len The count of bytes pushed
  */
-static void _serial_client_recv_timer_handler_cb(struct _gt_timer_s * timer) {
-    uint16_t data_len = gt_serial_client_recv(_serial.unpack_buffer);
-    if (0 == data_len) {
+static void _serial_client_stamp(uint16_t len) {
+    uint8_t tail = _serial.stamp_tail;
+    uint8_t next = (tail + 1) % _SERIAL_STAMP_COUNT;
+    uint32_t tick = gt_tick_get();
+    uint8_t last = (tail + _SERIAL_STAMP_COUNT - 1) % _SERIAL_STAMP_COUNT;
+
+    _serial.recv_total += len;
+    if (tail != _serial.stamp_head && (next == _serial.stamp_head || tick == _serial.stamps[last].tick)) {
+        _serial.stamps[last].end = _serial.recv_total;
         return;
     }
-    /** Prepare to handle a full serial protocol */
-    if (NULL == _serial.handler_cb) {
-        return;
+    _serial.stamps[tail].end = _serial.recv_total;
+    _serial.stamps[tail].tick = tick;
+    _serial.stamp_tail = next;
+}
+
+/**
+ * @brief Get the receive tick of the byte, the stamps of the bytes before it
+ *      are released.
+ *
+ * @param index The index of the byte counted from the first byte pushed
+ * @param tick [out]
+ * @return true The byte has been stamped
+ */
+static bool _serial_client_stamp_get(uint32_t index, uint32_t * tick) {
+    uint8_t head = _serial.stamp_head;
+
+    while (head != _serial.stamp_tail) {
+        if ((int32_t)(_serial.stamps[head].end - index) > 0) {
+            *tick = _serial.stamps[head].tick;
+            _serial.stamp_head = head;
+            return true;
+        }
+        head = (head + 1) % _SERIAL_STAMP_COUNT;
     }
-    gt_res_t res = _serial.handler_cb(_serial.unpack_buffer, data_len);
-    if (GT_RES_FAIL == res) {
-        GT_LOGW(GT_LOG_TAG_SERIAL, "Serial handler_cb() handler failed!");
+    _serial.stamp_head = head;
+    return false;
+}
+
+/**
+ * @brief Dispatch all of the complete frames within client queue to handler_cb,
+ *      the latency of each frame is measured from its last byte pushed by
+ *      @ref gt_serial_client_send() to the handler_cb returned, which is the
+ *      time the widgets are updated.
+ *
+ * @return uint16_t The count of the frames dispatched
+ */
+static GT_ATTRIBUTE_RAM_TEXT uint16_t _serial_client_dispatch(void) {
+    _serial_decoder_st * dec = NULL;
+    uint16_t cnt = 0, data_len = 0;
+    uint32_t tick = 0;
+    bool stamped = false;
+    gt_res_t res = GT_RES_OK;
+
+    if (NULL == _serial.client) {
+        return 0;
+    }
+    dec = &((_serial_custom_data_st *)_serial.client->custom_data)->decoder;
+    while ((data_len = gt_serial_client_recv(_serial.unpack_buffer))) {
+        ++cnt;
+        /** The frame is complete since its last byte received */
+        stamped = _serial_client_stamp_get(dec->stat.bytes - 1, &tick);
+        /** Prepare to handle a full serial protocol */
+        if (_serial.handler_cb) {
+            res = _serial.handler_cb(_serial.unpack_buffer, data_len);
+            if (GT_RES_FAIL == res) {
+                GT_LOGW(GT_LOG_TAG_SERIAL, "Serial handler_cb() handler failed!");
+            }
+        }
+        if (stamped) {
+            _serial_latency_record(gt_tick_elapse(tick));
+        }
     }
+    return cnt;
+}
+
+/**
+ * @brief Get data from client queue, in event mode the timer runs on every
+ *      gt_task_handler() pass, but nothing is parsed until the isr notified.
+ *
+ * @param timer
+ */
+static void _serial_client_recv_timer_handler_cb(struct _gt_timer_s * timer) {
+#if GT_SERIAL_USE_EVENT_RECV
+    if (false == _serial.pending) {
+        return;
+    }
+    _serial.pending = false;
+#endif
+    _serial_client_dispatch();
 }
 #endif
 
@@ -336,6 +572,10 @@ static void _serial_client_recv_timer_handler_cb(struct _gt_timer_s * timer) {
 void gt_serial_init(void)
 {
     _serial_custom_data_st custom_data = {
+        .decoder = {
+            .state = _SERIAL_DECODE_HEADER,
+            .synced = true,
+        },
         .width_byte_len = GT_SERIAL_WIDTH_BYTE_LENGTH,
     };
     _serial.master = gt_queue_init(sizeof(uint8_t), _serial_master_cache, GT_SERIAL_MASTER_CACHE_SIZE);
@@ -345,12 +585,16 @@ void gt_serial_init(void)
     gt_queue_set_custom_data(_serial.master, &custom_data, sizeof(_serial_custom_data_st));
     gt_queue_set_custom_data(_serial.client, &custom_data, sizeof(_serial_custom_data_st));
 
-    gt_queue_set_check_valid_cb(_serial.master, _serial_queue_check_valid_cb);
-    gt_queue_set_check_valid_cb(_serial.client, _serial_queue_check_valid_cb);
-
 #if GT_SERIAL_USE_TIMER_RECV_UNPACK
+    _serial.recv_total = 0;
+    _serial.stamp_head = 0;
+    _serial.stamp_tail = 0;
     /** create timer to handler serial */
+#if GT_SERIAL_USE_EVENT_RECV
+    _serial.timer_p = _gt_timer_create(_serial_client_recv_timer_handler_cb, 0, &_serial);
+#else
     _serial.timer_p = _gt_timer_create(_serial_client_recv_timer_handler_cb, GT_TASK_PERIOD_TIME_SERIAL, &_serial);
+#endif
 #endif
 
     GT_LOG_A(GT_LOG_TAG_SERIAL, "Serial header byte len: %d, crc16: %s", _serial.headers_len, _serial.reg.crc16 ? "YES" : "NO");
@@ -380,11 +624,55 @@ void gt_serial_set_handler_cb(gt_serial_handler_cb_t cb)
 {
     _serial.handler_cb = cb;
 }
+
+uint16_t gt_serial_client_process(void)
+{
+#if GT_SERIAL_USE_EVENT_RECV
+    _serial.pending = false;
+#endif
+    return _serial_client_dispatch();
+}
+
+void gt_serial_get_latency(gt_serial_latency_st * latency)
+{
+    GT_CHECK_BACK(latency);
+    *latency = _serial.latency;
+}
+
+void gt_serial_reset_latency(void)
+{
+    gt_memset_0(&_serial.latency, sizeof(gt_serial_latency_st));
+}
+
+#if GT_SERIAL_USE_EVENT_RECV
+void gt_serial_set_ready_cb(gt_serial_ready_cb_t cb)
+{
+    _serial.ready_cb = cb;
+}
+
+void gt_serial_client_notify(void)
+{
+    _serial.pending = true;
+    if (_serial.ready_cb) {
+        _serial.ready_cb();
+    }
+}
+#endif
 #endif
 
 void gt_serial_set_crc16(bool enable)
 {
+    if (_serial.reg.crc16 == enable) {
+        return;
+    }
     _serial.reg.crc16 = enable;
+    /** The frame length is changed, parse the pending bytes again */
+    if (_serial.master) {
+        _serial_decoder_reset(&((_serial_custom_data_st *)_serial.master->custom_data)->decoder);
+    }
+    if (_serial.client) {
+        _serial_decoder_reset(&((_serial_custom_data_st *)_serial.client->custom_data)->decoder);
+    }
 }
 
 gt_res_t gt_serial_master_send(uint8_t const * const data, uint16_t len)
@@ -403,50 +691,59 @@ gt_res_t gt_serial_master_send_packet(uint8_t const * const data, uint16_t len)
 
 uint16_t gt_serial_master_recv(uint8_t * res_buffer)
 {
-	gt_queue_check_valid_res_st ret = gt_queue_pop_by_check_valid(_serial.master, res_buffer);
-    if (GT_RES_INV == ret.res) {
-        return 0;
-    } else if (GT_RES_FAIL == ret.res) {
-        GT_LOGV(GT_LOG_TAG_SERIAL, "Master queue pop failed!");
-        return 0;
-    }
-    return _serial_common_unpack_valid_data(_serial.master, &ret, res_buffer);
+    return _serial_common_recv(_serial.master, res_buffer);
 }
 
 uint16_t gt_serial_master_recv_raw(uint8_t * res_buffer)
 {
-    uint8_t * ptr = res_buffer;
-    uint16_t count = gt_queue_get_count(_serial.master);
-    for (uint16_t i = 0; i < count; ++i) {
-        gt_queue_pop(_serial.master, ptr++);
+    if (NULL == _serial.master) {
+        return 0;
     }
-    return count;
+    /** The bytes which are parsing are taken away, restart the decoder */
+    _serial_decoder_reset(&((_serial_custom_data_st *)_serial.master->custom_data)->decoder);
+    return gt_queue_pop_n(_serial.master, res_buffer, gt_queue_get_count(_serial.master));
 }
 
 gt_res_t gt_serial_client_send(uint8_t const * const data, uint16_t len)
 {
-    return _serial_common_send(_serial.client, data, len);
+    gt_res_t ret = _serial_common_send(_serial.client, data, len);
+#if GT_SERIAL_USE_TIMER_RECV_UNPACK
+    if (GT_RES_OK == ret) {
+        _serial_client_stamp(len);
+    }
+#endif
+    return ret;
 }
 
 gt_res_t gt_serial_client_send_packet(uint8_t const * const data, uint16_t len)
 {
 #if GT_SERIAL_USE_AUTO_PACK
-    return _serial_common_send_pack(_serial.client, data, len);
+    gt_res_t ret = _serial_common_send_pack(_serial.client, data, len);
+#if GT_SERIAL_USE_TIMER_RECV_UNPACK
+    if (GT_RES_OK == ret) {
+        _serial_client_stamp(_serial.headers_len + ((_serial_custom_data_st *)_serial.client->custom_data)->width_byte_len +
+                             len + _serial_get_crc16_byte_length());
+    }
+#endif
+    return ret;
 #else
-    return _serial_common_send(_serial.client, data, len);
+    return gt_serial_client_send(data, len);
 #endif
 }
 
 uint16_t gt_serial_client_recv(uint8_t * res_buffer)
 {
-	gt_queue_check_valid_res_st ret = gt_queue_pop_by_check_valid(_serial.client, res_buffer);
-    if (GT_RES_INV == ret.res) {
-        return 0;
-    } else if (GT_RES_FAIL == ret.res) {
-        GT_LOGV(GT_LOG_TAG_SERIAL, "Client queue pop failed!");
-        return 0;
-    }
-    return _serial_common_unpack_valid_data(_serial.client, &ret, res_buffer);
+    return _serial_common_recv(_serial.client, res_buffer);
+}
+
+void gt_serial_master_get_stat(gt_serial_stat_st * stat)
+{
+    _serial_common_get_stat(_serial.master, stat);
+}
+
+void gt_serial_client_get_stat(gt_serial_stat_st * stat)
+{
+    _serial_common_get_stat(_serial.client, stat);
 }
 
 gt_serial_pack_buffer_st gt_serial_get_temp_pack_buffer(void)
@@ -48,6 +48,11 @@ extern "C" {
 
 
 /* define ---------------------------------------------------------------*/
+/**
+ * @brief The count of the receive latency histogram buckets,
+ *      upper limit(ms): 1, 2, 5, 10, 20, 50, 100, [unbounded]
+ */
+#define GT_SERIAL_LATENCY_BUCKET_COUNT  8
 
 
 
@@ -65,6 +70,36 @@ typedef struct gt_serial_pack_buffer_s {
     uint32_t len;
 }gt_serial_pack_buffer_st;
 
+/**
+ * @brief The statistics of the frame decoder
+ */
+typedef struct gt_serial_stat_s {
+    uint32_t frames;        /** The count of the valid frames */
+    uint32_t bytes;         /** The count of the bytes consumed, include dropped */
+    uint32_t dropped;       /** The count of the bytes dropped */
+    uint32_t crc_errors;    /** The count of the frames which crc16 is wrong */
+    uint32_t len_errors;    /** The count of the frames which length is out of range */
+    uint32_t resyncs;       /** The count of the times which lost the frame boundary */
+}gt_serial_stat_st;
+
+/**
+ * @brief The client receive queue has bytes to parse, called within the
+ *      context of @ref gt_serial_client_notify(), such as isr, so that the
+ *      port can wake up the gt_task_handler() loop.
+ */
+typedef void ( * gt_serial_ready_cb_t)(void);
+
+/**
+ * @brief The latency from the last byte of the frame pushed into client
+ *      queue to the frame handler_cb returned.
+ */
+typedef struct gt_serial_latency_s {
+    uint32_t hist[GT_SERIAL_LATENCY_BUCKET_COUNT];  /** @ref GT_SERIAL_LATENCY_BUCKET_COUNT */
+    uint32_t count;     /** The count of the frames measured */
+    uint32_t total;     /** The sum of the latency [ms] */
+    uint32_t max;       /** The maximum latency [ms] */
+}gt_serial_latency_st;
+
 /* macros ---------------------------------------------------------------*/
 
 
@@ -94,6 +129,43 @@ void gt_serial_deinit(void);
  * @param cb The callback function
  */
 void gt_serial_set_handler_cb(gt_serial_handler_cb_t cb);
+
+/**
+ * @brief Parse the client queue and dispatch all of the complete frames
+ *      to handler_cb immediately, without waiting for the timer.
+ *
+ * @return uint16_t The count of the frames dispatched
+ */
+uint16_t gt_serial_client_process(void);
+
+/**
+ * @brief Get the receive latency histogram, measured from the last byte of
+ *      each frame pushed by @ref gt_serial_client_send() to the frame
+ *      handler_cb returned, include the time waiting in client queue.
+ *
+ * @param latency [out]
+ */
+void gt_serial_get_latency(gt_serial_latency_st * latency);
+
+void gt_serial_reset_latency(void);
+
+#if GT_SERIAL_USE_EVENT_RECV
+/**
+ * @brief Set the callback which is called when the port notified
+ *      that the client queue has bytes to parse.
+ *
+ * @param cb NULL: disabled
+ */
+void gt_serial_set_ready_cb(gt_serial_ready_cb_t cb);
+
+/**
+ * @brief [ISR] Notify that a frame boundary is possible, such as: uart idle
+ *      line interrupt or dma transfer complete, after the bytes pushed by
+ *      @ref gt_serial_client_send(). The frames are parsed on the next
+ *      gt_task_handler() pass, or by @ref gt_serial_client_process().
+ */
+void gt_serial_client_notify(void);
+#endif
 #endif
 
 /**
@@ -128,7 +200,7 @@ gt_res_t gt_serial_master_send_packet(uint8_t const * const data, uint16_t len);
 
 /**
  * @brief HMI as master, receive one byte data from other device,
- *      Get a complete packet of data, by @ref GT_QUEUE_USE_PRE_CHECK_VALID
+ *      Get a complete packet of data, the bytes are parsed once by the stream decoder
  *      [default: 0x5A, 0xA5, 0xWH, 0xWL, data0 ... dataN, crc16_1, crc16_2 ],
  *      when GT_SERIAL_GET_ONLY_VALID_DATA is set to 1, the data will be [data0 ... dataN]
  *
@@ -139,6 +211,13 @@ uint16_t gt_serial_master_recv(uint8_t * res_buffer);
 
 uint16_t gt_serial_master_recv_raw(uint8_t * res_buffer);
 
+/**
+ * @brief Get the frame decoder statistics of the master receive queue
+ *
+ * @param stat [out]
+ */
+void gt_serial_master_get_stat(gt_serial_stat_st * stat);
+
 /**
  * @brief HMI as client, ohter device send data to HMI
  *
@@ -163,7 +242,7 @@ gt_res_t gt_serial_client_send_packet(uint8_t const * const data, uint16_t len);
 
 /**
  * @brief HMI as client, receive one byte data from other device,
- *      Get a complete packet of data, by @ref GT_QUEUE_USE_PRE_CHECK_VALID
+ *      Get a complete packet of data, the bytes are parsed once by the stream decoder
  *      [default: 0x5A, 0xA5, 0xWH, 0xWL, data0 ... dataN, crc16_1, crc16_2 ],
  *      when GT_SERIAL_GET_ONLY_VALID_DATA is set to 1, the data will be [data0 ... dataN]
  *
@@ -172,6 +251,13 @@ gt_res_t gt_serial_client_send_packet(uint8_t const * const data, uint16_t len);
  */
 uint16_t gt_serial_client_recv(uint8_t * res_buffer);
 
+/**
+ * @brief Get the frame decoder statistics of the client receive queue
+ *
+ * @param stat [out]
+ */
+void gt_serial_client_get_stat(gt_serial_stat_st * stat);
+
 gt_serial_pack_buffer_st gt_serial_get_temp_pack_buffer(void);
 
 #endif  /** GT_USE_SERIAL */
@@ -47,42 +47,67 @@ static GT_ATTRIBUTE_RAM_TEXT bool _default_equal_cb(void * item, void * target)
     return target == item ? true : false;
 }
 
-static GT_ATTRIBUTE_RAM_TEXT inline void _free_item_obj(_gt_vector_st * vector, _gt_vector_item_st * item_p) {
-    void * val = item_p->val;
-
-    _gt_list_del(&item_p->node);
-    /** free vector list item */
-    gt_mem_free(item_p);
-
+static GT_ATTRIBUTE_RAM_TEXT inline void _free_item_obj(_gt_vector_st * vector, void * val) {
     if (NULL == vector->free_item_cb) {
         return;
     }
     vector->free_item_cb(val);
 }
 
+/**
+ * @brief Make sure the items array can store the count of items,
+ *      the capacity grows by 1.5 times to keep appending amortized O(1).
+ */
+static bool _grow_capacity(_gt_vector_st * vector, int32_t need) {
+    int32_t capacity = vector->capacity;
+    void ** items = NULL;
+
+    if (need <= capacity) {
+        return true;
+    }
+    if (need > 0x7FFF) {
+        return false;
+    }
+    if (capacity < GT_VECTOR_MIN_CAPACITY) {
+        capacity = GT_VECTOR_MIN_CAPACITY;
+    }
+    while (capacity < need) {
+        capacity += (capacity >> 1);
+    }
+    if (capacity > 0x7FFF) {
+        capacity = 0x7FFF;
+    }
+    items = (void ** )gt_mem_realloc(vector->items, capacity * sizeof(void * ));
+    if (NULL == items) {
+        return false;
+    }
+    vector->items = items;
+    vector->capacity = (gt_size_t)capacity;
+    return true;
+}
+
+static inline void _fix_index(_gt_vector_st * vector) {
+    if (vector->index + 1 > vector->count) {
+        vector->index = vector->count - 1;
+    }
+}
+
 static GT_ATTRIBUTE_RAM_TEXT bool _gt_vector_iterator_has_next(_iter_dsc_st * vct_dsc) {
     GT_CHECK_BACK_VAL(vct_dsc, false);
-    GT_CHECK_BACK_VAL(vct_dsc->iter_ctl, false);
-    return vct_dsc->iter_ctl->idx < vct_dsc->count ? true : false;
+    return vct_dsc->iter_ctl.idx < vct_dsc->count ? true : false;
 }
 
 static GT_ATTRIBUTE_RAM_TEXT void * _gt_vector_iterator_next(_iter_dsc_st * vct_dsc) {
-    GT_CHECK_BACK_VAL(vct_dsc, false);
-    GT_CHECK_BACK_VAL(vct_dsc->iter_ctl, false);
-
-    if (vct_dsc->iter_ctl->item_p) {
-        vct_dsc->iter_ctl->item_p = (_gt_vector_item_st * )_gt_list_next_entry(vct_dsc->iter_ctl->item_p, _gt_vector_item_st, node);
-    } else {
-        vct_dsc->iter_ctl->item_p = (_gt_vector_item_st * )_gt_list_first_entry(&vct_dsc->list_head, _gt_vector_item_st, node);
+    GT_CHECK_BACK_VAL(vct_dsc, NULL);
+    if (vct_dsc->iter_ctl.idx >= vct_dsc->count) {
+        return NULL;
     }
-    ++vct_dsc->iter_ctl->idx;
-    return vct_dsc->iter_ctl->item_p->val;
+    return vct_dsc->items[vct_dsc->iter_ctl.idx++];
 }
 
 static GT_ATTRIBUTE_RAM_TEXT gt_size_t _gt_vector_iterator_index(_iter_dsc_st * vct_dsc) {
     GT_CHECK_BACK_VAL(vct_dsc, -1);
-    GT_CHECK_BACK_VAL(vct_dsc->iter_ctl, -1);
-    return vct_dsc->iter_ctl->idx;
+    return vct_dsc->iter_ctl.idx;
 }
 
 /* global functions / API interface -------------------------------------*/
@@ -93,7 +118,6 @@ _gt_vector_st * _gt_vector_create(_gt_vector_free_item_cb_t free_cb, _gt_vector_
     GT_CHECK_BACK_VAL(vector, NULL);
 
     gt_memset(vector, 0, sizeof(_gt_vector_st));
-    _GT_INIT_LIST_HEAD(&vector->list_head);
     _gt_vector_add_free_item_cb(vector, free_cb);
     _gt_vector_add_equal_item_cb(vector, equal_item_cb ? equal_item_cb : _default_equal_cb);
     return vector;
@@ -121,18 +145,61 @@ bool _gt_vector_add_item(_gt_vector_st * vector_p, void * item)
 {
     GT_CHECK_BACK_VAL(vector_p, false);
     GT_CHECK_BACK_VAL(item, false);
-    _gt_vector_item_st * new_item = (_gt_vector_item_st * )gt_mem_malloc(sizeof(_gt_vector_item_st));
-    if (NULL == new_item) {
-        GT_CHECK_PRINT(new_item);
+    if (false == _grow_capacity(vector_p, vector_p->count + 1)) {
+        GT_LOGW(GT_LOG_TAG_MEM, "vector grow failed, count: %d", vector_p->count);
+        return false;
+    }
+    vector_p->items[vector_p->count++] = item;
+    return true;
+}
+
+bool _gt_vector_insert_items(_gt_vector_st * vector_p, gt_size_t index, void * const * items, gt_size_t count)
+{
+    GT_CHECK_BACK_VAL(vector_p, false);
+    GT_CHECK_BACK_VAL(items, false);
+    if (-1 == index) {
+        index = vector_p->count;
+    }
+    if (index < 0 || index > vector_p->count || count < 0) {
         return false;
     }
-    _GT_INIT_LIST_HEAD(&new_item->node);
-    new_item->val = item;
-    _gt_list_add_tail(&new_item->node, &vector_p->list_head);
-    ++vector_p->count;
+    if (0 == count) {
+        return true;
+    }
+    if (false == _grow_capacity(vector_p, (int32_t)vector_p->count + count)) {
+        GT_LOGW(GT_LOG_TAG_MEM, "vector grow failed, count: %d + %d", vector_p->count, count);
+        return false;
+    }
+    gt_memmove(&vector_p->items[index + count], &vector_p->items[index], (vector_p->count - index) * sizeof(void * ));
+    gt_memcpy(&vector_p->items[index], items, count * sizeof(void * ));
+    vector_p->count += count;
     return true;
 }
 
+gt_size_t _gt_vector_remove_range(_gt_vector_st * vector_p, gt_size_t index, gt_size_t count)
+{
+    GT_CHECK_BACK_VAL(vector_p, 0);
+    if (index < 0 || index >= vector_p->count || count <= 0) {
+        return 0;
+    }
+    if (count > vector_p->count - index) {
+        count = vector_p->count - index;
+    }
+    for (gt_size_t i = 0; i < count; ++i) {
+        _free_item_obj(vector_p, vector_p->items[index + i]);
+    }
+    gt_memmove(&vector_p->items[index], &vector_p->items[index + count], (vector_p->count - index - count) * sizeof(void * ));
+    vector_p->count -= count;
+    _fix_index(vector_p);
+    return count;
+}
+
+bool _gt_vector_reserve(_gt_vector_st * vector_p, gt_size_t capacity)
+{
+    GT_CHECK_BACK_VAL(vector_p, false);
+    return _grow_capacity(vector_p, capacity);
+}
+
 bool _gt_vector_replace_item(_gt_vector_st * vector_p, uint16_t index, void * item)
 {
     GT_CHECK_BACK_VAL(vector_p, false);
@@ -140,17 +207,11 @@ bool _gt_vector_replace_item(_gt_vector_st * vector_p, uint16_t index, void * it
     if (index >= vector_p->count) {
         return false;
     }
-    _gt_vector_item_st * item_p = NULL;
-    _gt_list_for_each_entry(item_p, &vector_p->list_head, _gt_vector_item_st, node) {
-        if (index-- == 0) {
-            if (vector_p->free_item_cb) {
-                vector_p->free_item_cb(item_p->val);
-            }
-            item_p->val = item;
-            return true;
-        }
+    if (vector_p->free_item_cb) {
+        vector_p->free_item_cb(vector_p->items[index]);
     }
-    return false;
+    vector_p->items[index] = item;
+    return true;
 }
 
 bool _gt_vector_remove_item(_gt_vector_st * vector_p, void * target)
@@ -158,46 +219,33 @@ bool _gt_vector_remove_item(_gt_vector_st * vector_p, void * target)
     GT_CHECK_BACK_VAL(vector_p, false);
     GT_CHECK_BACK_VAL(target, false);
 
-    uint16_t i = 0, count = vector_p->count;
+    gt_size_t i = 0, keep = 0, count = vector_p->count;
     uint8_t is_find = false;
     GT_CHECK_BACK_VAL(count, false);
     GT_CHECK_BACK_VAL(vector_p->equal_item_cb, false);
 
-    _gt_vector_item_st * item_p = NULL;
-    _gt_vector_item_st * backup_p = NULL;
-    _gt_list_for_each_entry_safe(item_p, backup_p, &vector_p->list_head, _gt_vector_item_st, node) {
-        if (false == vector_p->equal_item_cb(item_p->val, target)) {
+    /** Remove all of the same items and compact the array in one pass */
+    for (i = 0; i < count; ++i) {
+        if (false == vector_p->equal_item_cb(vector_p->items[i], target)) {
+            vector_p->items[keep++] = vector_p->items[i];
             continue;
         }
-        _free_item_obj(vector_p, item_p);
-        --vector_p->count;
+        _free_item_obj(vector_p, vector_p->items[i]);
         is_find = true;
     }
-    if (vector_p->index + 1 > vector_p->count) {
-        vector_p->index = vector_p->count - 1;
-    }
+    vector_p->count = keep;
+    _fix_index(vector_p);
     return is_find;
 }
 
 bool _gt_vector_remove_latest_item(_gt_vector_st * vector_p)
 {
     GT_CHECK_BACK_VAL(vector_p, false);
-    uint16_t i = 0, count = vector_p->count;
-    uint8_t is_find = false;
-    GT_CHECK_BACK_VAL(count, false);
+    GT_CHECK_BACK_VAL(vector_p->count, false);
 
-    _gt_vector_item_st * item_p = NULL;
-    _gt_vector_item_st * backup_p = NULL;
-    _gt_list_for_each_entry_safe_reverse(item_p, backup_p, &vector_p->list_head, _gt_vector_item_st, node) {
-        _free_item_obj(vector_p, item_p);
-        --vector_p->count;
-        is_find = true;
-        break;
-    }
-    if (vector_p->index + 1 > vector_p->count) {
-        vector_p->index = vector_p->count - 1;
-    }
-    return is_find;
+    _free_item_obj(vector_p, vector_p->items[--vector_p->count]);
+    _fix_index(vector_p);
+    return true;
 }
 
 void * _gt_vector_turn_prev(_gt_vector_st * vector)
@@ -210,14 +258,7 @@ void * _gt_vector_turn_prev(_gt_vector_st * vector)
     if (--vector->index < 0) {
         vector->index = vector->count - 1;
     }
-    _gt_vector_item_st * item_p = NULL;
-    uint16_t i = 0;
-    _gt_list_for_each_entry(item_p, &vector->list_head, _gt_vector_item_st, node) {
-        if (i++ == vector->index) {
-            return item_p->val;
-        }
-    }
-    return NULL;
+    return vector->items[vector->index];
 }
 
 void * _gt_vector_turn_next(_gt_vector_st * vector)
@@ -227,14 +268,7 @@ void * _gt_vector_turn_next(_gt_vector_st * vector)
     if (++vector->index >= vector->count) {
         vector->index = 0;
     }
-    _gt_vector_item_st * item_p = NULL;
-    uint16_t i = 0;
-    _gt_list_for_each_entry(item_p, &vector->list_head, _gt_vector_item_st, node) {
-        if (i++ == vector->index) {
-            return item_p->val;
-        }
-    }
-    return NULL;
+    return vector->items[vector->index];
 }
 
 gt_size_t _gt_vector_get_count(_gt_vector_st const * vector)
@@ -274,21 +308,16 @@ gt_size_t _gt_vector_get_index(_gt_vector_st const * vector)
 void * _gt_vector_get_item(_gt_vector_st const * vector, gt_size_t index)
 {
     GT_CHECK_BACK_VAL(vector, NULL);
-    GT_CHECK_BACK_VAL(vector->count, NULL);
-    if (index < 0) {
+    if (index < 0 || index >= vector->count) {
         return NULL;
     }
-    if (index >= vector->count) {
-        return NULL;
-    }
-    _gt_vector_item_st * item_p = NULL;
-    uint16_t i = 0;
-    _gt_list_for_each_entry(item_p, &vector->list_head, _gt_vector_item_st, node) {
-        if (i++ == index) {
-            return item_p->val;
-        }
-    }
-    return NULL;
+    return vector->items[index];
+}
+
+void * const * _gt_vector_get_items(_gt_vector_st const * vector)
+{
+    GT_CHECK_BACK_VAL(vector, NULL);
+    return vector->count ? vector->items : NULL;
 }
 
 bool _gt_vector_is_tail_index_now(_gt_vector_st const * vector)
@@ -302,7 +331,10 @@ bool _gt_vector_free(_gt_vector_st * vector_p)
     GT_CHECK_BACK_VAL(vector_p, false);
 
     _gt_vector_clear_all_items(vector_p);
-
+    if (vector_p->items) {
+        gt_mem_free(vector_p->items);
+        vector_p->items = NULL;
+    }
     gt_mem_free(vector_p);
     return true;
 }
@@ -314,13 +346,8 @@ _gt_vector_iterator_st _gt_vector_get_iterator(_gt_vector_st * vector)
         .next = _gt_vector_iterator_next,
         .index = _gt_vector_iterator_index,
     };
-    uint16_t instance = sizeof(_gt_iterator_ctl_st);
     GT_CHECK_BACK_VAL(vector, ret_iter);
-    if (NULL == vector->iter_ctl) {
-        vector->iter_ctl = (_gt_iterator_ctl_st * )gt_mem_malloc(instance);
-        GT_CHECK_BACK_VAL(vector->iter_ctl, ret_iter);
-    }
-    gt_memset(vector->iter_ctl, 0, instance);
+    vector->iter_ctl.idx = 0;
     ret_iter.dsc_t = vector;
     return ret_iter;
 }
@@ -329,18 +356,12 @@ bool _gt_vector_clear_all_items(_gt_vector_st * vector)
 {
     GT_CHECK_BACK_VAL(vector, false);
 
-    if (vector->iter_ctl) {
-        gt_mem_free(vector->iter_ctl);
-        vector->iter_ctl = NULL;
-    }
-
-    _gt_vector_item_st * item_p = NULL;
-    _gt_vector_item_st * backup_p = NULL;
-   _gt_list_for_each_entry_safe_reverse(item_p, backup_p, &vector->list_head, _gt_vector_item_st, node) {
-        _free_item_obj(vector, item_p);
+    vector->iter_ctl.idx = 0;
+    /** free in reverse order, as the same as before */
+    while (vector->count) {
+        _free_item_obj(vector, vector->items[--vector->count]);
     }
     vector->index = 0;
-    vector->count = 0;
     return true;
 }
 
@@ -15,10 +15,13 @@ extern "C" {
 
 /* include --------------------------------------------------------------*/
 #include "../others/gt_types.h"
-#include "../others/gt_list.h"
 
 
 /* define ---------------------------------------------------------------*/
+#ifndef GT_VECTOR_MIN_CAPACITY
+    /* The capacity of the items array when the first item is added */
+    #define GT_VECTOR_MIN_CAPACITY      (4)
+#endif
 
 
 
@@ -60,11 +63,6 @@ typedef void * ( * next_cb)(_iter_dsc_st * vct_dsc);
  */
 typedef gt_size_t ( * index_cb)(_iter_dsc_st * vct_dsc);
 
-typedef struct {
-    struct _gt_list_head node;
-    void * val;
-}_gt_vector_item_st;
-
 typedef struct _gt_vector_iterator_s {
     has_next_cb has_next;
     next_cb next;
@@ -72,21 +70,25 @@ typedef struct _gt_vector_iterator_s {
     _iter_dsc_st * dsc_t;
 }_gt_vector_iterator_st;
 
+/**
+ * @brief The iterator only keeps the index of the next item, so it is
+ *      still valid after the items array is reallocated.
+ */
 typedef struct _gt_iterator_ctl_s {
-    _gt_vector_item_st * item_p;
     gt_size_t idx;
 }_gt_iterator_ctl_st;
 
 typedef struct _gt_vector_s {
-    struct _gt_list_head list_head;
+    void ** items;          /** The contiguous array of the items, grows geometrically */
 
     _gt_vector_free_item_cb_t free_item_cb;
     _gt_vector_equal_item_cb_t equal_item_cb;
 
     gt_size_t count;
+    gt_size_t capacity;     /** The count of the items which can be stored without reallocated */
     gt_size_t index;
 
-    _gt_iterator_ctl_st * iter_ctl;
+    _gt_iterator_ctl_st iter_ctl;
 }_gt_vector_st;
 
 
@@ -139,6 +141,41 @@ bool _gt_vector_add_equal_item_cb(_gt_vector_st * vector_p, _gt_vector_equal_ite
  */
 bool _gt_vector_add_item(_gt_vector_st * vector_p, void * item);
 
+/**
+ * @brief Insert the items into vector before the index, the items after it
+ *      are moved backward.
+ *
+ * @param vector_p
+ * @param index The position to be inserted, -1 or count: append to the tail
+ * @param items The items array, each item must be malloced, free by free_cb()
+ * @param count The count of the items
+ * @return true
+ * @return false index is invalid or memory is not enough, nothing is inserted
+ */
+bool _gt_vector_insert_items(_gt_vector_st * vector_p, gt_size_t index, void * const * items, gt_size_t count);
+
+/**
+ * @brief Remove the items in range [index, index + count) from vector,
+ *      each item is freed by free_cb()
+ *
+ * @param vector_p
+ * @param index The first item index to be removed
+ * @param count The count of the items, it is limited to the tail
+ * @return gt_size_t The count of the items removed
+ */
+gt_size_t _gt_vector_remove_range(_gt_vector_st * vector_p, gt_size_t index, gt_size_t count);
+
+/**
+ * @brief Reserve the capacity of the items array, to avoid reallocating
+ *      many times when a lot of items will be added.
+ *
+ * @param vector_p
+ * @param capacity
+ * @return true
+ * @return false memory is not enough
+ */
+bool _gt_vector_reserve(_gt_vector_st * vector_p, gt_size_t capacity);
+
 /**
  * @brief Replace a item in vector
  *
@@ -219,6 +256,15 @@ gt_size_t _gt_vector_get_index(_gt_vector_st const * vector);
  */
 void * _gt_vector_get_item(_gt_vector_st const * vector, gt_size_t index);
 
+/**
+ * @brief Get the items array of vector, which is valid until the vector
+ *      is modified.
+ *
+ * @param vector
+ * @return void* const* NULL: empty vector
+ */
+void * const * _gt_vector_get_items(_gt_vector_st const * vector);
+
 /**
  * @brief Is the current index is the tail one
  *
@@ -20,6 +20,7 @@
 #include "../others/gt_assert.h"
 #include "../core/gt_disp.h"
 #include "../core/gt_draw.h"
+#include "../hal/gt_hal_tick.h"
 
 
 /* private define -------------------------------------------------------*/
@@ -34,6 +35,10 @@
 typedef struct _gt_barcode_s {
     gt_obj_st obj;
     barcode_st info;
+    uint8_t * bars;         /** The dark bars bitset, row by row, MSB first; NULL: need to encode */
+    uint16_t bars_w;        /** The count of bits per row */
+    uint16_t bars_rows;     /** The count of rows, 1: all of the rows are the same */
+    gt_barcode_stat_st stat;
 }_gt_barcode_st;
 
 
@@ -59,18 +64,40 @@ const gt_obj_class_st gt_barcode_class = {
 
 
 /* static functions -----------------------------------------------------*/
-static inline void _gt_barcode_init_widget(gt_obj_st * barcode) {
+static inline uint16_t _get_row_bytes(uint16_t width) {
+    return (width + 7) >> 3;
+}
+
+static void _free_bars(_gt_barcode_st * widget) {
+    if (NULL == widget->bars) {
+        return;
+    }
+    gt_mem_free(widget->bars);
+    widget->bars = NULL;
+    widget->bars_w = 0;
+    widget->bars_rows = 0;
+}
+
+/**
+ * @brief Encode the code text into the bars bitset, only once until
+ *      the content or the module width is changed.
+ *
+ * @param barcode
+ * @return gt_res_t
+ */
+static gt_res_t _encode_bars(gt_obj_st * barcode) {
     _gt_barcode_st * widget = (_gt_barcode_st * )barcode;
     barcode_st * style = (barcode_st * )&widget->info;
     bar_uint32_t buf_size = 0;
-    gt_area_st area;
-    gt_size_t h = 0;
-
-    h = style->mode_h;
+    uint16_t rows = 0, row_bytes = 0;
+    gt_size_t h = style->mode_h;
+    gt_res_t ret = GT_RES_FAIL;
 
+    if (widget->bars) {
+        return GT_RES_OK;
+    }
 #if (!BARCODE_READ_MODE)
-    gt_size_t i = 0;
-    if(h < BARCODE_LINE_NUMB) { h = BARCODE_LINE_NUMB; }
+    /** all of the rows are the same, only one row is required */
     style->mode_h = 1;
 #endif
     // 获取长宽
@@ -80,16 +107,14 @@ static inline void _gt_barcode_init_widget(gt_obj_st * barcode) {
             goto RET_FREE ;
         }
     }
-    //
-    area.w = style->ret_param.dot_w;
-    area.h = style->ret_param.dot_h;
-    area.x = barcode->area.x;
-    area.y = barcode->area.y;
-    //
+    row_bytes = _get_row_bytes(style->ret_param.dot_w);
 #if (BARCODE_READ_MODE)
-    buf_size = (area.w * area.h) >> 3;
+    rows = style->ret_param.dot_h;
+    /** The rows are byte aligned */
+    buf_size = row_bytes * rows;
 #else
-    buf_size = (area.w * (area.h > BARCODE_LINE_NUMB ? area.h : BARCODE_LINE_NUMB)) >> 3;
+    rows = 1;
+    buf_size = (style->ret_param.dot_w * (style->ret_param.dot_h > BARCODE_LINE_NUMB ? style->ret_param.dot_h : BARCODE_LINE_NUMB)) >> 3;
 #endif
     style->pdat = gt_mem_malloc(buf_size);
     if (NULL == style->pdat) {
@@ -98,15 +123,86 @@ static inline void _gt_barcode_init_widget(gt_obj_st * barcode) {
     }
     gt_memset(style->pdat, 0, buf_size);
     style->pdat_size = buf_size;
-    // GT_LOGD(GT_LOG_TAG_GUI , "area dot_w = %d , dot_h = %d , buf_size = %d" , area.w , area.h , style->pdat_size);
 
     // 获取数据
     if (!gt_barcode_get(style)) {
         GT_LOGE(GT_LOG_TAG_GUI , "get barcode type = %d ,dot_w = %d , dot_h = %d" , style->type , style->ret_param.dot_w , style->ret_param.dot_h);
         goto RET_FREE ;
     }
+    ++widget->stat.encode_count;
+
+    widget->bars = gt_mem_malloc(row_bytes * rows);
+    if (NULL == widget->bars) {
+        goto RET_FREE ;
+    }
+    gt_memcpy(widget->bars, style->pdat, row_bytes * rows);
+    widget->bars_w = style->ret_param.dot_w;
+    widget->bars_rows = rows;
+    ret = GT_RES_OK;
+
+RET_FREE:
     // 重新写入
     style->mode_h = h;
+    if (NULL != style->pdat) {
+        gt_mem_free(style->pdat);
+        style->pdat = NULL;
+    }
+    style->pdat_size = 0;
+    return ret;
+}
+
+/**
+ * @brief Fill the continuous dark bits of each row as one rectangle,
+ *      a single-row bitset is stretched to the whole height.
+ *
+ * @param barcode
+ * @param rect_attr
+ * @param area The area of the bars
+ */
+static void _draw_bars(gt_obj_st * barcode, gt_attr_rect_st * rect_attr, gt_area_st const * area) {
+    _gt_barcode_st * widget = (_gt_barcode_st * )barcode;
+    gt_area_st const * band = &barcode->draw_ctx->buf_area;
+    uint16_t row_bytes = _get_row_bytes(widget->bars_w);
+    gt_area_st run = { .h = widget->bars_rows > 1 ? 1 : area->h };
+    uint8_t const * bits = NULL;
+    uint16_t i = 0, start = 0;
+
+    for (uint16_t row = 0; row < widget->bars_rows; ++row) {
+        run.y = area->y + row * run.h;
+        if (run.y + run.h <= band->y || run.y >= band->y + band->h) {
+            continue;
+        }
+        bits = &widget->bars[row * row_bytes];
+        i = 0;
+        while (i < widget->bars_w) {
+            if (0 == (bits[i >> 3] & (0x80 >> (i & 0x07)))) {
+                ++i;
+                continue;
+            }
+            start = i;
+            while (i < widget->bars_w && (bits[i >> 3] & (0x80 >> (i & 0x07)))) {
+                ++i;
+            }
+            run.x = area->x + start;
+            run.w = i - start;
+            draw_bg(barcode->draw_ctx, rect_attr, &run);
+        }
+    }
+}
+
+static inline void _gt_barcode_init_widget(gt_obj_st * barcode) {
+    _gt_barcode_st * widget = (_gt_barcode_st * )barcode;
+    barcode_st * style = (barcode_st * )&widget->info;
+    gt_area_st area;
+    gt_size_t h = style->mode_h;
+    uint32_t start_tick = 0;
+
+    if (GT_RES_OK != _encode_bars(barcode)) {
+        return;
+    }
+#if (!BARCODE_READ_MODE)
+    if(h < BARCODE_LINE_NUMB) { h = BARCODE_LINE_NUMB; }
+#endif
 
     /* base shape */
     gt_attr_rect_st rect_attr;
@@ -120,58 +216,32 @@ static inline void _gt_barcode_init_widget(gt_obj_st * barcode) {
 
     // Draw background
     rect_attr.bg_color      = gt_color_white();
-    barcode->area.w = area.w + 4;
+    barcode->area.w = widget->bars_w + 4;
     barcode->area.h = h;
     //
     draw_bg(barcode->draw_ctx, &rect_attr, &barcode->area);
 
     // set barcode color
     rect_attr.bg_color      = gt_color_black();
-    rect_attr.data_gray = style->pdat;
-    rect_attr.gray = 1;
 
     area.x = barcode->area.x + 2;
+    area.w = widget->bars_w;
 #if (BARCODE_READ_MODE)
-    // 1:base shape
-    draw_bg(barcode->draw_ctx, &rect_attr, &area);
+    area.y = barcode->area.y;
+    area.h = widget->bars_rows;
 #else
-
     // Barcode indent
     area.y = barcode->area.y + 2;
-    h -= 4;
-    area.h = BARCODE_LINE_NUMB;
-
-    for(i = 1; i < BARCODE_LINE_NUMB; i++) {
-        gt_memmove(&style->pdat[i * (area.w >> 3)] , &style->pdat[0] , area.w >> 3);
-    }
-
-    int count = h / BARCODE_LINE_NUMB;
-    if (h % BARCODE_LINE_NUMB) {
-        count++;
-    }
-
-    for(i = 0; i < count; i++) {
-        if((h%BARCODE_LINE_NUMB) && (i == count-1))
-        {
-            area.h = h%BARCODE_LINE_NUMB;
-            draw_bg(barcode->draw_ctx, &rect_attr, &area);
-            area.y += area.h;
-            continue;
-        }
-        draw_bg(barcode->draw_ctx, &rect_attr, &area);
-        area.y += BARCODE_LINE_NUMB;
-    }
+    area.h = h - 4;
 #endif
+    start_tick = gt_tick_get();
+    _draw_bars(barcode, &rect_attr, &area);
+    widget->stat.draw_time += gt_tick_get() - start_tick;
 
     // focus
     draw_focus(barcode , barcode->radius);
 
-RET_FREE:
-    if (NULL != style->pdat) {
-        gt_mem_free(style->pdat);
-        style->pdat = NULL;
-    }
-    style->pdat_size = 0;
+    ++widget->stat.draw_count;
 }
 
 /**
@@ -208,6 +278,7 @@ static void _deinit_cb(gt_obj_st * obj) {
         gt_mem_free(style_p->barcode);
         style_p->barcode = NULL;
     }
+    _free_bars(obj_p);
 }
 
 /**
@@ -281,11 +352,16 @@ void gt_barcode_set_code_text(gt_obj_st * barcode , char* code)
     barcode_st * style = (barcode_st * )&obj->info;
     uint16_t size = code == NULL ? 0 : strlen(code);
 
+    if (style->barcode && size == strlen(style->barcode) && (0 == size || 0 == memcmp(style->barcode, code, size))) {
+        /** The same content, no need to encode again */
+        return;
+    }
     style->barcode = style->barcode ? gt_mem_realloc(style->barcode, size + 1) : gt_mem_malloc(size + 1);
     GT_CHECK_BACK(style->barcode);
     gt_memcpy(style->barcode, code, size);
     style->barcode[size] = '\0';
-    // gt_event_send(barcode, GT_EVENT_TYPE_DRAW_START, NULL);
+    _free_bars(obj);
+    gt_event_send(barcode, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 
 void gt_barcode_set_type(gt_obj_st * barcode , gt_family_t family)
@@ -295,6 +371,7 @@ void gt_barcode_set_type(gt_obj_st * barcode , gt_family_t family)
     }
     _gt_barcode_st * style = (_gt_barcode_st * )barcode;
     style->info.type = family;
+    _free_bars(style);
     gt_event_send(barcode, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 
@@ -305,6 +382,7 @@ void gt_barcode_set_hri_type(gt_obj_st * barcode , gt_family_t family)
     }
     _gt_barcode_st * style = (_gt_barcode_st * )barcode;
     style->info.hri_type = family;
+    _free_bars(style);
 }
 
 void gt_barcode_set_mode_w(gt_obj_st * barcode , uint8_t value)
@@ -314,6 +392,7 @@ void gt_barcode_set_mode_w(gt_obj_st * barcode , uint8_t value)
     }
     _gt_barcode_st * style = (_gt_barcode_st * )barcode;
     style->info.mode_w = value;
+    _free_bars(style);
     gt_event_send(barcode, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 
@@ -324,6 +403,9 @@ void gt_barcode_set_mode_h(gt_obj_st * barcode, uint8_t value)
     }
     _gt_barcode_st * style = (_gt_barcode_st * )barcode;
     style->info.mode_h = value;
+#if (BARCODE_READ_MODE)
+    _free_bars(style);
+#endif
     gt_event_send(barcode, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 
@@ -334,6 +416,20 @@ void gt_barcode_set_upc_e_sys_code(gt_obj_st * barcode , uint8_t value)
     }
     _gt_barcode_st * style = (_gt_barcode_st * )barcode;
     style->info.upc_e_sys = value;
+    _free_bars(style);
+}
+
+void gt_barcode_get_stat(gt_obj_st * barcode, gt_barcode_stat_st * stat)
+{
+    if (NULL == stat) {
+        return;
+    }
+    if (false == gt_obj_is_type(barcode, OBJ_TYPE)) {
+        gt_memset_0(stat, sizeof(gt_barcode_stat_st));
+        return;
+    }
+    _gt_barcode_st * style = (_gt_barcode_st * )barcode;
+    gt_memcpy(stat, &style->stat, sizeof(gt_barcode_stat_st));
 }
 
 #endif  /** GT_CFG_ENABLE_BARCODE */
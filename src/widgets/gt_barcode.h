@@ -31,6 +31,14 @@ extern "C" {
 
 
 /* typedef --------------------------------------------------------------*/
+/**
+ * @brief The statistics of the barcode widget
+ */
+typedef struct gt_barcode_stat_s {
+    uint32_t encode_count;  /** The count of the code text has been encoded */
+    uint32_t draw_count;    /** The count of the draw callback, once per band */
+    uint32_t draw_time;     /** The total time of drawing the bars, the ticks crossed by each band are summed, unit: ms */
+}gt_barcode_stat_st;
 
 
 
@@ -60,6 +68,15 @@ void gt_barcode_set_mode_w(gt_obj_st * barcode , uint8_t value);
 void gt_barcode_set_mode_h(gt_obj_st * barcode , uint8_t value);
 void gt_barcode_set_upc_e_sys_code(gt_obj_st * barcode , uint8_t value);
 
+/**
+ * @brief Get the statistics of the barcode, the code text is encoded only
+ *      when the content, type or module width is changed.
+ *
+ * @param barcode
+ * @param stat [out] The statistics
+ */
+void gt_barcode_get_stat(gt_obj_st * barcode, gt_barcode_stat_st * stat);
+
 
 #endif  /** GT_CFG_ENABLE_BARCODE */
 
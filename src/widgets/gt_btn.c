@@ -286,7 +286,7 @@ gt_obj_st * gt_btn_create(gt_obj_st * parent)
     style->contents = _gt_vector_create(_contents_free_cb, _contents_equal_cb);
 
     uint16_t len = strlen("btn");
-    char * str = gt_mem_malloc(len);
+    char * str = gt_mem_malloc(len + 1);
     if (NULL == str) {
         return obj;
     }
@@ -11,13 +11,16 @@
 #include "./gt_chat.h"
 
 #if GT_CFG_ENABLE_CHAT
+#include "stdio.h"
 #include "../hal/gt_hal_disp.h"
+#include "../hal/gt_hal_tick.h"
 #include "../core/gt_obj_pos.h"
 #include "../core/gt_graph_base.h"
 #include "../core/gt_draw.h"
 #include "../core/gt_disp.h"
 #include "../core/gt_mem.h"
 #include "../core/gt_obj_scroll.h"
+#include "../core/gt_hit_grid.h"
 #include "../others/gt_log.h"
 #include "../others/gt_anim.h"
 #include "../widgets/gt_label.h"
@@ -34,20 +37,49 @@
 
 #define _MULTI_LINE_CONTENT_INDENT_DEFAULT      (2)
 
+/** The messages log capacity at the first time */
+#define _MSG_MIN_CAPACITY   (8)
+
+/** The maximum count of messages, the index of message must be fit in gt_size_t */
+#define _MSG_CNT_LIMIT      (0x7FFF)
+
+/** The bubbles out of the view within this distance are materialized too */
+#define _MSG_OVERSCAN(h)    ((h) >> 1)
+
 /* private typedef ------------------------------------------------------*/
-typedef struct _gt_chat_param_s{
-    gt_obj_st* msg_obj;
+
+/**
+ * @brief A message in the log, the size of bubble is measured once when
+ *      the message is added or the font is changed.
+ */
+typedef struct _gt_chat_msg_s {
+    char * text;            /** NULL: voice message */
+    uint32_t top;           /** The top of message in the whole log, only grows */
+    uint32_t timestamp;     /** The tick when the message is added */
+    uint16_t w;             /** The measured bubble size */
+    uint16_t h;
     uint8_t tim_s;
     uint8_t type : 3;
     uint8_t is_send : 1;
-}_gt_chat_param_st;
+    uint8_t multi_line : 1;
+}_gt_chat_msg_st;
+
+/**
+ * @brief The bubble object which is recycled by the messages within the view
+ */
+typedef struct _gt_chat_bubble_s {
+    gt_obj_st * obj;
+    uint32_t seq;           /** The sequence number of the message which is bound */
+    uint8_t bound : 1;
+}_gt_chat_bubble_st;
 
 typedef struct _gt_chat_s {
     gt_obj_st obj;
 
     gt_anim_st msg_anim;
 
-    _gt_chat_param_st msg_list[GT_CHAT_MAX_MSG_CNT];
+    _gt_chat_msg_st * msgs;         /** The messages ring buffer, the oldest one at msg_head */
+    _gt_chat_bubble_st * bubbles;
     gt_font_info_st font_info;
 
     gt_color_t send_bgcolor;
@@ -57,13 +89,19 @@ typedef struct _gt_chat_s {
     gt_color_t recv_border_color;
     gt_color_t recv_font_color;
 
+    int32_t scroll_y;               /** The offset of the content, <= 0 */
+    uint32_t seq_base;              /** The sequence number of the oldest message */
+
     gt_size_t paly_idx;
     gt_size_t msg_select_idx;
 
     gt_radius_t msg_radius;
 
-    uint16_t max_h;
-    uint8_t msg_cnt;
+    uint16_t msg_cnt;
+    uint16_t msg_capacity;
+    uint16_t msg_head;
+    uint16_t max_msg_cnt;           /** 0: unlimited */
+    uint16_t bubble_cnt;
 
     uint8_t send_border_w;
     uint8_t recv_border_w;
@@ -89,12 +127,12 @@ typedef enum{
     _SET_MSG_FONT_GRAY,
     _SET_MSG_FONT_THICK_EN,
     _SET_MSG_FONT_THICK_CN,
-    _SET_MSG_RADIUS,
     _SET_MSG_FONT_STYLE,
 }_gt_chat_set_msg_te;
 
 /* static prototypes ----------------------------------------------------*/
 static void _init_cb(gt_obj_st * obj);
+static void _deinit_cb(gt_obj_st * obj);
 static void _event_cb(struct gt_obj_s * obj, gt_event_st * e);
 
 static GT_ATTRIBUTE_RAM_TEXT void _gt_chat_add_msg(gt_obj_st * chat, const char * msg, uint8_t tim_s, gt_chat_type_te type, bool is_send);
@@ -104,13 +142,14 @@ static GT_ATTRIBUTE_RAM_TEXT void _scrolling_handler(gt_obj_st * obj);
 static GT_ATTRIBUTE_RAM_TEXT void _msg_click_cb(gt_event_st * e);
 static GT_ATTRIBUTE_RAM_TEXT void _msg_anim_start_cb(struct gt_anim_s * anim);
 static GT_ATTRIBUTE_RAM_TEXT void _msg_anim_ready_cb(struct gt_anim_s * anim);
+static GT_ATTRIBUTE_RAM_TEXT void _msg_anim_exec_cb(void * obj, int32_t count);
 
 
 /* static variables -----------------------------------------------------*/
 
 static GT_ATTRIBUTE_RAM_DATA const gt_obj_class_st gt_chat_class = {
     ._init_cb      = _init_cb,
-    ._deinit_cb    = (_gt_deinit_cb_t)NULL,
+    ._deinit_cb    = _deinit_cb,
     ._event_cb     = _event_cb,
     .type          = OBJ_TYPE,
     .size_style    = sizeof(_gt_chat_st)
@@ -121,6 +160,34 @@ static GT_ATTRIBUTE_RAM_DATA const gt_obj_class_st gt_chat_class = {
 
 /* static functions -----------------------------------------------------*/
 
+static inline _gt_chat_msg_st * _get_msg(_gt_chat_st * style, uint16_t idx) {
+    uint32_t pos = (uint32_t)style->msg_head + idx;
+    if (pos >= style->msg_capacity) {
+        pos -= style->msg_capacity;
+    }
+    return &style->msgs[pos];
+}
+
+/**
+ * @brief The top of message within the content, the content begins with
+ *      a space of _MSG_SPACE_Y.
+ */
+static inline int32_t _get_msg_content_y(_gt_chat_st * style, uint16_t idx) {
+    return _MSG_SPACE_Y + (int32_t)(_get_msg(style, idx)->top - _get_msg(style, 0)->top);
+}
+
+static inline int32_t _get_content_h(_gt_chat_st * style) {
+    if (0 == style->msg_cnt) {
+        return _MSG_SPACE_Y;
+    }
+    uint16_t last = style->msg_cnt - 1;
+    return _get_msg_content_y(style, last) + _get_msg(style, last)->h + _MSG_SPACE_Y;
+}
+
+static inline gt_size_t _get_msg_idx_by_seq(_gt_chat_st * style, uint32_t seq) {
+    return (gt_size_t)(seq - style->seq_base);
+}
+
 static void _init_cb(gt_obj_st * obj) {
     if(!obj || 0 == obj->area.w || 0 == obj->area.h) return;
 
@@ -137,6 +204,35 @@ static void _init_cb(gt_obj_st * obj) {
     draw_focus(obj, obj->radius);
 }
 
+static void _free_msgs(_gt_chat_st * style) {
+    for (uint16_t i = 0; i < style->msg_cnt; ++i) {
+        _gt_chat_msg_st * msg = _get_msg(style, i);
+        if (msg->text) {
+            gt_mem_free(msg->text);
+            msg->text = NULL;
+        }
+    }
+    if (style->msgs) {
+        gt_mem_free(style->msgs);
+        style->msgs = NULL;
+    }
+    style->seq_base += style->msg_cnt;
+    style->msg_cnt = 0;
+    style->msg_capacity = 0;
+    style->msg_head = 0;
+}
+
+static void _deinit_cb(gt_obj_st * obj) {
+    _gt_chat_st * style = (_gt_chat_st * )obj;
+    gt_anim_del(obj, _msg_anim_exec_cb);
+    _free_msgs(style);
+    /** The bubble objects are freed as the children */
+    if (style->bubbles) {
+        gt_mem_free(style->bubbles);
+        style->bubbles = NULL;
+    }
+    style->bubble_cnt = 0;
+}
 
 static void _event_cb(struct gt_obj_s * obj, gt_event_st * e) {
     gt_event_type_et type = gt_event_get_code(e);
@@ -163,18 +259,24 @@ static void _event_cb(struct gt_obj_s * obj, gt_event_st * e) {
     }
 }
 
-static GT_ATTRIBUTE_RAM_TEXT void _gt_set_voice_text(gt_obj_st* obj, uint8_t tim_s, bool is_send, uint8_t start) {
+static GT_ATTRIBUTE_RAM_TEXT void _get_voice_text(char * buf, uint8_t size, uint8_t tim_s, bool is_send, uint8_t start) {
     // @GT_SYMBOL_VOICE_PLAY
     const char left_voice_icon[3][4] = {GT_SYMBOL_VOICE_PLAY_LEFT_1,GT_SYMBOL_VOICE_PLAY_LEFT_2,GT_SYMBOL_VOICE_PLAY_LEFT_3};
     const char right_voice_icon[3][4] = {GT_SYMBOL_VOICE_PLAY_RIGHT_1,GT_SYMBOL_VOICE_PLAY_RIGHT_2,GT_SYMBOL_VOICE_PLAY_RIGHT_3};
     if(is_send){
-        gt_btn_set_text(obj, "%d\" %s", tim_s, right_voice_icon[start % GT_SYMBOL_VOICE_PLAY]);
+        snprintf(buf, size, "%d\" %.4s", tim_s, right_voice_icon[start % GT_SYMBOL_VOICE_PLAY]);
     }
     else{
-        gt_btn_set_text(obj, "%s %d\"", left_voice_icon[start % GT_SYMBOL_VOICE_PLAY], tim_s);
+        snprintf(buf, size, "%.4s %d\"", left_voice_icon[start % GT_SYMBOL_VOICE_PLAY], tim_s);
     }
 }
 
+static GT_ATTRIBUTE_RAM_TEXT void _gt_set_voice_text(gt_obj_st* obj, uint8_t tim_s, bool is_send, uint8_t start) {
+    char buf[16] = {0};
+    _get_voice_text(buf, sizeof(buf), tim_s, is_send, start);
+    gt_btn_set_text(obj, "%s", buf);
+}
+
 static GT_ATTRIBUTE_RAM_TEXT void _gt_set_msg_font_info_all(gt_obj_st * msg_obj, gt_font_info_st * font_info) {
 #if (defined(GT_FONT_FAMILY_OLD_ENABLE) && (GT_FONT_FAMILY_OLD_ENABLE == 1))
     gt_btn_set_font_family_cn(msg_obj, font_info->style_cn);
@@ -193,15 +295,21 @@ static GT_ATTRIBUTE_RAM_TEXT void _gt_set_msg_font_info_all(gt_obj_st * msg_obj,
     gt_btn_set_font_style(msg_obj, font_info->style.all);
 }
 
-static GT_ATTRIBUTE_RAM_TEXT uint16_t _gt_update_msg_area_idx(gt_obj_st* chat, uint8_t idx, bool is_send) {
+/**
+ * @brief Measure the bubble size of message by the text layout, which
+ *      is only called when the message is added or the font is changed.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_measure_msg(gt_obj_st* chat, _gt_chat_msg_st * msg) {
     _gt_chat_st * style = (_gt_chat_st * )chat;
+    char voice_text[16] = {0};
     uint32_t w = 0, h = 0;
-    gt_size_t x, y;
-    gt_radius_t radius = style->msg_radius;
 
+    if (GT_CHAT_TYPE_VOICE == msg->type || NULL == msg->text) {
+        _get_voice_text(voice_text, sizeof(voice_text), msg->tim_s, msg->is_send, GT_SYMBOL_VOICE_PLAY - 1);
+    }
     w = 8;
     gt_font_split_line_st sp_line = {
-        .text = gt_btn_get_text(style->msg_list[idx].msg_obj),
+        .text = msg->text ? msg->text : voice_text,
         .max_w = _MSG_MAX_W(chat->area.w) - w,
         .start_w =  _MSG_MAX_W(chat->area.w) - w - style->font_info.size,
         .space = 0,
@@ -209,163 +317,445 @@ static GT_ATTRIBUTE_RAM_TEXT uint16_t _gt_update_msg_area_idx(gt_obj_st* chat, u
     };
     sp_line.len = strlen(sp_line.text);
     h = gt_font_split_line_numb(&style->font_info, &sp_line, &w);
-    if (h > 1) {
-        gt_btn_set_font_align(style->msg_list[idx].msg_obj, GT_ALIGN_LEFT_MID);
-        gt_btn_set_indent(style->msg_list[idx].msg_obj, _MULTI_LINE_CONTENT_INDENT_DEFAULT);
-    } else {
-        gt_btn_set_font_align(style->msg_list[idx].msg_obj, GT_ALIGN_CENTER_MID);
-        gt_btn_set_indent(style->msg_list[idx].msg_obj, 0);
-    }
+    msg->multi_line = h > 1 ? 1 : 0;
     h = (h + 1) * (style->font_info.size);
     w += style->font_info.size;
     w = w > _MSG_MAX_W(chat->area.w)  ? _MSG_MAX_W(chat->area.w) + 4 : w;
-    x = (style->msg_list[idx].is_send ?  (chat->area.w - w - _MSG_SPACE_X) : _MSG_SPACE_X) + chat->area.x;
-    y =  idx <= 0 ? _MSG_SPACE_Y + chat->area.y : style->msg_list[idx - 1].msg_obj->area.y + style->msg_list[idx - 1].msg_obj->area.h + _MSG_SPACE_Y;
 
-    if(radius > GT_MIN(w >> 1, h >> 1)) {
-        radius = GT_MIN(w >> 1, h >> 1);
+    msg->w = w;
+    msg->h = h;
+}
+
+/**
+ * @brief Recalculate the top of messages from the idx one, the others
+ *      above are not changed.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_relayout_msg_from(_gt_chat_st * style, uint16_t idx) {
+    _gt_chat_msg_st * prev = NULL, * msg = NULL;
+    for (uint16_t i = idx ? idx : 1; i < style->msg_cnt; ++i) {
+        prev = _get_msg(style, i - 1);
+        msg = _get_msg(style, i);
+        msg->top = prev->top + prev->h + _MSG_SPACE_Y;
     }
+}
 
-    gt_btn_set_radius(style->msg_list[idx].msg_obj, radius);
+static GT_ATTRIBUTE_RAM_TEXT gt_res_t _gt_msg_reserve(_gt_chat_st * style) {
+    uint32_t capacity = style->msg_capacity;
+    _gt_chat_msg_st * msgs = NULL;
 
-    style->msg_list[idx].msg_obj->area.x = x;
-    style->msg_list[idx].msg_obj->area.y = y;
-    style->msg_list[idx].msg_obj->area.w = w;
-    style->msg_list[idx].msg_obj->area.h = h;
+    if (style->msg_cnt < style->msg_capacity) {
+        return GT_RES_OK;
+    }
+    /** grows geometrically */
+    capacity = capacity ? capacity + (capacity >> 1) : _MSG_MIN_CAPACITY;
+    if (style->max_msg_cnt && capacity > style->max_msg_cnt) {
+        capacity = style->max_msg_cnt;
+    }
+    if (capacity > _MSG_CNT_LIMIT) {
+        capacity = _MSG_CNT_LIMIT;
+    }
+    if (capacity <= style->msg_capacity) {
+        return GT_RES_FAIL;
+    }
+    msgs = gt_mem_malloc(capacity * sizeof(_gt_chat_msg_st));
+    if (NULL == msgs) {
+        GT_LOGW(GT_LOG_TAG_GUI, "chat msgs malloc failed, size: %lu", capacity * sizeof(_gt_chat_msg_st));
+        return GT_RES_FAIL;
+    }
+    for (uint16_t i = 0; i < style->msg_cnt; ++i) {
+        msgs[i] = *_get_msg(style, i);
+    }
+    if (style->msgs) {
+        gt_mem_free(style->msgs);
+    }
+    style->msgs = msgs;
+    style->msg_capacity = capacity;
+    style->msg_head = 0;
+    return GT_RES_OK;
+}
 
-    return (h + _MSG_SPACE_Y);
+/**
+ * @brief Evict the oldest message, the index of messages are moved forward
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_msg_evict_oldest(_gt_chat_st * style) {
+    _gt_chat_msg_st * msg = NULL;
+    if (0 == style->msg_cnt) {
+        return;
+    }
+    msg = _get_msg(style, 0);
+    if (msg->text) {
+        gt_mem_free(msg->text);
+        msg->text = NULL;
+    }
+    style->msg_head = (style->msg_head + 1 >= style->msg_capacity) ? 0 : style->msg_head + 1;
+    --style->msg_cnt;
+    ++style->seq_base;
+
+    if (style->paly_idx >= 0) {
+        --style->paly_idx;
+    }
+    if (style->msg_select_idx >= 0) {
+        --style->msg_select_idx;
+    }
 }
 
-static GT_ATTRIBUTE_RAM_TEXT void _gt_chat_msg_move_y(gt_obj_st * chat, gt_size_t offset_y) {
+/**
+ * @brief The bubbles are always inside the chat which is redrawn by itself,
+ *      only the visible state and the touch index are updated.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_bubble_set_visible(gt_obj_st * obj, bool visible) {
+    if (!visible && !obj->visible) {
+        return;
+    }
+    obj->visible = visible;
+#if GT_USE_OBJ_HIT_GRID
+    _gt_hit_grid_update(obj);
+#endif
+}
+
+static GT_ATTRIBUTE_RAM_TEXT _gt_chat_bubble_st * _gt_bubble_create(gt_obj_st * chat) {
     _gt_chat_st * style = (_gt_chat_st * )chat;
+    _gt_chat_bubble_st * bubbles = NULL;
+    gt_obj_st * obj = NULL;
 
-    if(offset_y > 0) return;
+    bubbles = gt_mem_realloc(style->bubbles, (style->bubble_cnt + 1) * sizeof(_gt_chat_bubble_st));
+    if (NULL == bubbles) {
+        return NULL;
+    }
+    style->bubbles = bubbles;
 
-    gt_size_t y = offset_y + chat->area.y + _MSG_SPACE_Y;
+    obj = gt_btn_create(chat);
+    if (NULL == obj) {
+        return NULL;
+    }
+    gt_obj_set_inside(obj, true);
+    gt_obj_set_fixed(obj, true);
+    gt_obj_add_event_cb(obj, _msg_click_cb, GT_EVENT_TYPE_INPUT_RELEASED, chat);
+    _gt_set_msg_font_info_all(obj, &style->font_info);
+
+    bubbles = &style->bubbles[style->bubble_cnt++];
+    bubbles->obj = obj;
+    bubbles->seq = 0;
+    bubbles->bound = 0;
+    return bubbles;
+}
 
-    for(int i = 0; i < style->msg_cnt; i++)
-    {
-        style->msg_list[i].msg_obj->area.y = y;
-        y += style->msg_list[i].msg_obj->area.h + _MSG_SPACE_Y;
+/**
+ * @brief Apply the message content and style to the bubble
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_bubble_apply_msg(gt_obj_st * chat, _gt_chat_bubble_st * bubble, uint16_t idx) {
+    _gt_chat_st * style = (_gt_chat_st * )chat;
+    _gt_chat_msg_st * msg = _get_msg(style, idx);
+    gt_obj_st * obj = bubble->obj;
+    gt_radius_t radius = style->msg_radius;
+    bool is_send = msg->is_send;
+
+    /**
+     * The setters below invalidate the bubble, park it within the chat which
+     * is redrawn entirely, the area is updated by the caller later.
+     */
+    obj->area = chat->area;
+
+    gt_btn_set_color_background(obj, is_send ? style->send_bgcolor : style->recv_bgcolor);
+    gt_btn_set_color_border(obj, is_send ? style->send_border_color : style->recv_border_color);
+    gt_btn_set_border_width(obj, is_send ? style->send_border_w : style->recv_border_w);
+    gt_btn_set_font_color(obj, is_send ? style->send_font_color : style->recv_font_color);
+
+    if (GT_CHAT_TYPE_TEXT == msg->type) {
+        gt_btn_set_text(obj, "%s", msg->text ? msg->text : "");
+    }
+    else if (GT_CHAT_TYPE_VOICE == msg->type) {
+        _gt_set_voice_text(obj, msg->tim_s, is_send, GT_SYMBOL_VOICE_PLAY - 1);
+    }
+
+    if (msg->multi_line) {
+        gt_btn_set_font_align(obj, GT_ALIGN_LEFT_MID);
+        gt_btn_set_indent(obj, _MULTI_LINE_CONTENT_INDENT_DEFAULT);
+    } else {
+        gt_btn_set_font_align(obj, GT_ALIGN_CENTER_MID);
+        gt_btn_set_indent(obj, 0);
+    }
 
-        if(GT_STATE_PRESSED == gt_obj_get_state(style->msg_list[i].msg_obj)){
-            gt_obj_set_state(style->msg_list[i].msg_obj, GT_STATE_NONE);
+    if(radius > GT_MIN(msg->w >> 1, msg->h >> 1)) {
+        radius = GT_MIN(msg->w >> 1, msg->h >> 1);
+    }
+    gt_btn_set_radius(obj, radius);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT _gt_chat_bubble_st * _gt_bubble_find(_gt_chat_st * style, uint16_t idx) {
+    uint32_t seq = style->seq_base + idx;
+    for (uint16_t i = 0; i < style->bubble_cnt; ++i) {
+        if (style->bubbles[i].bound && seq == style->bubbles[i].seq) {
+            return &style->bubbles[i];
         }
     }
+    return NULL;
 }
 
-static GT_ATTRIBUTE_RAM_TEXT void _gt_chat_add_msg(gt_obj_st * chat, const char * msg, uint8_t tim_s, gt_chat_type_te type, bool is_send) {
+/**
+ * @brief Get the first message which bottom is lower than y, binary search.
+ */
+static GT_ATTRIBUTE_RAM_TEXT uint16_t _gt_find_msg_by_y(_gt_chat_st * style, int32_t y) {
+    uint16_t lo = 0, hi = style->msg_cnt, mid = 0;
+    while (lo < hi) {
+        mid = lo + ((hi - lo) >> 1);
+        if (_get_msg_content_y(style, mid) + _get_msg(style, mid)->h <= y) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief Materialize the messages which intersect the view and overscan,
+ *      the bubbles of messages which scrolled out are recycled.
+ *
+ * @param chat
+ * @param rebind true: apply the message to the bubbles which already bound too
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_chat_update_bubbles(gt_obj_st * chat, bool rebind) {
     _gt_chat_st * style = (_gt_chat_st * )chat;
+    _gt_chat_bubble_st * bubble = NULL;
+    _gt_chat_msg_st * msg = NULL;
+    int32_t view_top = -style->scroll_y - _MSG_OVERSCAN(chat->area.h);
+    int32_t view_bottom = -style->scroll_y + chat->area.h + _MSG_OVERSCAN(chat->area.h);
+    uint16_t first = _gt_find_msg_by_y(style, view_top);
+    uint16_t last = first;
+    uint16_t i = 0, k = 0;
+
+    while (last < style->msg_cnt && _get_msg_content_y(style, last) < view_bottom) {
+        ++last;
+    }
 
-    if(style->msg_cnt >= GT_CHAT_MAX_MSG_CNT){
-        style->max_h -= (gt_obj_get_h(style->msg_list[0].msg_obj) + _MSG_SPACE_Y);
-        _gt_obj_class_destroy(style->msg_list[0].msg_obj);
-        gt_memmove (style->msg_list, style->msg_list + 1, sizeof(_gt_chat_param_st) * (GT_CHAT_MAX_MSG_CNT-1));
-        style->msg_cnt = GT_CHAT_MAX_MSG_CNT - 1;
+    /** recycle the bubbles out of range */
+    for (i = 0; i < style->bubble_cnt; ++i) {
+        bubble = &style->bubbles[i];
+        if (bubble->bound &&
+            (bubble->seq < style->seq_base + first || bubble->seq >= style->seq_base + last)) {
+            bubble->bound = 0;
+        }
+        if (!bubble->bound) {
+            _gt_bubble_set_visible(bubble->obj, false);
+        }
     }
-    style->msg_list[style->msg_cnt].tim_s = tim_s;
-    style->msg_list[style->msg_cnt].type = type;
-    style->msg_list[style->msg_cnt].is_send = is_send;
-    style->msg_list[style->msg_cnt].msg_obj = gt_btn_create(chat);
 
-    gt_obj_set_inside(style->msg_list[style->msg_cnt].msg_obj, true);
-    gt_obj_set_fixed(style->msg_list[style->msg_cnt].msg_obj, true);
-    gt_obj_add_event_cb(style->msg_list[style->msg_cnt].msg_obj, _msg_click_cb, GT_EVENT_TYPE_INPUT_RELEASED, chat);
-    _gt_set_msg_font_info_all(style->msg_list[style->msg_cnt].msg_obj, &style->font_info);
+    for (i = first; i < last; ++i) {
+        msg = _get_msg(style, i);
+        bubble = _gt_bubble_find(style, i);
+        if (NULL == bubble) {
+            for (; k < style->bubble_cnt && style->bubbles[k].bound; ++k) {}
+            bubble = k < style->bubble_cnt ? &style->bubbles[k] : _gt_bubble_create(chat);
+            if (NULL == bubble) {
+                GT_LOGW(GT_LOG_TAG_GUI, "chat bubble create failed");
+                break;
+            }
+            bubble->seq = style->seq_base + i;
+            bubble->bound = 1;
+            _gt_bubble_apply_msg(chat, bubble, i);
+        }
+        else if (rebind) {
+            _gt_bubble_apply_msg(chat, bubble, i);
+        }
 
-    //
-    gt_btn_set_color_background(style->msg_list[style->msg_cnt].msg_obj, is_send ? style->send_bgcolor : style->recv_bgcolor);
-    gt_btn_set_color_border(style->msg_list[style->msg_cnt].msg_obj, is_send ? style->send_border_color : style->recv_border_color);
-    gt_btn_set_border_width(style->msg_list[style->msg_cnt].msg_obj, is_send ? style->send_border_w : style->recv_border_w);
-    gt_btn_set_font_color(style->msg_list[style->msg_cnt].msg_obj, is_send ? style->send_font_color : style->recv_font_color);
+        bubble->obj->area.x = (msg->is_send ?  (chat->area.w - msg->w - _MSG_SPACE_X) : _MSG_SPACE_X) + chat->area.x;
+        bubble->obj->area.y = chat->area.y + style->scroll_y + _get_msg_content_y(style, i);
+        bubble->obj->area.w = msg->w;
+        bubble->obj->area.h = msg->h;
+        if(GT_STATE_PRESSED == gt_obj_get_state(bubble->obj)){
+            gt_obj_set_state(bubble->obj, GT_STATE_NONE);
+        }
+        _gt_bubble_set_visible(bubble->obj, true);
+    }
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline int32_t _gt_chat_get_scroll_bottom(gt_obj_st * chat) {
+    int32_t bottom = chat->area.h - _get_content_h((_gt_chat_st * )chat);
+    return bottom < 0 ? bottom : 0;
+}
+
+/**
+ * @brief Keep the process scroll value as the content offset, which is
+ *      wrapped when the content is higher than gt_size_t range.
+ */
+static GT_ATTRIBUTE_RAM_TEXT inline void _gt_chat_sync_scroll(gt_obj_st * chat) {
+    chat->process_attr.scroll.y = (gt_size_t)((_gt_chat_st * )chat)->scroll_y;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _gt_chat_scroll_to_bottom(gt_obj_st * chat) {
+    _gt_chat_st * style = (_gt_chat_st * )chat;
+    style->scroll_y = _gt_chat_get_scroll_bottom(chat);
+    _gt_chat_sync_scroll(chat);
+    _gt_chat_update_bubbles(chat, false);
+}
 
-    if(GT_CHAT_TYPE_TEXT == type ){
-        gt_btn_set_text(style->msg_list[style->msg_cnt].msg_obj, msg);
+static GT_ATTRIBUTE_RAM_TEXT void _gt_chat_add_msg(gt_obj_st * chat, const char * msg, uint8_t tim_s, gt_chat_type_te type, bool is_send) {
+    _gt_chat_st * style = (_gt_chat_st * )chat;
+    _gt_chat_msg_st * item = NULL;
+    _gt_chat_msg_st * prev = NULL;
+    char * text = NULL;
+    uint16_t len = 0;
+
+    if (GT_CHAT_TYPE_TEXT == type) {
+        len = msg ? strlen(msg) : 0;
+        text = gt_mem_malloc(len + 1);
+        if (NULL == text) {
+            GT_LOGW(GT_LOG_TAG_GUI, "chat msg malloc failed, size: %d", len + 1);
+            return;
+        }
+        gt_memcpy(text, msg, len);
+        text[len] = '\0';
     }
-    else if(GT_CHAT_TYPE_VOICE == type){
-        _gt_set_voice_text(style->msg_list[style->msg_cnt].msg_obj, tim_s, is_send, GT_SYMBOL_VOICE_PLAY-1);
+
+    if ((style->max_msg_cnt && style->msg_cnt >= style->max_msg_cnt) ||
+        GT_RES_OK != _gt_msg_reserve(style)) {
+        _gt_msg_evict_oldest(style);
+    }
+    if (style->msg_cnt >= style->msg_capacity) {
+        if (text) {
+            gt_mem_free(text);
+        }
+        return;
     }
 
-    style->max_h += _gt_update_msg_area_idx(chat, style->msg_cnt, is_send);
+    item = _get_msg(style, style->msg_cnt);
+    gt_memset_0(item, sizeof(_gt_chat_msg_st));
+    item->text = text;
+    item->timestamp = gt_tick_get();
+    item->tim_s = tim_s;
+    item->type = type;
+    item->is_send = is_send;
+    _gt_measure_msg(chat, item);
+    if (style->msg_cnt) {
+        prev = _get_msg(style, style->msg_cnt - 1);
+        item->top = prev->top + prev->h + _MSG_SPACE_Y;
+    }
     style->msg_cnt++;
 
-    chat->process_attr.scroll.y = chat->area.h - style->max_h;
-    _gt_chat_msg_move_y(chat, chat->process_attr.scroll.y);
+    _gt_chat_scroll_to_bottom(chat);
 }
 
 static GT_ATTRIBUTE_RAM_TEXT void _gt_chat_append_msg(gt_obj_st* chat, const char* msg)
 {
     _gt_chat_st * style = (_gt_chat_st * )chat;
+    _gt_chat_bubble_st * bubble = NULL;
+    _gt_chat_msg_st * item = NULL;
+    char * text = NULL;
+    uint16_t len = 0, add = 0;
 
     int16_t index = style->msg_cnt - 1;
-    if(index < 0) return ;
-
-    if(GT_CHAT_TYPE_TEXT != style->msg_list[index].type) return ;
-
-    gt_obj_st * obj = style->msg_list[index].msg_obj;
-    char* cur_text = gt_btn_get_text(obj);
+    if(index < 0 || NULL == msg) return ;
 
-    gt_btn_set_text(obj, "%s%s", cur_text, msg);
+    item = _get_msg(style, index);
+    if(GT_CHAT_TYPE_TEXT != item->type) return ;
 
-    style->max_h -= (gt_obj_get_h(obj) + _MSG_SPACE_Y);
-    style->max_h += _gt_update_msg_area_idx(chat, index, style->msg_list[index].is_send);
-    chat->process_attr.scroll.y = chat->area.h - style->max_h;
-    _gt_chat_msg_move_y(chat, chat->process_attr.scroll.y);
+    len = item->text ? strlen(item->text) : 0;
+    add = strlen(msg);
+    text = gt_mem_realloc(item->text, len + add + 1);
+    if (NULL == text) {
+        GT_LOGW(GT_LOG_TAG_GUI, "chat msg realloc failed, size: %d", len + add + 1);
+        return;
+    }
+    gt_memcpy(&text[len], msg, add);
+    text[len + add] = '\0';
+    item->text = text;
+
+    _gt_measure_msg(chat, item);
+    bubble = _gt_bubble_find(style, index);
+    if (bubble) {
+        _gt_bubble_apply_msg(chat, bubble, index);
+    }
+    _gt_chat_scroll_to_bottom(chat);
 }
 
 static GT_ATTRIBUTE_RAM_TEXT void _scrolling_handler(gt_obj_st * obj) {
     _gt_chat_st * style = (_gt_chat_st * )obj;
-    gt_size_t bottom = gt_obj_get_limit_bottom(obj) + (-_MSG_SPACE_Y * 2);
+    int32_t bottom = _gt_chat_get_scroll_bottom(obj) - (_MSG_SPACE_Y * 2);
+    /** The distance scrolled since last time, gt_size_t wrapping is expected */
+    gt_size_t dist = (gt_size_t)(obj->process_attr.scroll.y - (gt_size_t)style->scroll_y);
 
-    if (gt_obj_scroll_get_y(obj) > 0) {
-        obj->process_attr.scroll.y = 0;
+    style->scroll_y += dist;
+    if (style->scroll_y > 0) {
+        style->scroll_y = 0;
     }
-    else if (gt_obj_scroll_get_y(obj) < bottom) {
-        obj->process_attr.scroll.y = bottom;
+    else if (style->scroll_y < bottom) {
+        style->scroll_y = bottom;
     }
-    _gt_chat_msg_move_y(obj, gt_obj_scroll_get_y(obj));
+    _gt_chat_sync_scroll(obj);
+    _gt_chat_update_bubbles(obj, false);
 
     gt_event_send(obj, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 
 static GT_ATTRIBUTE_RAM_TEXT void _gt_chat_update_msg_size(gt_obj_st * chat) {
     _gt_chat_st * style = (_gt_chat_st * )chat;
-    uint32_t w = 0, h = 0;
-    uint16_t max_h = _MSG_SPACE_Y;
-    for(int i = 0; i < style->msg_cnt; i++)
+    int32_t bottom = 0;
+    for(uint16_t i = 0; i < style->msg_cnt; i++)
     {
-        max_h += _gt_update_msg_area_idx(chat, i, style->msg_list[i].is_send);
+        _gt_measure_msg(chat, _get_msg(style, i));
     }
-    style->max_h = max_h;
+    _gt_relayout_msg_from(style, 0);
+
+    bottom = _gt_chat_get_scroll_bottom(chat);
+    if (style->scroll_y < bottom) {
+        style->scroll_y = bottom;
+        _gt_chat_sync_scroll(chat);
+    }
+    _gt_chat_update_bubbles(chat, true);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _gt_chat_set_voice_frame(_gt_chat_st * style, gt_size_t idx, uint8_t start) {
+    _gt_chat_bubble_st * bubble = NULL;
+    _gt_chat_msg_st * msg = NULL;
+    if (idx < 0 || idx >= style->msg_cnt) {
+        return;
+    }
+    msg = _get_msg(style, idx);
+    if (GT_CHAT_TYPE_VOICE != msg->type) {
+        return;
+    }
+    bubble = _gt_bubble_find(style, idx);
+    if (NULL == bubble) {
+        return;
+    }
+    _gt_set_voice_text(bubble->obj, msg->tim_s, msg->is_send, start);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT bool _gt_chat_is_voice_msg(_gt_chat_st * style, gt_size_t idx) {
+    if (idx < 0 || idx >= style->msg_cnt) {
+        return false;
+    }
+    return GT_CHAT_TYPE_VOICE == _get_msg(style, idx)->type;
 }
 
 static GT_ATTRIBUTE_RAM_TEXT void _msg_click_cb(gt_event_st * e) {
     gt_obj_st * chat = e->user_data;
     _gt_chat_st * style = (_gt_chat_st * )chat;
+    _gt_chat_msg_st * msg = NULL;
 
-    for(int i = 0; i < style->msg_cnt; i++){
-        if(style->msg_list[i].msg_obj == e->target){
-            style->msg_select_idx = i;
+    for(uint16_t i = 0; i < style->bubble_cnt; i++){
+        if(style->bubbles[i].bound && style->bubbles[i].obj == e->target){
+            style->msg_select_idx = _get_msg_idx_by_seq(style, style->bubbles[i].seq);
         }
     }
+    if (style->msg_select_idx < 0 || style->msg_select_idx >= style->msg_cnt) {
+        return;
+    }
     //
-    if(style->anim_play && GT_CHAT_TYPE_VOICE == style->msg_list[style->msg_select_idx].type)
+    if(style->anim_play && _gt_chat_is_voice_msg(style, style->msg_select_idx))
     {
         if(style->paly_idx == style->msg_select_idx){
             return ;
         }
-
-        if(style->paly_idx >= 0 && GT_CHAT_TYPE_VOICE == style->msg_list[style->paly_idx].type){
-            _gt_set_voice_text( style->msg_list[style->paly_idx].msg_obj, \
-                        style->msg_list[style->paly_idx].tim_s, \
-                        style->msg_list[style->paly_idx].is_send, GT_SYMBOL_VOICE_PLAY - 1);
-        }
+        _gt_chat_set_voice_frame(style, style->paly_idx, GT_SYMBOL_VOICE_PLAY - 1);
     }
     //
-    if(GT_CHAT_TYPE_VOICE == style->msg_list[style->msg_select_idx].type){
+    msg = _get_msg(style, style->msg_select_idx);
+    if(GT_CHAT_TYPE_VOICE == msg->type){
         style->paly_idx = style->msg_select_idx;
-        gt_anim_set_time(&style->msg_anim, style->msg_list[style->paly_idx].tim_s * 1000);
-        gt_anim_set_value(&style->msg_anim, 0, style->msg_list[style->paly_idx].tim_s * 3);
+        gt_anim_set_time(&style->msg_anim, msg->tim_s * 1000);
+        gt_anim_set_value(&style->msg_anim, 0, msg->tim_s * 3);
         gt_anim_start(&style->msg_anim);
         gt_event_send(chat, GT_EVENT_TYPE_DRAW_START, NULL);
     }
@@ -374,7 +764,7 @@ static GT_ATTRIBUTE_RAM_TEXT void _msg_click_cb(gt_event_st * e) {
 static GT_ATTRIBUTE_RAM_TEXT void _msg_anim_start_cb(struct gt_anim_s * anim) {
     _gt_chat_st * style = (_gt_chat_st * )anim->tar;
     style->anim_play = true;
-    if(style->paly_idx >= 0 && GT_CHAT_TYPE_VOICE == style->msg_list[style->paly_idx].type){
+    if(_gt_chat_is_voice_msg(style, style->paly_idx)){
         gt_event_send((gt_obj_st * )anim->tar, GT_EVENT_TYPE_INPUT_PLAY_START, &style->paly_idx);
     }
 }
@@ -383,10 +773,8 @@ static GT_ATTRIBUTE_RAM_TEXT void _msg_anim_ready_cb(struct gt_anim_s * anim) {
     _gt_chat_st * style = (_gt_chat_st * )anim->tar;
     style->anim_play = false;
 
-    if(style->paly_idx >= 0 && GT_CHAT_TYPE_VOICE == style->msg_list[style->paly_idx].type){
-        _gt_set_voice_text( style->msg_list[style->paly_idx].msg_obj, \
-                            style->msg_list[style->paly_idx].tim_s, \
-                            style->msg_list[style->paly_idx].is_send, GT_SYMBOL_VOICE_PLAY - 1);
+    if(_gt_chat_is_voice_msg(style, style->paly_idx)){
+        _gt_chat_set_voice_frame(style, style->paly_idx, GT_SYMBOL_VOICE_PLAY - 1);
         gt_event_send((gt_obj_st * )anim->tar, GT_EVENT_TYPE_INPUT_PLAY_END, &style->paly_idx);
     }
     style->paly_idx = -1;
@@ -394,72 +782,72 @@ static GT_ATTRIBUTE_RAM_TEXT void _msg_anim_ready_cb(struct gt_anim_s * anim) {
 
 static GT_ATTRIBUTE_RAM_TEXT void _msg_anim_exec_cb(void * obj, int32_t count) {
     _gt_chat_st * style = (_gt_chat_st * )obj;
-    if(style->paly_idx >= 0 && GT_CHAT_TYPE_VOICE == style->msg_list[style->paly_idx].type){
-        _gt_set_voice_text( style->msg_list[style->paly_idx].msg_obj, \
-                            style->msg_list[style->paly_idx].tim_s, \
-                            style->msg_list[style->paly_idx].is_send, count);
-    }
+    _gt_chat_set_voice_frame(style, style->paly_idx, count);
 }
 
 static GT_ATTRIBUTE_RAM_TEXT void _gt_set_msg_param(gt_obj_st* chat, _gt_chat_set_msg_te set_type) {
     _gt_chat_st * style = (_gt_chat_st * )chat;
-    for (int i = 0; i < style->msg_cnt; i++) {
+    gt_obj_st * obj = NULL;
+    bool is_send = false;
+
+    /** The unbound bubbles will be applied when they are bound */
+    for (uint16_t i = 0; i < style->bubble_cnt; i++) {
+        obj = style->bubbles[i].obj;
+        if (style->bubbles[i].bound) {
+            is_send = _get_msg(style, _get_msg_idx_by_seq(style, style->bubbles[i].seq))->is_send;
+        }
+        else if (set_type <= _SET_MSG_FONT_COLOR) {
+            continue;
+        }
 
         switch (set_type) {
         case _SET_MSG_BG_COLOR:
-            gt_btn_set_color_background(style->msg_list[i].msg_obj, \
-                                    style->msg_list[i].is_send ? style->send_bgcolor : style->recv_bgcolor);
+            gt_btn_set_color_background(obj, is_send ? style->send_bgcolor : style->recv_bgcolor);
             break;
         case _SET_MSG_BORDER_COLOR:
-            gt_btn_set_color_border(style->msg_list[i].msg_obj, \
-                                    style->msg_list[i].is_send ? style->send_border_color : style->recv_border_color);
+            gt_btn_set_color_border(obj, is_send ? style->send_border_color : style->recv_border_color);
             break;
         case _SET_MSG_BORDER_W:
-            gt_btn_set_border_width(style->msg_list[i].msg_obj, \
-                                    style->msg_list[i].is_send ? style->send_border_w : style->recv_border_w);
+            gt_btn_set_border_width(obj, is_send ? style->send_border_w : style->recv_border_w);
             break;
         case _SET_MSG_FONT_COLOR:
-            gt_btn_set_font_color(style->msg_list[i].msg_obj, \
-                                    style->msg_list[i].is_send ? style->send_font_color : style->recv_font_color);
+            gt_btn_set_font_color(obj, is_send ? style->send_font_color : style->recv_font_color);
             break;
 #if (defined(GT_FONT_FAMILY_OLD_ENABLE) && (GT_FONT_FAMILY_OLD_ENABLE == 1))
         case _SET_MSG_FONT_STYLE_CN:
-            gt_btn_set_font_family_cn(style->msg_list[i].msg_obj, style->font_info.style_cn);
+            gt_btn_set_font_family_cn(obj, style->font_info.style_cn);
             break;
         case _SET_MSG_FONT_STYLE_EN:
-            gt_btn_set_font_family_en(style->msg_list[i].msg_obj, style->font_info.style_en);
+            gt_btn_set_font_family_en(obj, style->font_info.style_en);
             break;
         case _SET_MSG_FONT_STYLE_FL:
-            gt_btn_set_font_family_fl(style->msg_list[i].msg_obj, style->font_info.style_fl);
+            gt_btn_set_font_family_fl(obj, style->font_info.style_fl);
             break;
         case _SET_MSG_FONT_STYLE_NUMB:
-            gt_btn_set_font_family_numb(style->msg_list[i].msg_obj, style->font_info.style_numb);
+            gt_btn_set_font_family_numb(obj, style->font_info.style_numb);
             break;
 #else
         case _SET_MSG_FONT_FAMILY:
-            gt_btn_set_font_family(style->msg_list[i].msg_obj, style->font_info.family);
+            gt_btn_set_font_family(obj, style->font_info.family);
             break;
         case _SET_MSG_FONT_CJK:
-            gt_btn_set_font_cjk(style->msg_list[i].msg_obj, style->font_info.cjk);
+            gt_btn_set_font_cjk(obj, style->font_info.cjk);
             break;
 #endif
         case _SET_MSG_FONT_SIZE:
-            gt_btn_set_font_size(style->msg_list[i].msg_obj, style->font_info.size);
+            gt_btn_set_font_size(obj, style->font_info.size);
             break;
         case _SET_MSG_FONT_GRAY:
-            gt_btn_set_font_gray(style->msg_list[i].msg_obj, style->font_info.gray);
+            gt_btn_set_font_gray(obj, style->font_info.gray);
             break;
         case _SET_MSG_FONT_THICK_EN:
-            gt_btn_set_font_thick_en(style->msg_list[i].msg_obj, style->font_info.thick_en);
+            gt_btn_set_font_thick_en(obj, style->font_info.thick_en);
             break;
         case _SET_MSG_FONT_THICK_CN:
-            gt_btn_set_font_thick_cn(style->msg_list[i].msg_obj, style->font_info.thick_cn);
-            break;
-        case _SET_MSG_RADIUS:
-            gt_btn_set_radius(style->msg_list[i].msg_obj, style->msg_radius);
+            gt_btn_set_font_thick_cn(obj, style->font_info.thick_cn);
             break;
         case _SET_MSG_FONT_STYLE:
-            gt_btn_set_font_style(style->msg_list[i].msg_obj, style->font_info.style.all);
+            gt_btn_set_font_style(obj, style->font_info.style.all);
             break;
         default:
             break;
@@ -477,8 +865,8 @@ gt_obj_st * gt_chat_create(gt_obj_st * parent)
     _gt_chat_st * style = (_gt_chat_st * )obj;
     style->msg_cnt = 0;
     style->paly_idx = -1;
-    style->max_h = _MSG_SPACE_Y;
-    gt_memset_0(style->msg_list, sizeof(style->msg_list));
+    style->msg_select_idx = -1;
+    style->max_msg_cnt = GT_CHAT_MAX_MSG_CNT;
     gt_font_info_init(&style->font_info);
     gt_obj_set_fixed(obj, false);
 
@@ -594,7 +982,6 @@ void gt_chat_set_send_msg_border_width(gt_obj_st * chat, uint8_t width)
     _gt_chat_st * style = (_gt_chat_st * )chat;
     style->send_border_w = width;
     _gt_set_msg_param(chat, _SET_MSG_BORDER_W);
-    _gt_chat_update_msg_size(chat);
     gt_event_send(chat, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 void gt_chat_set_received_msg_border_width(gt_obj_st * chat, uint8_t width)
@@ -605,7 +992,6 @@ void gt_chat_set_received_msg_border_width(gt_obj_st * chat, uint8_t width)
     _gt_chat_st * style = (_gt_chat_st * )chat;
     style->recv_border_w = width;
     _gt_set_msg_param(chat, _SET_MSG_BORDER_W);
-    _gt_chat_update_msg_size(chat);
     gt_event_send(chat, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 void gt_chat_set_send_msg_font_color(gt_obj_st * chat, gt_color_t color)
@@ -661,6 +1047,7 @@ void gt_chat_set_font_family_cn(gt_obj_st * chat, gt_family_t font_family_cn)
     _gt_chat_st * style = (_gt_chat_st * )chat;
     style->font_info.style_cn = font_family_cn;
     _gt_set_msg_param(chat, _SET_MSG_FONT_STYLE_CN);
+    _gt_chat_update_msg_size(chat);
 }
 
 void gt_chat_set_font_family_en(gt_obj_st * chat, gt_family_t font_family_en)
@@ -672,6 +1059,7 @@ void gt_chat_set_font_family_en(gt_obj_st * chat, gt_family_t font_family_en)
     _gt_chat_st * style = (_gt_chat_st * )chat;
     style->font_info.style_en = font_family_en;
     _gt_set_msg_param(chat, _SET_MSG_FONT_STYLE_EN);
+    _gt_chat_update_msg_size(chat);
 }
 
 void gt_chat_set_font_family_fl(gt_obj_st * chat, gt_family_t font_family_fl)
@@ -683,6 +1071,7 @@ void gt_chat_set_font_family_fl(gt_obj_st * chat, gt_family_t font_family_fl)
     _gt_chat_st * style = (_gt_chat_st * )chat;
     style->font_info.style_fl = font_family_fl;
     _gt_set_msg_param(chat, _SET_MSG_FONT_STYLE_FL);
+    _gt_chat_update_msg_size(chat);
 }
 
 void gt_chat_set_font_family_numb(gt_obj_st * chat, gt_family_t font_family_numb)
@@ -694,6 +1083,7 @@ void gt_chat_set_font_family_numb(gt_obj_st * chat, gt_family_t font_family_numb
     _gt_chat_st * style = (_gt_chat_st * )chat;
     style->font_info.style_numb = font_family_numb;
     _gt_set_msg_param(chat, _SET_MSG_FONT_STYLE_NUMB);
+    _gt_chat_update_msg_size(chat);
 }
 #else
 void gt_chat_set_font_family(gt_obj_st * chat, gt_family_t font_family)
@@ -714,6 +1104,7 @@ void gt_chat_set_font_cjk(gt_obj_st* chat, gt_font_cjk_et cjk)
     _gt_chat_st * style = (_gt_chat_st * )chat;
     style->font_info.cjk = cjk;
     _gt_set_msg_param(chat, _SET_MSG_FONT_CJK);
+    _gt_chat_update_msg_size(chat);
 }
 #endif
 void gt_chat_set_font_thick_en(gt_obj_st * chat, uint8_t thick)
@@ -744,6 +1135,7 @@ void gt_chat_set_font_style(gt_obj_st * chat, gt_font_style_et font_style)
     _gt_chat_st * style = (_gt_chat_st * )chat;
     style->font_info.style.all = font_style;
     _gt_set_msg_param(chat, _SET_MSG_FONT_STYLE);
+    _gt_chat_update_msg_size(chat);
 }
 
 void gt_chat_clean_all_msg(gt_obj_st * chat)
@@ -758,12 +1150,13 @@ void gt_chat_clean_all_msg(gt_obj_st * chat)
     chat->process_attr.scroll_prev.y = 0;
     _gt_chat_st * style = (_gt_chat_st * )chat;
 
-    style->msg_cnt = 0;
+    style->scroll_y = 0;
     style->msg_select_idx = -1;
     style->paly_idx = -1;
-    gt_memset_0(style->msg_list, sizeof(style->msg_list));
+    _free_msgs(style);
 
-    _gt_obj_class_destroy_children(chat);
+    /** keep the bubbles to be recycled */
+    _gt_chat_update_bubbles(chat, false);
     gt_event_send(chat, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 
@@ -774,12 +1167,56 @@ void gt_chat_set_msg_radius(gt_obj_st * chat, gt_radius_t radius)
     }
     _gt_chat_st * style = (_gt_chat_st * )chat;
     style->msg_radius = radius;
-    _gt_set_msg_param(chat, _SET_MSG_RADIUS);
-    _gt_chat_update_msg_size(chat);
+    _gt_chat_update_bubbles(chat, true);
     gt_event_send(chat, GT_EVENT_TYPE_DRAW_START, NULL);
 
 }
 
+void gt_chat_set_max_msg_count(gt_obj_st * chat, uint16_t cnt)
+{
+    if (false == gt_obj_is_type(chat, OBJ_TYPE)) {
+        return ;
+    }
+    _gt_chat_st * style = (_gt_chat_st * )chat;
+    style->max_msg_cnt = cnt;
+    if (0 == cnt || style->msg_cnt <= cnt) {
+        return ;
+    }
+    while (style->msg_cnt > cnt) {
+        _gt_msg_evict_oldest(style);
+    }
+    _gt_chat_scroll_to_bottom(chat);
+    gt_event_send(chat, GT_EVENT_TYPE_DRAW_START, NULL);
+}
+
+uint16_t gt_chat_get_max_msg_count(gt_obj_st * chat)
+{
+    if (false == gt_obj_is_type(chat, OBJ_TYPE)) {
+        return 0;
+    }
+    return ((_gt_chat_st * )chat)->max_msg_cnt;
+}
+
+uint16_t gt_chat_get_msg_count(gt_obj_st * chat)
+{
+    if (false == gt_obj_is_type(chat, OBJ_TYPE)) {
+        return 0;
+    }
+    return ((_gt_chat_st * )chat)->msg_cnt;
+}
+
+uint32_t gt_chat_get_msg_timestamp(gt_obj_st * chat, uint16_t idx)
+{
+    if (false == gt_obj_is_type(chat, OBJ_TYPE)) {
+        return 0;
+    }
+    _gt_chat_st * style = (_gt_chat_st * )chat;
+    if (idx >= style->msg_cnt) {
+        return 0;
+    }
+    return _get_msg(style, idx)->timestamp;
+}
+
 /* end of file ----------------------------------------------------------*/
 #endif /** GT_CFG_ENABLE_CHATTING */
 
@@ -23,7 +23,17 @@ extern "C" {
 
 
 /* define ---------------------------------------------------------------*/
-#define GT_CHAT_MAX_MSG_CNT    (20)
+#ifndef GT_CHAT_MAX_MSG_CNT
+    /**
+     * @brief The default maximum count of messages kept by the chat, the
+     *      oldest message is evicted when a new one is added into a full chat,
+     *      it can be changed by gt_chat_set_max_msg_count().
+     *      Only the bubbles within the view are created, so the messages
+     *      cost the text memory only.
+     *      [Default: 20] 0: unlimited (up to 0x7FFF messages)
+     */
+    #define GT_CHAT_MAX_MSG_CNT    (20)
+#endif
 
 
 
@@ -55,6 +65,33 @@ void gt_chat_clean_all_msg(gt_obj_st * chat);
 
 void gt_chat_set_msg_radius(gt_obj_st * chat, gt_radius_t radius);
 
+/**
+ * @brief Set the maximum count of messages, the oldest messages are
+ *      evicted when the count is exceeded.
+ *
+ * @param chat
+ * @param cnt 0: unlimited; default: GT_CHAT_MAX_MSG_CNT
+ */
+void gt_chat_set_max_msg_count(gt_obj_st * chat, uint16_t cnt);
+uint16_t gt_chat_get_max_msg_count(gt_obj_st * chat);
+
+/**
+ * @brief Get the count of messages in the chat
+ *
+ * @param chat
+ * @return uint16_t
+ */
+uint16_t gt_chat_get_msg_count(gt_obj_st * chat);
+
+/**
+ * @brief Get the tick when the message was added
+ *
+ * @param chat
+ * @param idx The index of message, 0: the oldest one
+ * @return uint32_t 0: invalid index
+ */
+uint32_t gt_chat_get_msg_timestamp(gt_obj_st * chat, uint16_t idx);
+
 void gt_chat_set_send_msg_bg_color(gt_obj_st * chat, gt_color_t color);
 void gt_chat_set_received_msg_bg_color(gt_obj_st * chat, gt_color_t color);
 void gt_chat_set_send_msg_border_color(gt_obj_st * chat, gt_color_t color);
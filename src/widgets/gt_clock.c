@@ -19,7 +19,8 @@
 #include "../core/gt_obj_pos.h"
 #include "../others/gt_log.h"
 #include "../core/gt_timer.h"
-#include "./gt_label.h"
+#include "../others/gt_area.h"
+#include "../others/gt_math.h"
 
 /* private define -------------------------------------------------------*/
 #define OBJ_TYPE    GT_TYPE_CLOCK
@@ -36,6 +37,9 @@
 #define _MAX_NEXT_DAY_BIT_WIDTH     4
 #define _MAX_ALERT_BIT_WIDTH        4
 
+/** The length of the meridiem string, such as: " AM" */
+#define _MERIDIEM_LEN               3
+
 #define _get_count_by_bit_width(_bit_width)     (1 << _bit_width)
 
 /* private typedef ------------------------------------------------------*/
@@ -66,10 +70,28 @@ typedef struct {
     void * sec_data;
 }_user_second_handler_st;
 
+/**
+ * @brief The formatted time string and the layout of its glyph cells,
+ *      the string is formatted once per tick instead of once per drawing.
+ */
+typedef struct _text_cache_s {
+    char * text;            /** The time string which is displayed */
+    char * text_new;        /** The time string of next tick, compared with text */
+    uint16_t * cell_x;      /** The x offset of each character cell from the beginning of text */
+    uint16_t cap;           /** The capacity of text and text_new, include '\0' */
+    uint16_t line_w;        /** The line width of text which is measured as draw_text() */
+    uint8_t line_pad;       /** The extra width reserved by draw_text() to split lines */
+    uint8_t digit_w[10];    /** The width of the digit cells '0' - '9', include space_x */
+    uint8_t metrics_valid: 1;   /** digit_w is measured by current font */
+    uint8_t cells_valid  : 1;   /** cell_x is measured by current font and text */
+    uint8_t text_dirty   : 1;   /** text must be formatted again before drawing */
+}_text_cache_st;
+
 typedef struct _gt_clock_s {
     gt_obj_st obj;
     gt_obj_st * label;    /** @ref gt_label.h */
     char * format;
+    _text_cache_st cache;
 
     _gt_timer_st * timer;
     _next_day_st ** next_day;
@@ -84,6 +106,7 @@ typedef struct _gt_clock_s {
     _user_second_handler_st user_sec_hd;
 
     _reg_st reg;
+    gt_align_et align;
 }_gt_clock_st;
 
 
@@ -164,38 +187,18 @@ static const char * _get_week_str(uint8_t week) {
     return _gt_weeks[week ? ((week % 8) - 1) : 0];
 }
 
-static GT_ATTRIBUTE_RAM_TEXT char * _get_time_str(_gt_clock_st * clock) {
+/**
+ * @brief Format the current time into the buffer
+ *
+ * @param clock
+ * @param str The buffer which capacity is clock->cache.cap
+ * @return uint16_t The length of the string
+ */
+static GT_ATTRIBUTE_RAM_TEXT uint16_t _format_time_str(_gt_clock_st * clock, char * str) {
     uint8_t hours = _get_hour(clock->time_current);
-    uint8_t meridiem_len = 3;
-    char * meridiem = NULL;
-    char * pointer = NULL;
-    char * str = NULL;
-    char * str_ptr = NULL;
-    uint8_t len = 0;
-
-    if (clock->reg.twinkle_colon) {
-        return NULL;
-    }
-
-    /** default */
-    if (NULL == clock->format) {
-        char * format_default = "hh:mm:ss";
-        len = strlen(format_default);
-
-        clock->format = gt_mem_malloc(len + 1);
-        if (NULL == clock->format) {
-            return NULL;
-        }
-        gt_memset(clock->format, 0, len + 1);
-        gt_memcpy(clock->format, format_default, len);
-    }
-
-    len = strlen(clock->format) + meridiem_len + 1;
-    str = gt_mem_malloc(len);
-    if (NULL == str) {
-        return str;
-    }
-    gt_memset(str, 0, len);
+    const char * meridiem = NULL;
+    const char * pointer = clock->format;
+    char * str_ptr = str;
 
     if (clock->reg.is_12_mode) {
         if (clock->reg.is_show_meridiem) {
@@ -206,8 +209,6 @@ static GT_ATTRIBUTE_RAM_TEXT char * _get_time_str(_gt_clock_st * clock) {
         }
     }
 
-    pointer = clock->format;
-    str_ptr = str;
     while (*pointer) {
         if (_is_contiune_same_char(pointer, 'h', 2)) {
             sprintf(str_ptr, "%02d", hours);
@@ -230,7 +231,8 @@ static GT_ATTRIBUTE_RAM_TEXT char * _get_time_str(_gt_clock_st * clock) {
             pointer += 2;
             str_ptr += 2;
         } else if (_is_contiune_same_char(pointer, 'y', 4)) {
-            sprintf(str_ptr, "%04d", _get_year(clock->time_current));
+            /** keep 4 cells, the buffer is sized by the format string */
+            sprintf(str_ptr, "%04d", _get_year(clock->time_current) % 10000);
             pointer += 4;
             str_ptr += 4;
         } else if (_is_contiune_same_char(pointer, 'E', 3)) {
@@ -242,10 +244,283 @@ static GT_ATTRIBUTE_RAM_TEXT char * _get_time_str(_gt_clock_st * clock) {
         }
     }
     if (meridiem) {
-        gt_memcpy(str_ptr, meridiem, meridiem_len);
+        gt_memcpy(str_ptr, meridiem, _MERIDIEM_LEN);
+        str_ptr += _MERIDIEM_LEN;
+    }
+    *str_ptr = '\0';
+
+    return (uint16_t)(str_ptr - str);
+}
+
+static void _text_cache_free(_gt_clock_st * style) {
+    if (style->cache.cell_x) {
+        gt_mem_free(style->cache.cell_x);
+    }
+    gt_memset(&style->cache, 0, sizeof(_text_cache_st));
+}
+
+/**
+ * @brief Resize the text buffers by the format string, the formatted string
+ *      is never longer than the format string except the meridiem.
+ *      [Warn] The place holder at the end of format may be consumed over
+ *      the terminator, so some extra bytes are reserved.
+ *
+ * @param style
+ * @return gt_res_t
+ */
+static gt_res_t _text_cache_reserve(_gt_clock_st * style) {
+    uint16_t cap = strlen(style->format) + _MERIDIEM_LEN + 4;
+    uint8_t * buf = NULL;
+
+    if (cap > style->cache.cap) {
+        /** [cell_x: cap][text: cap][text_new: cap] */
+        if (NULL == style->cache.cell_x) {
+            buf = (uint8_t * )gt_mem_malloc(cap * (sizeof(uint16_t) + 2));
+        } else {
+            buf = (uint8_t * )gt_mem_realloc(style->cache.cell_x, cap * (sizeof(uint16_t) + 2));
+        }
+        if (NULL == buf) {
+            return GT_RES_FAIL;
+        }
+        style->cache.cell_x = (uint16_t * )buf;
+        style->cache.text = (char * )&buf[cap * sizeof(uint16_t)];
+        style->cache.text_new = style->cache.text + cap;
+        style->cache.cap = cap;
+    }
+    style->cache.text[0] = '\0';
+    style->cache.cells_valid = 0;
+    style->cache.text_dirty = 1;
+    return GT_RES_OK;
+}
+
+/**
+ * @brief The font or the space has been changed, measure again when using
+ */
+static inline void _invalid_text_metrics(_gt_clock_st * style) {
+    style->cache.metrics_valid = 0;
+    style->cache.cells_valid = 0;
+}
+
+static void _get_text_font_info(_gt_clock_st * style, gt_font_info_st * info) {
+    *info = *gt_label_get_font_info(style->label);
+    gt_font_info_update_font_thick(info);
+}
+
+static inline bool _is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Measure the x offset of each character cell of the text, and the
+ *      digits once per font. The glyphs are measured the same as draw_text().
+ *
+ * @return true The text is single line and the cells are valid
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _update_text_cells(_gt_clock_st * style) {
+    _text_cache_st * cache = &style->cache;
+    uint32_t unicode = 0, line_w = 0;
+    uint16_t len = strlen(cache->text);
+    uint16_t i = 0, k = 0, x = 0, width = 0;
+    uint8_t byte_len = 0, space_x = 0, over_length = 0;
+    bool ret = false;
+    gt_font_st font = {
+        .utf8 = cache->text,
+        .len = len,
+    };
+
+    _get_text_font_info(style, &font.info);
+    font.info.gray = font.info.gray ? font.info.gray : 1;
+    space_x = gt_label_get_space_x(style->label) + (font.info.style.reg.bold ? 1 : 0);
+#if (defined(GT_FONT_FAMILY_OLD_ENABLE) && (GT_FONT_FAMILY_OLD_ENABLE == 1))
+    _gt_font_size_res_st font_size_res = gt_font_get_size_length_by_style(&font.info, 2, 0, 0);
+#else
+    _gt_font_size_res_st font_size_res = gt_font_get_size_length_by_style(&font.info, FONT_LAN_UNKNOWN, 0);
+#endif
+    font.res = gt_mem_malloc(font_size_res.font_per_size);
+    GT_CHECK_BACK_VAL(font.res, false);
+
+    if (!cache->metrics_valid) {
+        for (i = 0; i < 10; i++) {
+            gt_memset(font.res, 0, font_size_res.font_per_size);
+            width = gt_font_get_one_word_width('0' + i, &font) + space_x;
+            cache->digit_w[i] = width > 0xFF ? 0xFF : width;
+        }
+        cache->metrics_valid = 1;
     }
 
-    return str;
+    for (i = 0; i < len; i += byte_len) {
+        if ('\n' == cache->text[i]) {
+            goto _free_lb;
+        }
+        byte_len = gt_font_one_char_code_len_get((uint8_t * )&cache->text[i], &unicode, font.info.encoding);
+        if (0 == byte_len || i + byte_len > len) {
+            goto _free_lb;
+        }
+        for (k = 0; k < byte_len; k++) {
+            cache->cell_x[i + k] = x;
+        }
+        if (_is_digit(cache->text[i])) {
+            x += cache->digit_w[cache->text[i] - '0'];
+            continue;
+        }
+        gt_memset(font.res, 0, font_size_res.font_per_size);
+        x += gt_font_get_one_word_width(unicode, &font) + space_x;
+    }
+    cache->cell_x[len] = x;
+
+    /** The line width is not the sum of cells, which is used to align the text */
+    if (len != gt_font_split_line_str(&font, 0xFFFF, space_x, &line_w, NULL, NULL, NULL, &over_length, true)) {
+        goto _free_lb;
+    }
+    cache->line_w = line_w;
+    cache->line_pad = space_x + (font.info.style.reg.italic ? (font.info.size >> 1) : 0);
+    cache->cells_valid = 1;
+    ret = true;
+
+_free_lb:
+    gt_mem_free(font.res);
+    font.res = NULL;
+    return ret;
+}
+
+static gt_size_t _get_text_start_x(gt_align_et align, gt_area_st const * box_area, uint16_t text_w) {
+    switch (align) {
+        case GT_ALIGN_CENTER:
+        case GT_ALIGN_CENTER_MID:
+        case GT_ALIGN_CENTER_BOTTOM:
+            return box_area->x + ((box_area->w - text_w) >> 1);
+        case GT_ALIGN_RIGHT:
+        case GT_ALIGN_RIGHT_MID:
+        case GT_ALIGN_RIGHT_BOTTOM:
+            return box_area->x + box_area->w - text_w;
+        default:
+            break;
+    }
+    return box_area->x;
+}
+
+/**
+ * @brief The digits cells [first, last] of text have been replaced by text_new,
+ *      invalid the changed glyph cells only, such as the seconds digits.
+ *      When the digits width are different, the cells behind them (or the
+ *      whole line when aligned to center or right) are shifted too.
+ *
+ * @return true The cells have been invalidated,
+ *      false The whole object must be redrawn.
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _invalid_text_cells(gt_obj_st * obj, uint16_t first, uint16_t last) {
+    _gt_clock_st * style = (_gt_clock_st * )obj;
+    _text_cache_st * cache = &style->cache;
+    gt_area_st box_area = gt_area_reduce(obj->area, gt_obj_get_reduce(style->label));
+    gt_area_st area = obj->area;
+    uint16_t i = 0, len = strlen(cache->text);
+    uint16_t old_w = 0, new_w = 0, old_end = 0, new_end = 0;
+    gt_size_t old_x = 0, new_x = 0, x0 = 0, x1 = 0;
+
+    if (style->align & GT_ALIGN_REVERSE) {
+        return false;
+    }
+    for (i = first; i <= last; i++) {
+        if (!_is_digit(cache->text[i]) || !_is_digit(cache->text_new[i])) {
+            return false;
+        }
+    }
+    if (!cache->cells_valid && !_update_text_cells(style)) {
+        return false;
+    }
+
+    /** The cells in front of first are not changed */
+    old_end = cache->cell_x[last + 1];
+    new_end = cache->cell_x[first];
+    for (i = first; i <= last; i++) {
+        cache->cell_x[i] = new_end;
+        new_end += cache->digit_w[cache->text_new[i] - '0'];
+    }
+    for (i = last + 1; i <= len; i++) {
+        cache->cell_x[i] += new_end - old_end;
+    }
+    old_w = cache->line_w;
+    new_w = old_w + new_end - old_end;
+    cache->line_w = new_w;
+    if (old_w + cache->line_pad > box_area.w || new_w + cache->line_pad > box_area.w) {
+        /** multi-line */
+        return false;
+    }
+
+    old_x = _get_text_start_x(style->align, &box_area, old_w);
+    new_x = _get_text_start_x(style->align, &box_area, new_w);
+    if (old_x == new_x) {
+        x0 = new_x + cache->cell_x[first];
+    } else {
+        x0 = GT_MIN(old_x, new_x);
+    }
+    if (old_x + old_w == new_x + new_w) {
+        x1 = GT_MAX(old_x + old_end, new_x + new_end);
+    } else {
+        x1 = GT_MAX(old_x + cache->cell_x[len] - (new_end - old_end), new_x + cache->cell_x[len]);
+    }
+    area.x = x0;
+    area.w = x1 - x0;
+    gt_disp_invalid_sub_area(obj, &area);
+    return true;
+}
+
+/**
+ * @brief Format the time string of the tick, only the changed glyph
+ *      cells are redrawn.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _update_time_str(gt_obj_st * obj) {
+    _gt_clock_st * style = (_gt_clock_st * )obj;
+    _text_cache_st * cache = &style->cache;
+    uint16_t len = 0, first = 0, last = 0;
+
+    if (style->reg.twinkle_colon || NULL == cache->text || cache->text_dirty) {
+        gt_disp_invalid_area(obj);
+        return;
+    }
+    len = _format_time_str(style, cache->text_new);
+    while (cache->text_new[first] && cache->text_new[first] == cache->text[first]) {
+        ++first;
+    }
+    if (first == len && '\0' == cache->text[first]) {
+        /** nothing changed */
+        return;
+    }
+    if (len != strlen(cache->text)) {
+        gt_memcpy(cache->text, cache->text_new, len + 1);
+        cache->cells_valid = 0;
+        gt_disp_invalid_area(obj);
+        return;
+    }
+    last = len - 1;
+    while (last > first && cache->text_new[last] == cache->text[last]) {
+        --last;
+    }
+    if (false == _invalid_text_cells(obj, first, last)) {
+        cache->cells_valid = 0;
+        gt_disp_invalid_area(obj);
+    }
+    gt_memcpy(cache->text, cache->text_new, len + 1);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _draw_time_str(gt_obj_st * obj, _gt_clock_st * style) {
+    gt_font_st font = {
+        .res = NULL,
+        .utf8 = style->cache.text,
+        .len = strlen(style->cache.text),
+    };
+    gt_area_st box_area = gt_area_reduce(obj->area, gt_obj_get_reduce(style->label));
+    gt_attr_font_st font_attr = {
+        .font = &font,
+        .font_color = gt_label_get_font_color(style->label),
+        .space_x = gt_label_get_space_x(style->label),
+        .space_y = gt_label_get_space_y(style->label),
+        .align = style->align,
+        .opa = style->label->opa,
+        .logical_area = box_area,
+    };
+    _get_text_font_info(style, &font.info);
+    draw_text(obj->draw_ctx, &font_attr, &box_area);
 }
 
 static GT_ATTRIBUTE_RAM_TEXT void _draw_twinkle_colon_mode(gt_obj_st * obj, _gt_clock_st * style) {
@@ -288,22 +563,21 @@ static GT_ATTRIBUTE_RAM_TEXT void _draw_twinkle_colon_mode(gt_obj_st * obj, _gt_
 
 static void _init_cb(gt_obj_st * obj) {
     _gt_clock_st * style = (_gt_clock_st * )obj;
-    char * str = NULL;
     if (NULL == style->label) {
         return;
     }
     if (style->reg.twinkle_colon) {
         _draw_twinkle_colon_mode(obj, style);
-    } else {
-        str = _get_time_str(style);
+    } else if (style->cache.text) {
+        if (style->cache.text_dirty) {
+            _format_time_str(style, style->cache.text);
+            style->cache.text_dirty = 0;
+            style->cache.cells_valid = 0;
+        }
         gt_area_copy(&style->label->area, &obj->area);
-        gt_label_set_text(style->label, str);
+        _draw_time_str(obj, style);
     }
 
-    if (str) {
-        gt_mem_free(str);
-        str = NULL;
-    }
     draw_focus(obj , obj->radius);
 }
 
@@ -355,13 +629,17 @@ static void _deinit_cb(gt_obj_st * obj) {
         gt_mem_free(style->format);
         style->format = NULL;
     }
-
+    _text_cache_free(style);
 }
 
 static void _event_cb(struct gt_obj_s * obj, gt_event_st * e) {
     gt_event_type_et code_val = gt_event_get_code(e);
     switch (code_val) {
-        case GT_EVENT_TYPE_UPDATE_VALUE:
+        case GT_EVENT_TYPE_UPDATE_VALUE: {
+            _update_time_str(obj);
+            gt_event_send(obj, GT_EVENT_TYPE_DRAW_END, NULL);
+            break;
+        }
         case GT_EVENT_TYPE_DRAW_START: {
             gt_disp_invalid_area(obj);
             gt_event_send(obj, GT_EVENT_TYPE_DRAW_END, NULL);
@@ -488,6 +766,8 @@ gt_obj_st * gt_clock_create(gt_obj_st * parent)
     gt_obj_set_inside(style->label, true);
     style->label->focus_dis = GT_DISABLED;
     gt_label_set_text(style->label , "");
+    style->align = GT_ALIGN_LEFT;
+    gt_clock_set_format(obj, "hh:mm:ss");
 
     return obj;
 }
@@ -513,6 +793,7 @@ void gt_clock_set_time_by_timestamp(gt_obj_st * obj, uint32_t timestamp)
     _set_hour(clock->time_current, (timestamp / 3600) % 24);
     _set_minute(clock->time_current, (timestamp / 60) % 60);
     _set_second(clock->time_current, timestamp % 60);
+    clock->cache.text_dirty = 1;
 }
 
 void gt_clock_set_alert_time(gt_obj_st * obj, uint8_t hour, uint8_t minute, uint8_t second)
@@ -657,6 +938,7 @@ void gt_clock_set_12_hours_mode(gt_obj_st * obj, bool enabled)
     }
     _gt_clock_st * clock = (_gt_clock_st *)obj;
     clock->reg.is_12_mode = enabled ? 1 : 0;
+    clock->cache.text_dirty = 1;
 }
 
 bool gt_clock_get_12_hours_mode(gt_obj_st * obj)
@@ -675,6 +957,7 @@ void gt_clock_set_meridiem_mode(gt_obj_st * obj, bool enabled)
     }
     _gt_clock_st * clock = (_gt_clock_st *)obj;
     clock->reg.is_show_meridiem = enabled ? 1 : 0;
+    clock->cache.text_dirty = 1;
 }
 
 bool gt_clock_get_meridiem_mode(gt_obj_st * obj)
@@ -691,26 +974,23 @@ void gt_clock_set_format(gt_obj_st * obj, const char * const format)
     if (false == gt_obj_is_type(obj, OBJ_TYPE)) {
         return;
     }
+    GT_CHECK_BACK(format);
     _gt_clock_st * clock = (_gt_clock_st *)obj;
-    if (NULL == clock->format) {
-        clock->format = (char * )gt_mem_malloc(strlen(format) + 1);
-        GT_CHECK_BACK(clock->format);
-        gt_memset(clock->format, 0, strlen(format) + 1);
-        gt_memcpy(clock->format, format, strlen(format));
-        return;
-    }
+    uint16_t len = strlen(format);
+    char * buf = NULL;
 
-    if (strlen(format) < strlen(clock->format)) {
-        gt_memset(clock->format, 0, strlen(clock->format) + 1);
-        gt_memcpy(clock->format, format, strlen(format));
-        return;
+    if (NULL == clock->format || len > strlen(clock->format)) {
+        if (NULL == clock->format) {
+            buf = (char * )gt_mem_malloc(len + 1);
+        } else {
+            buf = (char * )gt_mem_realloc(clock->format, len + 1);
+        }
+        GT_CHECK_BACK(buf);
+        clock->format = buf;
     }
+    gt_memcpy(clock->format, format, len + 1);
 
-    clock->format = (char * )gt_mem_realloc(clock->format, strlen(format) + 1);
-    GT_CHECK_BACK(clock->format);
-
-    gt_memset(clock->format, 0, strlen(clock->format) + 1);
-    gt_memcpy(clock->format, format, strlen(format));
+    _text_cache_reserve(clock);
 }
 
 void gt_clock_set_next_day_cb(gt_obj_st * obj, gt_clock_next_day_cb next_day_cb, void * user_data)
@@ -941,6 +1221,7 @@ void gt_clock_set_font_size(gt_obj_st * obj, uint8_t size)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_size(style->label, size);
 }
 
@@ -953,6 +1234,7 @@ void gt_clock_set_font_gray(gt_obj_st * obj, uint8_t gray)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_gray(style->label, gray);
 }
 
@@ -965,6 +1247,7 @@ void gt_clock_set_font_align(gt_obj_st * obj, gt_align_et align)
     if (NULL == style->label) {
         return;
     }
+    style->align = align;
     gt_label_set_font_align(style->label, align);
 }
 #if (defined(GT_FONT_FAMILY_OLD_ENABLE) && (GT_FONT_FAMILY_OLD_ENABLE == 1))
@@ -977,6 +1260,7 @@ void gt_clock_set_font_family_cn(gt_obj_st * obj, gt_family_t family)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_family_cn(style->label, family);
 }
 
@@ -989,6 +1273,7 @@ void gt_clock_set_font_family_en(gt_obj_st * obj, gt_family_t family)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_family_en(style->label, family);
 }
 
@@ -1001,6 +1286,7 @@ void gt_clock_set_font_family_fl(gt_obj_st * obj, gt_family_t family)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_family_fl(style->label, family);
 }
 
@@ -1013,6 +1299,7 @@ void gt_clock_set_font_family_numb(gt_obj_st * obj, gt_family_t family)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_family_numb(style->label, family);
 }
 #else
@@ -1025,6 +1312,7 @@ void gt_clock_set_font_family(gt_obj_st * obj, gt_family_t family)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_family(style->label, family);
 }
 
@@ -1037,6 +1325,7 @@ void gt_clock_set_font_cjk(gt_obj_st* obj, gt_font_cjk_et cjk)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_cjk(style->label, cjk);
 }
 #endif
@@ -1049,6 +1338,7 @@ void gt_clock_set_font_thick_en(gt_obj_st * obj, uint8_t thick)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_thick_en(style->label, thick);
 }
 
@@ -1061,6 +1351,7 @@ void gt_clock_set_font_thick_cn(gt_obj_st * obj, uint8_t thick)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_thick_cn(style->label, thick);
 }
 
@@ -1073,6 +1364,7 @@ void gt_clock_set_font_style(gt_obj_st * obj, gt_font_style_et font_style)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_font_style(style->label, font_style);
 }
 
@@ -1085,6 +1377,7 @@ void gt_clock_set_space(gt_obj_st * obj, uint8_t space_x, uint8_t space_y)
     if (NULL == style->label) {
         return;
     }
+    _invalid_text_metrics(style);
     gt_label_set_space(style->label, space_x , space_y);
 }
 
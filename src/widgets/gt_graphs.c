@@ -28,6 +28,9 @@
 
 #define _GRAPHS_DEFAULT_FONT_SPACE_LINE     8
 
+/** The first capacity of the series points or the pixel columns cache */
+#define _GRAPHS_MIN_CAPACITY                8
+
 
 /* private typedef ------------------------------------------------------*/
 typedef struct _graphs_reg_s {
@@ -36,6 +39,7 @@ typedef struct _graphs_reg_s {
     uint8_t anti_hor_axis_dir : 1;
     uint8_t anti_ver_axis_dir : 1;
     uint8_t full_area : 1;
+    uint8_t fifo_scroll : 1;    /** fifo mode: all of the series are scrolled together by the view */
 }_graphs_reg_st;
 
 typedef struct _gt_graphs_s {
@@ -43,6 +47,7 @@ typedef struct _gt_graphs_s {
     _gt_attr_graphs_st gp;
     gt_color_t font_color;
     gt_font_info_st font_info;
+    uint32_t fifo_seq;          /** fifo mode: The sequence of the oldest point of view, @ref fifo_scroll */
     uint16_t fifo_depth;        /** 0[default]: not use fifo mode */
     uint8_t font_align;         //@ref gt_align_et
     uint8_t custom_padding;
@@ -55,9 +60,50 @@ typedef struct _graph_css_s {
     gt_point_st total;
     gt_point_st start;
     gt_point_st end;
+    gt_size_t fifo_base;        /** fifo mode: The x of the oldest point */
+    gt_size_t fifo_span;        /** fifo mode: The pixels from the oldest point to the latest point when full */
     _graphs_reg_st reg;
 }_graph_css_st;
 
+/**
+ * @brief The continuous points which are located at the same pixel column,
+ *      the coordinates are relative to the object.
+ */
+typedef struct _series_column_s {
+    gt_size_t x;
+    gt_size_t first;    /** y of the first point */
+    gt_size_t last;     /** y of the last point */
+    gt_size_t min;      /** min y of the points before the last one, min > max: only one point */
+    gt_size_t max;
+    uint16_t count;     /** The count of points */
+}_series_column_st;
+
+/**
+ * @brief The pixel columns of a series, thousands of points can be drawn
+ *      column by column instead of segment by segment.
+ */
+typedef struct _gt_series_cache_s {
+    _graph_css_st css;          /** The coordinates which the columns calculated by, relative to the object */
+    _series_column_st * columns;
+    uint32_t seq;               /** fifo mode: The sequence of the first point merged */
+    uint32_t frame;             /** fifo mode: The view sequence which the x of columns is relative to */
+    gt_size_t shift;            /** fifo mode: The x offset from the frame to the current view */
+    uint16_t first;             /** The first column, the columns before it are dropped with the points */
+    uint16_t count;
+    uint16_t capacity;
+    uint16_t count_point;       /** The count of points which have been merged into columns */
+    uint8_t valid : 1;
+}_gt_series_cache_st;
+
+/**
+ * @brief The way to refresh the fifo graph after points appended
+ */
+typedef enum {
+    _FIFO_VIEW_SCROLL = 0,  /** The view is moved, all of the series are scrolled together */
+    _FIFO_VIEW_REDRAW,      /** The whole graph need to be redrawn */
+    _FIFO_VIEW_LATEST,      /** Only the latest points need to be redrawn */
+}_fifo_view_em;
+
 typedef void ( * _draw_ruler_pos_area_t)(gt_obj_st * , gt_padding_st const * const, gt_attr_font_st * );
 
 /* static variables -----------------------------------------------------*/
@@ -89,6 +135,135 @@ static inline bool _is_ver_range_zero(_gt_graphs_st const * const style) {
     return style->gp.axis.ver.end == style->gp.axis.ver.start;
 }
 
+static inline gt_series_value_t _to_series_value(gt_float_t value) {
+#if GT_GRAPHS_USE_FIXED_POINT
+    gt_float_t fixed = value * (1 << GT_GRAPHS_FIXED_POINT_SHIFT);
+    if (fixed >= 32767) { return 32767; }
+    if (fixed <= -32768) { return -32768; }
+    return (gt_series_value_t)(fixed < 0 ? fixed - 0.5f : fixed + 0.5f);
+#else
+    return value;
+#endif
+}
+
+static inline gt_float_t _from_series_value(gt_series_value_t value) {
+#if GT_GRAPHS_USE_FIXED_POINT
+    return (gt_float_t)value / (1 << GT_GRAPHS_FIXED_POINT_SHIFT);
+#else
+    return value;
+#endif
+}
+
+/**
+ * @brief Get the ring buffer index of the point
+ *
+ * @param series
+ * @param idx The index of the point, 0: the oldest point
+ * @return uint16_t
+ */
+static inline uint16_t _ring_index(gt_series_points_st const * const series, uint16_t idx) {
+    uint32_t pos = (uint32_t)series->head + idx;
+    return pos >= series->capacity ? pos - series->capacity : pos;
+}
+
+static inline uint16_t _fifo_get_div(_gt_graphs_st const * const style) {
+    return style->fifo_depth > 1 ? style->fifo_depth - 1 : 1;
+}
+
+/**
+ * @brief Not the absolute position of the screen display position,
+ *      but the display value of the x-axis, using by the fifo mode.
+ *
+ * @param style
+ * @param index The fifo depth index
+ * @return gt_float_t
+ */
+static inline gt_float_t _fifo_calc_average_x_pos(_gt_graphs_st * style, uint16_t index) {
+    uint16_t div = _fifo_get_div(style);
+    return (gt_float_t)(index * (style->reg.anti_hor_axis_dir ?
+        style->gp.axis.hor.start - style->gp.axis.hor.end : style->gp.axis.hor.end - style->gp.axis.hor.start) / div);
+}
+
+/**
+ * @brief The pixels which are moved from the sequence seq to seq + count. The x of
+ *      a point is the same whichever view it is calculated from, so that all of the
+ *      points are moved by whole pixels when the view is scrolled.
+ *
+ * @param css
+ * @param div The count of steps of the fifo
+ * @param seq
+ * @param count The count of steps, which can be negative
+ * @return int32_t
+ */
+static inline int32_t _fifo_calc_pixel_delta(_graph_css_st const * const css, uint16_t div, uint32_t seq, int32_t count) {
+    int32_t phase = (int32_t)(seq % div);
+    int32_t n = phase + count;
+    int32_t q = n / div, r = n % div;
+    if (r < 0) {
+        r += div;
+        --q;
+    }
+    return q * css->fifo_span + r * css->fifo_span / div - phase * css->fifo_span / div;
+}
+
+/**
+ * @brief Get the sequence of view which the series is drawn by,
+ *      the series ahead of the view is drawn by itself.
+ */
+static inline uint32_t _fifo_get_view_seq(_gt_graphs_st const * const style, gt_series_points_st const * const series) {
+    if (style->reg.fifo_scroll && NULL == series->x_series && (int32_t)(style->fifo_seq - series->fifo_seq) >= 0) {
+        return style->fifo_seq;
+    }
+    return series->fifo_seq;
+}
+
+/**
+ * @brief Get the index of the first point within the view, the oldest points of
+ *      the series which is behind the view are out of the x-axis range.
+ */
+static inline uint16_t _get_first_visible(_gt_graphs_st const * const style, gt_series_points_st const * const series) {
+    uint32_t behind = _fifo_get_view_seq(style, series) - series->fifo_seq;
+    return behind < series->count_point ? behind : series->count_point;
+}
+
+static inline gt_float_t _get_point_x(_gt_graphs_st * style, gt_series_points_st const * const series, uint16_t idx) {
+    if (NULL == series->x_series) {
+        return _fifo_calc_average_x_pos(style, idx);
+    }
+    return _from_series_value(series->x_series[_ring_index(series, idx)]);
+}
+
+static inline gt_float_t _get_point_y(gt_series_points_st const * const series, uint16_t idx) {
+    return _from_series_value(series->y_series[_ring_index(series, idx)]);
+}
+
+static inline gt_size_t _get_brush_size(gt_line_st const * const line) {
+    return (line->width ? line->width : 4) + 1;
+}
+
+/**
+ * @brief The box is intersected with the band which is being drawn or not
+ *
+ * @param draw_ctx
+ * @param x0 left, x0 <= x1
+ * @param y0 top, y0 <= y1
+ * @param x1 right
+ * @param y1 bottom
+ * @return true
+ * @return false
+ */
+static inline bool _is_box_in_band(_gt_draw_ctx_st const * const draw_ctx, gt_size_t x0, gt_size_t y0, gt_size_t x1, gt_size_t y1) {
+    gt_area_st const * band = &draw_ctx->buf_area;
+    return x1 >= band->x && x0 < band->x + band->w && y1 >= band->y && y0 < band->y + band->h;
+}
+
+static inline bool _is_segment_in_band(_gt_draw_ctx_st const * const draw_ctx,
+    gt_point_st const * const start, gt_point_st const * const end, gt_size_t expand) {
+    return _is_box_in_band(draw_ctx,
+        GT_MIN(start->x, end->x) - expand, GT_MIN(start->y, end->y) - expand,
+        GT_MAX(start->x, end->x) + expand, GT_MAX(start->y, end->y) + expand);
+}
+
 
 
 /* class ----------------------------------------------------------------*/
@@ -129,7 +304,7 @@ static void _graphs_init_cb(gt_obj_st * obj) {
 
 static GT_ATTRIBUTE_RAM_TEXT void _free_series_line_points(gt_series_points_st * series) {
     if (series->point_value_str) {
-        for (gt_size_t i = series->count_point - 1; i >= 0; --i) {
+        for (uint16_t i = 0; i < series->capacity; ++i) {
             if (series->point_value_str[i]) {
                 gt_mem_free(series->point_value_str[i]);
             }
@@ -138,6 +313,13 @@ static GT_ATTRIBUTE_RAM_TEXT void _free_series_line_points(gt_series_points_st *
         gt_mem_free(series->point_value_str);
         series->point_value_str = NULL;
     }
+    if (series->cache) {
+        if (series->cache->columns) {
+            gt_mem_free(series->cache->columns);
+        }
+        gt_mem_free(series->cache);
+        series->cache = NULL;
+    }
     if (series->y_series) {
         gt_mem_free(series->y_series);
         series->y_series = NULL;
@@ -147,6 +329,9 @@ static GT_ATTRIBUTE_RAM_TEXT void _free_series_line_points(gt_series_points_st *
         series->x_series = NULL;
     }
     series->count_point = 0;
+    series->capacity = 0;
+    series->head = 0;
+    series->fifo_seq = 0;
 }
 
 static GT_ATTRIBUTE_RAM_TEXT void _free_all_series_lines(gt_series_points_st * series) {
@@ -230,11 +415,13 @@ static GT_ATTRIBUTE_RAM_TEXT void _calc_self_adaptive_axis_range(gt_obj_st * obj
     uint16_t max_count = 0;
 
     while (ptr) {
-        for (gt_size_t i = 0; i < ptr->count_point; ++i) {
-            min.x = GT_MIN(min.x, (gt_size_t)ptr->x_series[i]);
-            min.y = GT_MIN(min.y, (gt_size_t)ptr->y_series[i]);
-            max.x = GT_MAX(max.x, (gt_size_t)ptr->x_series[i]);
-            max.y = GT_MAX(max.y, (gt_size_t)ptr->y_series[i]);
+        for (uint16_t i = 0; i < ptr->count_point; ++i) {
+            gt_size_t x = (gt_size_t)_get_point_x(style, ptr, i);
+            gt_size_t y = (gt_size_t)_get_point_y(ptr, i);
+            min.x = GT_MIN(min.x, x);
+            min.y = GT_MIN(min.y, y);
+            max.x = GT_MAX(max.x, x);
+            max.y = GT_MAX(max.y, y);
         }
         if (ptr->count_point > max_count) {
             max_count = ptr->count_point;
@@ -449,20 +636,6 @@ static inline gt_point_st _get_axis_scale_total_range(_gt_graphs_st * style) {
     };
     return scale_range;
 }
-/**
- * @brief Not the absolute position of the screen display position,
- *      but the display value of the x-axis, using by the fifo mode.
- *
- * @param style
- * @param index The fifo depth index
- * @return gt_float_t
- */
-static inline gt_float_t _fifo_calc_average_x_pos(_gt_graphs_st * style, uint16_t index) {
-    uint16_t div = style->fifo_depth > 1 ? style->fifo_depth - 1 : 1;
-    return (gt_float_t)(index * (style->reg.anti_hor_axis_dir ?
-        style->gp.axis.hor.start - style->gp.axis.hor.end : style->gp.axis.hor.end - style->gp.axis.hor.start) / div);
-}
-
 static inline gt_point_st _get_start_value_by(_gt_graphs_st * style) {
     gt_point_st start_val = { .x = style->gp.axis.hor.start, .y = style->gp.axis.ver.start };
     return start_val;
@@ -483,15 +656,53 @@ static inline gt_size_t _calc_abs_point_y(gt_float_t p, _graph_css_st const * co
     return offset * css->range.y / css->total.y + css->padding.top;
 }
 
+/**
+ * @brief Calculate the position of point
+ *
+ * @param style
+ * @param ptr
+ * @param idx
+ * @param css
+ * @param view_seq fifo mode: The sequence of view which the x is relative to
+ * @return gt_point_st
+ */
+static inline gt_point_st _calc_point_pos_by(_gt_graphs_st * style, gt_series_points_st const * const ptr,
+    uint16_t idx, _graph_css_st const * const css, uint32_t view_seq) {
+    gt_point_st pos = {
+        .y = _calc_abs_point_y(_get_point_y(ptr, idx), css),
+    };
+    if (NULL == ptr->x_series) {
+        pos.x = css->fifo_base + _fifo_calc_pixel_delta(css, _fifo_get_div(style), view_seq, (int32_t)(ptr->fifo_seq - view_seq) + idx);
+    } else {
+        pos.x = _calc_abs_point_x(_get_point_x(style, ptr, idx), css);
+    }
+    return pos;
+}
+
+static inline gt_point_st _calc_point_pos(
+    _gt_graphs_st * style, gt_series_points_st const * const ptr, uint16_t idx, _graph_css_st const * const css) {
+    return _calc_point_pos_by(style, ptr, idx, css, _fifo_get_view_seq(style, ptr));
+}
+
 static inline void _draw_point_by(
-    gt_obj_st * obj, gt_series_points_st const * const ptr, gt_size_t idx, _graph_css_st const * const css) {
+    gt_obj_st * obj, gt_series_points_st const * const ptr, uint16_t idx, _graph_css_st const * const css) {
     gt_attr_point_st point_attr = { .line = ptr->line };
-    point_attr.pos.x = _calc_abs_point_x(ptr->x_series[idx], css);
-    point_attr.pos.y = _calc_abs_point_y(ptr->y_series[idx], css);
+    gt_size_t expand = _get_brush_size(&ptr->line);
+    point_attr.pos = _calc_point_pos((_gt_graphs_st *)obj, ptr, idx, css);
+    if (false == _is_segment_in_band(obj->draw_ctx, &point_attr.pos, &point_attr.pos, expand)) {
+        return;
+    }
     gt_draw_point(obj->draw_ctx, &point_attr, &obj->area);
 }
 
-static GT_ATTRIBUTE_RAM_TEXT _graph_css_st _get_css(gt_obj_st * obj) {
+static inline void _draw_segment_by(gt_obj_st * obj, gt_attr_line_st const * const line_attr, gt_size_t expand) {
+    if (false == _is_segment_in_band(obj->draw_ctx, &line_attr->start, &line_attr->end, expand)) {
+        return;
+    }
+    gt_draw_line(obj->draw_ctx, line_attr, &obj->area);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT _graph_css_st _get_css_relative(gt_obj_st * obj) {
     _gt_graphs_st * style = (_gt_graphs_st *)obj;
     _graph_css_st css = {
         .padding = _get_padding_by(obj),
@@ -501,95 +712,370 @@ static GT_ATTRIBUTE_RAM_TEXT _graph_css_st _get_css(gt_obj_st * obj) {
         .end   = _get_end_value_by(style),
         .reg   = style->reg,
     };
+    css.fifo_base = _calc_abs_point_x(_fifo_calc_average_x_pos(style, 0), &css);
+    css.fifo_span = _calc_abs_point_x(_fifo_calc_average_x_pos(style, _fifo_get_div(style)), &css) - css.fifo_base;
+    return css;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT _graph_css_st _get_css(gt_obj_st * obj) {
+    _graph_css_st css = _get_css_relative(obj);
     css.padding = _add_obj_offset_padding(&css.padding, obj);
+    css.fifo_base += obj->area.x;
     return css;
 }
 
+static inline bool _is_css_equal(_graph_css_st const * const a, _graph_css_st const * const b) {
+    return a->padding.left == b->padding.left && a->padding.top == b->padding.top &&
+        a->range.x == b->range.x && a->range.y == b->range.y &&
+        a->total.x == b->total.x && a->total.y == b->total.y &&
+        a->start.x == b->start.x && a->start.y == b->start.y &&
+        a->end.x == b->end.x && a->end.y == b->end.y &&
+        a->fifo_base == b->fifo_base && a->fifo_span == b->fifo_span &&
+        a->reg.anti_hor_axis_dir == b->reg.anti_hor_axis_dir &&
+        a->reg.anti_ver_axis_dir == b->reg.anti_ver_axis_dir;
+}
+
+static inline void _series_cache_invalid(gt_series_points_st * series) {
+    if (series->cache) {
+        series->cache->valid = false;
+    }
+}
+
+static GT_ATTRIBUTE_RAM_TEXT gt_res_t _series_cache_push(_gt_series_cache_st * cache, gt_point_st const * const pos) {
+    _series_column_st * col = cache->count > cache->first ? &cache->columns[cache->count - 1] : NULL;
+    if (col && col->x == pos->x) {
+        col->min = GT_MIN(col->min, col->last);
+        col->max = GT_MAX(col->max, col->last);
+        col->last = pos->y;
+        ++col->count;
+        return GT_RES_OK;
+    }
+    if (cache->count == cache->capacity && cache->first) {
+        /** reuse the space of the dropped columns */
+        cache->count -= cache->first;
+        gt_memmove(cache->columns, &cache->columns[cache->first], cache->count * sizeof(_series_column_st));
+        cache->first = 0;
+    }
+    if (cache->count == cache->capacity) {
+        uint32_t capacity = cache->capacity ? cache->capacity + (cache->capacity >> 1) : _GRAPHS_MIN_CAPACITY;
+        _series_column_st * columns = NULL;
+        if (capacity > 0xFFFF) {
+            capacity = 0xFFFF;
+        }
+        if (capacity == cache->capacity) {
+            return GT_RES_FAIL;
+        }
+        if (cache->columns) {
+            columns = gt_mem_realloc(cache->columns, capacity * sizeof(_series_column_st));
+        } else {
+            columns = gt_mem_malloc(capacity * sizeof(_series_column_st));
+        }
+        if (NULL == columns) {
+            return GT_RES_FAIL;
+        }
+        cache->columns = columns;
+        cache->capacity = capacity;
+    }
+    col = &cache->columns[cache->count++];
+    col->x = pos->x;
+    col->first = pos->y;
+    col->last = pos->y;
+    col->min = 0x7fff;
+    col->max = -0x7fff;
+    col->count = 1;
+    return GT_RES_OK;
+}
+
+/**
+ * @brief Recalculate the first column whose older points have been dropped
+ *
+ * @param style
+ * @param series
+ * @param cache
+ * @param count The count of the points remained in the column
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _series_column_calc(_gt_graphs_st * style, gt_series_points_st const * const series,
+    _gt_series_cache_st * cache, uint16_t count) {
+    _series_column_st * col = &cache->columns[cache->first];
+    uint16_t base = cache->seq - series->fifo_seq;
+    gt_point_st pos = {0};
+
+    for (uint16_t i = 0; i < count; ++i) {
+        pos = _calc_point_pos_by(style, series, base + i, &cache->css, cache->frame);
+        if (0 == i) {
+            col->first = pos.y;
+            col->min = 0x7fff;
+            col->max = -0x7fff;
+        } else {
+            col->min = GT_MIN(col->min, col->last);
+            col->max = GT_MAX(col->max, col->last);
+        }
+        col->last = pos.y;
+    }
+    col->count = count;
+}
+
+/**
+ * @brief Drop the columns of the points which have been dropped by the fifo
+ *
+ * @param style
+ * @param series
+ * @param cache
+ * @param drop The count of points dropped since the last update
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _series_cache_drop(_gt_graphs_st * style, gt_series_points_st const * const series,
+    _gt_series_cache_st * cache, uint16_t drop) {
+    uint16_t remain = drop;
+    _series_column_st * col = NULL;
+
+    cache->seq += drop;
+    cache->count_point -= drop;
+    while (remain && cache->first < cache->count) {
+        col = &cache->columns[cache->first];
+        if (remain < col->count) {
+            _series_column_calc(style, series, cache, col->count - remain);
+            break;
+        }
+        remain -= col->count;
+        ++cache->first;
+    }
+    if (cache->first == cache->count) {
+        cache->first = 0;
+        cache->count = 0;
+    }
+}
+
+/**
+ * @brief Merge the points which have not been merged into the pixel columns,
+ *      only the appended points are calculated when the axis is not changed.
+ *
+ * @param obj
+ * @param series
+ * @return _gt_series_cache_st* NULL: memory not enough
+ */
+static GT_ATTRIBUTE_RAM_TEXT _gt_series_cache_st * _series_cache_update(gt_obj_st * obj, gt_series_points_st * series) {
+    _gt_graphs_st * style = (_gt_graphs_st *)obj;
+    _graph_css_st css = _get_css_relative(obj);
+    _gt_series_cache_st * cache = series->cache;
+    uint32_t view_seq = _fifo_get_view_seq(style, series);
+    uint32_t drop = 0;
+    uint16_t first = _get_first_visible(style, series);
+    uint16_t visible = series->count_point - first;
+    gt_point_st pos = {0};
+
+    if (NULL == cache) {
+        cache = gt_mem_malloc(sizeof(_gt_series_cache_st));
+        if (NULL == cache) {
+            return NULL;
+        }
+        gt_memset(cache, 0, sizeof(_gt_series_cache_st));
+        series->cache = cache;
+    }
+    /** The cached points begin at the first visible point */
+    drop = series->fifo_seq + first - cache->seq;
+    if (false == cache->valid || false == _is_css_equal(&cache->css, &css) ||
+        drop > cache->count_point || cache->count_point - drop > visible) {
+        cache->css = css;
+        cache->seq = series->fifo_seq + first;
+        cache->frame = view_seq;
+        cache->first = 0;
+        cache->count = 0;
+        cache->count_point = 0;
+        cache->valid = true;
+        drop = 0;
+    }
+    if (drop) {
+        _series_cache_drop(style, series, cache, drop);
+    }
+    /** The columns are kept relative to the view where they are calculated */
+    cache->shift = 0;
+    if (NULL == series->x_series) {
+        int32_t shift = _fifo_calc_pixel_delta(&css, _fifo_get_div(style), cache->frame, (int32_t)(view_seq - cache->frame));
+        if (gt_abs(shift) > css.range.x) {
+            for (uint16_t i = cache->first; i < cache->count; ++i) {
+                cache->columns[i].x -= shift;
+            }
+            cache->frame = view_seq;
+            shift = 0;
+        }
+        cache->shift = shift;
+    }
+    for (uint16_t i = cache->count_point; i < visible; ++i) {
+        pos = _calc_point_pos_by(style, series, first + i, &cache->css, cache->frame);
+        if (GT_RES_OK != _series_cache_push(cache, &pos)) {
+            cache->valid = false;
+            return NULL;
+        }
+    }
+    cache->count_point = visible;
+    return cache;
+}
+
+/**
+ * @brief Draw the line column by column, the points of a column are drawn
+ *      by one vertical line from the min to the max value, which covers
+ *      the same pixels as the segments between them.
+ *
+ * @param obj
+ * @param ptr
+ * @return true The series has been drawn
+ * @return false The pixel columns are unavailable
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _graphs_draw_line_columns(gt_obj_st * obj, gt_series_points_st * const ptr) {
+    gt_attr_line_st line_attr = { .line = ptr->line };
+    _gt_series_cache_st * cache = _series_cache_update(obj, ptr);
+    _series_column_st const * col = NULL, * next = NULL;
+    gt_size_t expand = _get_brush_size(&ptr->line);
+    gt_size_t min = 0, max = 0;
+
+    if (NULL == cache) {
+        return false;
+    }
+    for (uint16_t i = cache->first; i < cache->count; ++i) {
+        col = &cache->columns[i];
+        next = i + 1 < cache->count ? &cache->columns[i + 1] : NULL;
+        if (col->min <= col->max) {
+            min = GT_MIN(col->min, col->last);
+            max = GT_MAX(col->max, col->last);
+            if (NULL == next) {
+                /** The end point of the line is not drawn by segment */
+                if (col->last < col->min) { min = col->last + 1; }
+                if (col->last > col->max) { max = col->last - 1; }
+            }
+            line_attr.start.x = obj->area.x + col->x - cache->shift;
+            line_attr.start.y = obj->area.y + min;
+            line_attr.end.x = line_attr.start.x;
+            line_attr.end.y = obj->area.y + max + 1;
+            _draw_segment_by(obj, &line_attr, expand);
+        }
+        if (NULL == next) {
+            break;
+        }
+        line_attr.start.x = obj->area.x + col->x - cache->shift;
+        line_attr.start.y = obj->area.y + col->last;
+        line_attr.end.x = obj->area.x + next->x - cache->shift;
+        line_attr.end.y = obj->area.y + next->first;
+        _draw_segment_by(obj, &line_attr, expand);
+    }
+    return true;
+}
+
 static GT_ATTRIBUTE_RAM_TEXT void _graphs_draw_points(gt_obj_st * obj, gt_series_points_st const * const ptr) {
     _graph_css_st css = _get_css(obj);
+    uint16_t first = _get_first_visible((_gt_graphs_st *)obj, ptr);
 
-    for (gt_size_t i = 0; i < ptr->count_point; ++i) {
+    for (uint16_t i = first; i < ptr->count_point; ++i) {
         _draw_point_by(obj, ptr, i, &css);
     }
 }
 
-static GT_ATTRIBUTE_RAM_TEXT void _graphs_draw_line(gt_obj_st * obj, gt_series_points_st const * const ptr) {
+static GT_ATTRIBUTE_RAM_TEXT void _graphs_draw_line(gt_obj_st * obj, gt_series_points_st * const ptr) {
+    _gt_graphs_st * style = (_gt_graphs_st *)obj;
     gt_attr_line_st line_attr = { .line = ptr->line };
     _graph_css_st css = _get_css(obj);
+    gt_size_t expand = _get_brush_size(&ptr->line);
+    uint16_t first = _get_first_visible(style, ptr);
+    uint16_t count = ptr->count_point;
 
-    if (0 == ptr->count_point) {
+    if (first == count) {
         return;
-    } else if (1 == ptr->count_point) {
-        _draw_point_by(obj, ptr, 0, &css);
+    } else if (first + 1 == count) {
+        _draw_point_by(obj, ptr, first, &css);
         return;
     }
-    line_attr.end.x = _calc_abs_point_x(ptr->x_series[0], &css);
-    line_attr.end.y = _calc_abs_point_y(ptr->y_series[0], &css);
-    for (gt_size_t i = 1; i < ptr->count_point; ++i) {
+    /** More points than pixel columns */
+    if (count > css.range.x && _graphs_draw_line_columns(obj, ptr)) {
+        return;
+    }
+    line_attr.end = _calc_point_pos(style, ptr, first, &css);
+    for (uint16_t i = first + 1; i < count; ++i) {
         line_attr.start = line_attr.end;
-        line_attr.end.x = _calc_abs_point_x(ptr->x_series[i], &css);
-        line_attr.end.y = _calc_abs_point_y(ptr->y_series[i], &css);
-        gt_draw_line(obj->draw_ctx, &line_attr, &obj->area);
+        line_attr.end = _calc_point_pos(style, ptr, i, &css);
+        _draw_segment_by(obj, &line_attr, expand);
     }
 }
 
+/**
+ * @brief The catmull-rom curve may be out of the box of its control points
+ *      slightly, expand a quarter of the box size.
+ */
+static inline bool _is_curve_in_band(_gt_draw_ctx_st const * const draw_ctx, gt_attr_curve_st const * const bz_attr, gt_size_t expand) {
+    gt_float_t x0 = GT_MIN(GT_MIN(bz_attr->p0.x, bz_attr->p1.x), GT_MIN(bz_attr->p2.x, bz_attr->p3.x));
+    gt_float_t x1 = GT_MAX(GT_MAX(bz_attr->p0.x, bz_attr->p1.x), GT_MAX(bz_attr->p2.x, bz_attr->p3.x));
+    gt_float_t y0 = GT_MIN(GT_MIN(bz_attr->p0.y, bz_attr->p1.y), GT_MIN(bz_attr->p2.y, bz_attr->p3.y));
+    gt_float_t y1 = GT_MAX(GT_MAX(bz_attr->p0.y, bz_attr->p1.y), GT_MAX(bz_attr->p2.y, bz_attr->p3.y));
+    gt_size_t expand_x = expand + (gt_size_t)((x1 - x0) / 4);
+    gt_size_t expand_y = expand + (gt_size_t)((y1 - y0) / 4);
+
+    return _is_box_in_band(draw_ctx, (gt_size_t)x0 - expand_x, (gt_size_t)y0 - expand_y,
+        (gt_size_t)x1 + expand_x, (gt_size_t)y1 + expand_y);
+}
+
 static GT_ATTRIBUTE_RAM_TEXT void _graphs_draw_curve(gt_obj_st * obj, gt_series_points_st const * const ptr) {
+    _gt_graphs_st * style = (_gt_graphs_st *)obj;
     gt_attr_curve_st bz_attr = { .line = ptr->line };
     _graph_css_st css = _get_css(obj);
+    gt_size_t expand = _get_brush_size(&ptr->line);
+    uint16_t first = _get_first_visible(style, ptr);
+    uint16_t count = ptr->count_point;
+    gt_point_st pos = {0};
 
-    if (0 == ptr->count_point) {
+    if (first == count) {
         return;
-    } else if (1 == ptr->count_point) {
-        _draw_point_by(obj, ptr, 0, &css);
+    } else if (first + 1 == count) {
+        _draw_point_by(obj, ptr, first, &css);
         return;
-    } else if (2 == ptr->count_point) {
+    } else if (first + 2 == count) {
         gt_attr_line_st line_attr = {
             .line = ptr->line,
-            .start = {
-                .x = _calc_abs_point_x(ptr->x_series[0], &css),
-                .y = _calc_abs_point_y(ptr->y_series[0], &css),
-            },
-            .end = {
-                .x = _calc_abs_point_x(ptr->x_series[1], &css),
-                .y = _calc_abs_point_y(ptr->y_series[1], &css),
-            },
+            .start = _calc_point_pos(style, ptr, first, &css),
+            .end = _calc_point_pos(style, ptr, first + 1, &css),
         };
-        gt_draw_line(obj->draw_ctx, &line_attr, &obj->area);
+        _draw_segment_by(obj, &line_attr, expand);
         return;
     }
 
-    bz_attr.p1.x = _calc_abs_point_x(ptr->x_series[0], &css);
-    bz_attr.p1.y = _calc_abs_point_y(ptr->y_series[0], &css);
+    pos = _calc_point_pos(style, ptr, first, &css);
+    bz_attr.p1.x = pos.x;
+    bz_attr.p1.y = pos.y;
     bz_attr.p2 = bz_attr.p1;
-    bz_attr.p3.x = _calc_abs_point_x(ptr->x_series[1], &css);
-    bz_attr.p3.y = _calc_abs_point_y(ptr->y_series[1], &css);
+    pos = _calc_point_pos(style, ptr, first + 1, &css);
+    bz_attr.p3.x = pos.x;
+    bz_attr.p3.y = pos.y;
 
-    for (gt_size_t i = 0; i + 1 < ptr->count_point; ++i) {
+    for (uint16_t i = first; i + 1 < count; ++i) {
         bz_attr.p0 = bz_attr.p1;
         bz_attr.p1 = bz_attr.p2;
         bz_attr.p2 = bz_attr.p3;
-        if (i + 2 < ptr->count_point) {
-            bz_attr.p3.x = _calc_abs_point_x(ptr->x_series[i + 2], &css);
-            bz_attr.p3.y = _calc_abs_point_y(ptr->y_series[i + 2], &css);
+        if (i + 2 < count) {
+            pos = _calc_point_pos(style, ptr, i + 2, &css);
+            bz_attr.p3.x = pos.x;
+            bz_attr.p3.y = pos.y;
+        }
+        if (false == _is_curve_in_band(obj->draw_ctx, &bz_attr, expand)) {
+            continue;
         }
         gt_draw_catmullrom(obj->draw_ctx, &bz_attr, &obj->area);
     }
 }
 
 static GT_ATTRIBUTE_RAM_TEXT void _graphs_draw_bar(gt_obj_st * obj, gt_series_points_st const * const ptr) {
+    _gt_graphs_st * style = (_gt_graphs_st *)obj;
     gt_attr_line_st line_attr = { .line = ptr->line };
     _graph_css_st css = _get_css(obj);
+    gt_size_t expand = _get_brush_size(&ptr->line);
+    uint16_t first = _get_first_visible(style, ptr);
 
-    if (0 == ptr->count_point) {
+    if (first == ptr->count_point) {
         return;
     }
-    line_attr.end.y = _calc_abs_point_y(0, &css);
+    gt_size_t bottom = _calc_abs_point_y(0, &css);
 
-    for (gt_size_t i = 0; i < ptr->count_point; ++i) {
-        line_attr.start.x = _calc_abs_point_x(ptr->x_series[i], &css);
-        line_attr.start.y = _calc_abs_point_y(ptr->y_series[i], &css);
+    for (uint16_t i = first; i < ptr->count_point; ++i) {
+        line_attr.start = _calc_point_pos(style, ptr, i, &css);
         line_attr.end.x = line_attr.start.x;
-        gt_draw_line(obj->draw_ctx, &line_attr, &obj->area);
+        line_attr.end.y = bottom;
+        _draw_segment_by(obj, &line_attr, expand);
     }
 }
 
@@ -597,6 +1083,9 @@ static GT_ATTRIBUTE_RAM_TEXT void _draw_points_lines_curves(gt_obj_st * obj) {
     _gt_graphs_st * style = (_gt_graphs_st *)obj;
     gt_series_points_st * ptr = style->gp.series_head_p;
 
+    if (NULL == obj->draw_ctx->buf) {
+        return;
+    }
     while (ptr) {
         if (ptr->line.opa < GT_OPA_MIN) {
             ptr = ptr->next_series_p;
@@ -618,22 +1107,21 @@ static GT_ATTRIBUTE_RAM_TEXT void _draw_points_lines_curves(gt_obj_st * obj) {
 static GT_ATTRIBUTE_RAM_TEXT void _draw_point_value(gt_obj_st * obj) {
     _gt_graphs_st * style = (_gt_graphs_st *)obj;
     gt_series_points_st * ptr = style->gp.series_head_p;
+    gt_area_st const * band = &obj->draw_ctx->buf_area;
     _graph_css_st css = _get_css(obj);
     gt_point_st pointer = { .x = 0, .y = 0 };
-    char buf[20] = {0};
     gt_font_st font = {
-        .utf8 = buf,
         .info = style->font_info,
     };
     gt_attr_font_st font_attr = {
         .align = style->font_align,
         .font = &font,
     };
-    uint16_t offset = 0, total_width = 0;
+    uint16_t offset = 0, total_width = 0, first = 0;
     gt_font_info_update_font_thick(&font.info);
 
     while (ptr) {
-        if (false == ptr->show_point_value || ptr->line.opa < GT_OPA_MIN) {
+        if (false == ptr->show_point_value || ptr->line.opa < GT_OPA_MIN || NULL == ptr->point_value_str) {
             ptr = ptr->next_series_p;
             continue;
         }
@@ -641,15 +1129,22 @@ static GT_ATTRIBUTE_RAM_TEXT void _draw_point_value(gt_obj_st * obj) {
         font_attr.opa = ptr->line.opa;
         font_attr.font_color = ptr->point_value_font_color;
 
-        for (gt_size_t i = 0; i < ptr->count_point; ++i) {
-            pointer.x = _calc_abs_point_x(ptr->x_series[i], &css);
-            pointer.y = _calc_abs_point_y(ptr->y_series[i], &css);
+        first = _get_first_visible(style, ptr);
+        for (uint16_t i = first; i < ptr->count_point; ++i) {
+            font.utf8 = ptr->point_value_str[_ring_index(ptr, i)];
+            if (NULL == font.utf8) {
+                continue;
+            }
+            pointer = _calc_point_pos(style, ptr, i, &css);
             if (ptr->point_value_bottom) {
                 pointer.y += ptr->font_line_space + (ptr->line.width >> 1);
             } else {
                 pointer.y -= offset + (ptr->line.width >> 1);
             }
-            font.utf8 = ptr->point_value_str[i];
+            /** skip the text out of band before measuring it */
+            if (pointer.y + style->font_info.size < band->y || pointer.y >= band->y + band->h) {
+                continue;
+            }
             font.len = strlen(font.utf8);
 
             total_width = gt_font_get_longest_line_substring_width(&font.info, font.utf8, font_attr.space_x);
@@ -687,88 +1182,411 @@ static GT_ATTRIBUTE_RAM_TEXT gt_series_points_st * _get_series_line_by(gt_obj_st
     return ptr;
 }
 
-static GT_ATTRIBUTE_RAM_TEXT void _fifo_pop_item_by(gt_series_points_st * series, uint16_t pop_count) {
-    gt_size_t i = 0, k = 0;
-    if (0 == pop_count) {
-        return;
+/**
+ * @brief Move the points into a new ring buffer, the oldest points
+ *      are dropped when the capacity is not enough.
+ *
+ * @param style
+ * @param series
+ * @param capacity 0: free all points
+ * @param with_x true: store x value; false: fifo mode, x value is calculated by the point index
+ * @return gt_res_t
+ */
+static GT_ATTRIBUTE_RAM_TEXT gt_res_t _series_resize(_gt_graphs_st * style, gt_series_points_st * series, uint16_t capacity, bool with_x) {
+    uint16_t keep = GT_MIN(series->count_point, capacity);
+    uint16_t skip = series->count_point - keep;
+    uint16_t idx = 0;
+    gt_series_value_t * x_series = NULL;
+    gt_series_value_t * y_series = NULL;
+    char ** point_value_str = NULL;
+
+    if (0 == capacity) {
+        _free_series_line_points(series);
+        return GT_RES_OK;
+    }
+    y_series = gt_mem_malloc(capacity * sizeof(gt_series_value_t));
+    if (NULL == y_series) {
+        return GT_RES_FAIL;
     }
-    for (i = pop_count, k = 0; i < series->count_point; ++i, ++k) {
-        series->y_series[k] = series->y_series[i];
-        if (k < pop_count && series->point_value_str[k]) {
-            gt_mem_free(series->point_value_str[k]);
-            series->point_value_str[k] = NULL;
+    if (with_x) {
+        x_series = gt_mem_malloc(capacity * sizeof(gt_series_value_t));
+        if (NULL == x_series) {
+            goto x_fail_lb;
         }
-        series->point_value_str[k] = series->point_value_str[i];
     }
-}
-
-static GT_ATTRIBUTE_RAM_TEXT void _fifo_keep_latest_points(_gt_graphs_st * style) {
-    gt_series_points_st * series = style->gp.series_head_p;
-    gt_size_t i = 0, k = 0;
-    if (NULL == series) {
-        return;
+    if (series->point_value_str) {
+        point_value_str = gt_mem_malloc(capacity * sizeof(char *));
+        if (NULL == point_value_str) {
+            goto str_fail_lb;
+        }
+        gt_memset(point_value_str, 0, capacity * sizeof(char *));
     }
-    if (0 == style->fifo_depth) {
-        return;
+    for (uint16_t i = 0; i < keep; ++i) {
+        idx = _ring_index(series, skip + i);
+        y_series[i] = series->y_series[idx];
+        if (x_series) {
+            x_series[i] = series->x_series ? series->x_series[idx] : _to_series_value(_fifo_calc_average_x_pos(style, skip + i));
+        }
+        if (point_value_str) {
+            point_value_str[i] = series->point_value_str[idx];
+            series->point_value_str[idx] = NULL;
+        }
     }
-    while (series) {
-        if (series->count_point < style->fifo_depth) {
-            series = series->next_series_p;
-            continue;
+    /** free the dropped points */
+    if (series->point_value_str) {
+        for (uint16_t i = 0; i < series->capacity; ++i) {
+            if (series->point_value_str[i]) {
+                gt_mem_free(series->point_value_str[i]);
+            }
         }
-        _fifo_pop_item_by(series, series->count_point - style->fifo_depth);
-        series->count_point = style->fifo_depth;
-        series = series->next_series_p;
+        gt_mem_free(series->point_value_str);
+    }
+    if (series->y_series) {
+        gt_mem_free(series->y_series);
+    }
+    if (series->x_series) {
+        gt_mem_free(series->x_series);
     }
+    series->x_series = x_series;
+    series->y_series = y_series;
+    series->point_value_str = point_value_str;
+    series->capacity = capacity;
+    series->count_point = keep;
+    series->head = 0;
+    series->fifo_seq = with_x ? 0 : series->fifo_seq + skip;
+    _series_cache_invalid(series);
+    return GT_RES_OK;
+
+str_fail_lb:
+    if (x_series) {
+        gt_mem_free(x_series);
+    }
+x_fail_lb:
+    gt_mem_free(y_series);
+    return GT_RES_FAIL;
 }
 
-static GT_ATTRIBUTE_RAM_TEXT gt_res_t _resize_memory_for_series(gt_series_points_st * series, uint16_t total_count) {
-    uint16_t size = sizeof(gt_float_t);
-    if (total_count == series->count_point) {
+/**
+ * @brief Make sure the series can store count more points
+ *
+ * @param style
+ * @param series
+ * @param count The count of points will be appended
+ * @return gt_res_t
+ */
+static GT_ATTRIBUTE_RAM_TEXT gt_res_t _series_reserve(_gt_graphs_st * style, gt_series_points_st * series, uint16_t count) {
+    uint32_t need = (uint32_t)series->count_point + count;
+    uint32_t capacity = series->capacity;
+
+    if (style->fifo_depth) {
+        if (series->capacity == style->fifo_depth && NULL == series->x_series) {
+            return GT_RES_OK;
+        }
+        return _series_resize(style, series, style->fifo_depth, false);
+    }
+    if (need > 0xFFFF) {
+        return GT_RES_FAIL;
+    }
+    if (need <= capacity && series->x_series) {
         return GT_RES_OK;
     }
-    if (series->count_point) {
-        series->x_series = gt_mem_realloc(series->x_series, total_count * size);
-        if (NULL == series->x_series) {
-            goto x_fail_lb;
-        }
-        series->y_series = gt_mem_realloc(series->y_series, total_count * size);
-        if (NULL == series->y_series) {
-            goto y_fail_lb;
-        }
-        series->point_value_str = gt_mem_realloc(series->point_value_str, total_count * sizeof(char *));
+    /** grows geometrically */
+    capacity = capacity ? capacity + (capacity >> 1) : _GRAPHS_MIN_CAPACITY;
+    if (capacity < need) {
+        capacity = need;
+    }
+    if (capacity > 0xFFFF) {
+        capacity = 0xFFFF;
+    }
+    return _series_resize(style, series, capacity, true);
+}
+
+/**
+ * @brief Append a point into series, O(1). The oldest point is overwritten
+ *      when the fifo is full.
+ *
+ * @param style
+ * @param series
+ * @param point
+ * @param point_text
+ * @return gt_res_t
+ */
+static GT_ATTRIBUTE_RAM_TEXT gt_res_t _series_push_point(_gt_graphs_st * style, gt_series_points_st * series,
+    gt_point_f_st const * const point, char const * const point_text) {
+    uint16_t idx = 0;
+
+    if (GT_RES_OK != _series_reserve(style, series, 1)) {
+        return GT_RES_FAIL;
+    }
+    if (point_text && NULL == series->point_value_str) {
+        series->point_value_str = gt_mem_malloc(series->capacity * sizeof(char *));
         if (NULL == series->point_value_str) {
-            goto point_val_fail_lb;
+            return GT_RES_FAIL;
         }
+        gt_memset(series->point_value_str, 0, series->capacity * sizeof(char *));
+    }
+    if (series->count_point < series->capacity) {
+        idx = _ring_index(series, series->count_point);
+        ++series->count_point;
     } else {
-        series->x_series = gt_mem_malloc(total_count * size);
-        if (NULL == series->x_series) {
+        idx = series->head;
+        series->head = idx + 1 < series->capacity ? idx + 1 : 0;
+        ++series->fifo_seq;
+    }
+    if (series->x_series) {
+        series->x_series[idx] = _to_series_value(point->x);
+    }
+    series->y_series[idx] = _to_series_value(point->y);
+    if (NULL == series->point_value_str) {
+        return GT_RES_OK;
+    }
+    if (series->point_value_str[idx]) {
+        gt_mem_free(series->point_value_str[idx]);
+        series->point_value_str[idx] = NULL;
+    }
+    if (point_text) {
+        uint16_t len = strlen(point_text);
+        series->point_value_str[idx] = gt_mem_malloc(len + 1);
+        if (NULL == series->point_value_str[idx]) {
             return GT_RES_FAIL;
         }
-        series->y_series = gt_mem_malloc(total_count * size);
-        if (NULL == series->y_series) {
-            gt_mem_free(series->x_series);
-            series->x_series = NULL;
-            return GT_RES_FAIL;
+        gt_memcpy(series->point_value_str[idx], point_text, len);
+        series->point_value_str[idx][len] = '\0';
+    }
+    return GT_RES_OK;
+}
+
+/**
+ * @brief Update the view of the fifo graph, the series are scrolled together
+ *      by the view when all of them are full and appended at the same rate.
+ *      The view follows the series which is appended first, so that the graph
+ *      is moved once per round, the others are drawn at the right end when
+ *      they are appended, and their oldest point is out of the x-axis range.
+ *
+ * @param style
+ * @param dropped The count of points dropped by the series appended
+ * @param prev_seq [out] The sequence of the previous view, when scrolled
+ * @return _fifo_view_em
+ */
+static GT_ATTRIBUTE_RAM_TEXT _fifo_view_em _fifo_update_view(_gt_graphs_st * style, uint32_t dropped, uint32_t * prev_seq) {
+    gt_series_points_st * ptr = style->gp.series_head_p;
+    uint32_t min_seq = 0, max_seq = 0;
+    bool together = true, is_first = true;
+
+    while (ptr) {
+        if (0 == ptr->count_point || ptr->line.opa < GT_OPA_MIN) {
+            ptr = ptr->next_series_p;
+            continue;
         }
-        series->point_value_str = gt_mem_malloc(total_count * sizeof(char *));
-        if (NULL == series->point_value_str) {
-            gt_mem_free(series->y_series);
-            series->y_series = NULL;
-            gt_mem_free(series->x_series);
-            series->x_series = NULL;
-            return GT_RES_FAIL;
+        if (ptr->x_series || ptr->count_point != style->fifo_depth ||
+            (ptr->show_point_value && ptr->point_value_str)) {
+            together = false;
+            break;
         }
+        if (is_first || (int32_t)(ptr->fifo_seq - min_seq) < 0) { min_seq = ptr->fifo_seq; }
+        if (is_first || (int32_t)(ptr->fifo_seq - max_seq) > 0) { max_seq = ptr->fifo_seq; }
+        is_first = false;
+        ptr = ptr->next_series_p;
     }
-    return GT_RES_OK;
+    if (is_first || max_seq - min_seq > 1) {
+        together = false;
+    }
+    if (false == together) {
+        if (style->reg.fifo_scroll) {
+            style->reg.fifo_scroll = false;
+            return _FIFO_VIEW_REDRAW;
+        }
+        return dropped ? _FIFO_VIEW_REDRAW : _FIFO_VIEW_LATEST;
+    }
+    if (false == style->reg.fifo_scroll) {
+        style->reg.fifo_scroll = true;
+        style->fifo_seq = max_seq;
+        return _FIFO_VIEW_REDRAW;
+    }
+    if (max_seq == style->fifo_seq) {
+        return _FIFO_VIEW_LATEST;
+    }
+    if ((int32_t)(max_seq - style->fifo_seq) < 0) {
+        style->fifo_seq = max_seq;
+        return _FIFO_VIEW_REDRAW;
+    }
+    *prev_seq = style->fifo_seq;
+    style->fifo_seq = max_seq;
+    return _FIFO_VIEW_SCROLL;
+}
 
-point_val_fail_lb:
-    series->point_value_str = gt_mem_realloc(series->point_value_str, series->count_point * sizeof(char *));
-y_fail_lb:
-    series->y_series = gt_mem_realloc(series->y_series, series->count_point * size);
-x_fail_lb:
-    series->x_series = gt_mem_realloc(series->x_series, series->count_point * size);
-    return GT_RES_FAIL;
+#if GT_USE_DISP_COPY_AREA
+/**
+ * @brief Move the displayed plot by the display driver instead of redrawing it,
+ *      only the new strip at the right side, the borders and the vertical grid
+ *      lines which are not moved with the points are redrawn.
+ *
+ * @param obj
+ * @param css The absolute coordinates
+ * @param prev_seq The sequence of the previous view
+ * @param expand The max brush size of the series
+ * @return true The plot has been scrolled
+ * @return false Not supported, the plot need to be redrawn
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _fifo_scroll_blit(gt_obj_st * obj, _graph_css_st const * const css, uint32_t prev_seq, gt_size_t expand) {
+    _gt_graphs_st * style = (_gt_graphs_st *)obj;
+    gt_padding_st padding = _get_padding_by(obj);
+    gt_size_t hw = (style->gp.axis.scale.width >> 1) + 1;
+    gt_size_t edge = expand + hw;
+    gt_size_t left = css->padding.left;
+    gt_size_t right = left + css->range.x;
+    int32_t dx = _fifo_calc_pixel_delta(css, _fifo_get_div(style), prev_seq, (int32_t)(style->fifo_seq - prev_seq));
+    gt_area_st area = { .x = left + edge, .y = obj->area.y, .w = right - left - (edge << 1), .h = obj->area.h };
+    gt_area_st strip = {0};
+
+    if (false == gt_obj_is_show_bg(obj) || obj->opa < GT_OPA_COVER || obj->mask_effect ||
+        obj->reduce || obj->cnt_child) {
+        return false;
+    }
+    if (obj->radius > padding.left || obj->radius > padding.right) {
+        return false;
+    }
+    if (dx < 0 || area.w <= dx) {
+        return false;
+    }
+    if (_is_show_ruler(obj)) {
+        /** The ruler text under the plot is not moved */
+        gt_attr_font_st font_attr = {0};
+        _draw_ruler_hor_start(obj, &padding, &font_attr);
+        area.h = font_attr.logical_area.y - obj->area.y;
+        if (area.h < obj->area.h - padding.bottom + edge) {
+            return false;
+        }
+    }
+    if (dx && false == _gt_disp_scroll_blit_area(obj, &area, -dx, 0)) {
+        return false;
+    }
+    /** The borders and the points drawn over them */
+    strip.x = left - edge;
+    strip.y = area.y;
+    strip.w = area.x - strip.x;
+    strip.h = area.h;
+    gt_disp_invalid_sub_area(obj, &strip);
+    strip.x = area.x + area.w;
+    strip.w = right + edge + 1 - strip.x;
+    gt_disp_invalid_sub_area(obj, &strip);
+    if (0 == dx || style->gp.axis.grid.opa < GT_OPA_MIN) {
+        return true;
+    }
+    /** The vertical grid lines are moved with the points, draw them back */
+    gt_point_st div_part = _calc_div_part(style);
+    gt_size_t grid = css->range.x / div_part.x;
+    gt_size_t grid_hw = (style->gp.axis.grid.width >> 1) + 1;
+    for (gt_size_t i = 1; i < div_part.x; ++i) {
+        strip.x = left + i * grid - dx - grid_hw;
+        strip.w = dx + (grid_hw << 1) + 1;
+        gt_disp_invalid_sub_area(obj, &strip);
+    }
+    return true;
+}
+#endif
+
+/**
+ * @brief Set the latest points to be redrawn, only the columns which covered
+ *      by them are changed when the axis is fixed, otherwise the whole graph.
+ *
+ * @param obj
+ * @param series
+ * @param count The count of the latest points
+ * @param dropped The count of the oldest points dropped by fifo
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _invalid_latest_points(gt_obj_st * obj, gt_series_points_st const * const series, uint16_t count, uint32_t dropped) {
+    _gt_graphs_st * style = (_gt_graphs_st *)obj;
+    gt_size_t expand = _get_brush_size(&series->line);
+    gt_size_t x0 = 0x7fff, x1 = -0x7fff, x = 0;
+    uint16_t first = 0, before = 0, end = 0;
+    uint32_t prev_seq = 0;
+    _fifo_view_em view = _FIFO_VIEW_LATEST;
+
+    if (0 == count) {
+        return;
+    }
+    if (style->fifo_depth) {
+        view = _fifo_update_view(style, dropped, &prev_seq);
+    }
+    if (_FIFO_VIEW_LATEST == view && series->line.opa < GT_OPA_MIN) {
+        return;
+    }
+    if (_is_self_adaptive(obj) || _is_hor_range_zero(style) || _is_ver_range_zero(style)) {
+        /** axis range may be changed */
+        gt_event_send(obj, GT_EVENT_TYPE_DRAW_START, NULL);
+        return;
+    }
+    _graph_css_st css = _get_css(obj);
+    if (_FIFO_VIEW_LATEST != view) {
+        /** The graph is scrolled, the ruler and outside of the padding are not changed */
+        gt_series_points_st const * ptr = style->gp.series_head_p;
+        for (; ptr; ptr = ptr->next_series_p) {
+            if (ptr->line.opa < GT_OPA_MIN) {
+                continue;
+            }
+            expand = GT_MAX(expand, _get_brush_size(&ptr->line));
+            if (ptr->show_point_value && ptr->point_value_str) {
+                gt_event_send(obj, GT_EVENT_TYPE_DRAW_START, NULL);
+                return;
+            }
+        }
+#if GT_USE_DISP_COPY_AREA
+        if (_FIFO_VIEW_SCROLL == view && _fifo_scroll_blit(obj, &css, prev_seq, expand)) {
+            return;
+        }
+#endif
+        gt_area_st area = {
+            .x = css.padding.left - expand, .y = obj->area.y, .w = css.range.x + (expand << 1) + 1, .h = obj->area.h
+        };
+        gt_disp_invalid_sub_area(obj, &area);
+        return;
+    }
+    /** The segments between the previous points and the latest points */
+    if (_is_line_type(series, GT_GRAPHS_TYPE_LINE)) {
+        before = 1;
+    } else if (_is_line_type(series, GT_GRAPHS_TYPE_CURVE)) {
+        before = 3;
+    }
+    end = series->count_point;
+    count = GT_MIN(count, end - _get_first_visible(style, series));
+    if (_is_line_type(series, GT_GRAPHS_TYPE_LINE) && end > css.range.x && end - count <= css.range.x) {
+        /** The line is drawn column by column from now on */
+        gt_disp_invalid_sub_area(obj, &obj->area);
+        return;
+    }
+    first = end > count + before ? end - count - before : 0;
+    first = GT_MAX(first, _get_first_visible(style, series));
+    for (uint16_t i = first; i < end; ++i) {
+        x = _calc_point_pos(style, series, i, &css).x;
+        x0 = GT_MIN(x0, x);
+        x1 = GT_MAX(x1, x);
+    }
+    if (x0 > x1) {
+        return;
+    }
+    if (_is_line_type(series, GT_GRAPHS_TYPE_CURVE)) {
+        expand += (x1 - x0) >> 2;
+    }
+    if (series->show_point_value && series->point_value_str) {
+        gt_font_info_st info = style->font_info;
+        uint16_t width = 0, max_width = 0;
+        char const * text = NULL;
+        gt_font_info_update_font_thick(&info);
+        for (uint16_t i = end - count; i < end; ++i) {
+            text = series->point_value_str[_ring_index(series, i)];
+            if (NULL == text) {
+                continue;
+            }
+            width = gt_font_get_longest_line_substring_width(&info, text, 0);
+            max_width = GT_MAX(max_width, width);
+        }
+        if (max_width) {
+            expand = GT_MAX(expand, (max_width >> 1) + style->font_info.size);
+        }
+    }
+    gt_area_st area = { .x = x0 - expand, .y = obj->area.y, .w = x1 - x0 + (expand << 1) + 1, .h = obj->area.h };
+    gt_disp_invalid_sub_area(obj, &area);
 }
 
 /* global functions / API interface -------------------------------------*/
@@ -841,8 +1659,20 @@ void gt_graphs_set_fifo_max_points_count(gt_obj_st * obj, uint16_t fifo_depth)
         return;
     }
     _gt_graphs_st * style = (_gt_graphs_st *)obj;
+    gt_series_points_st * series = style->gp.series_head_p;
+    while (series) {
+        if (0 == series->capacity) {
+            /** allocated when the first point is added */
+        } else if (fifo_depth) {
+            _series_resize(style, series, fifo_depth, false);
+        } else if (NULL == series->x_series) {
+            _series_resize(style, series, series->count_point, true);
+        }
+        series = series->next_series_p;
+    }
     style->fifo_depth = fifo_depth;
-    _fifo_keep_latest_points(style);
+    style->fifo_seq = 0;
+    style->reg.fifo_scroll = false;
 }
 
 gt_series_points_st * gt_graphs_add_series_line(gt_obj_st * obj, gt_line_st const * const line_style)
@@ -879,38 +1709,15 @@ gt_res_t gt_graphs_series_add_point(gt_obj_st * obj, gt_series_points_st * const
         return GT_RES_FAIL;
     }
     _gt_graphs_st * style = (_gt_graphs_st *)obj;
+    uint32_t seq = 0;
     if (false == _is_series_valid(style, series)) {
         return GT_RES_FAIL;
     }
-    uint16_t size = sizeof(gt_float_t);
-    if (style->fifo_depth) {
-        _fifo_keep_latest_points(style);
-        if (GT_RES_OK != _resize_memory_for_series(series, style->fifo_depth)) {
-            return GT_RES_FAIL;
-        }
-        if (series->count_point >= style->fifo_depth) {
-            _fifo_pop_item_by(series, 1);
-            --series->count_point;
-        }
-    }
-    else if (GT_RES_OK != _resize_memory_for_series(series, series->count_point + 1)) {
+    seq = series->fifo_seq;
+    if (GT_RES_OK != _series_push_point(style, series, point, point_text)) {
         return GT_RES_FAIL;
     }
-    if (style->fifo_depth) {
-        series->x_series[series->count_point] = _fifo_calc_average_x_pos(style, series->count_point);
-    } else {
-        series->x_series[series->count_point] = point->x;
-    }
-    series->y_series[series->count_point] = point->y;
-    if (point_text) {
-        uint16_t len = strlen(point_text);
-        series->point_value_str[series->count_point] = gt_mem_malloc(len + 1);
-        gt_memcpy(series->point_value_str[series->count_point], point_text, len);
-        series->point_value_str[series->count_point][len] = '\0';
-    } else {
-        series->point_value_str[series->count_point] = NULL;
-    }
-    ++series->count_point;
+    _invalid_latest_points(obj, series, 1, series->fifo_seq - seq);
 
     return GT_RES_OK;
 }
@@ -934,47 +1741,29 @@ gt_res_t gt_graphs_series_add_point_list(gt_obj_st * obj, gt_series_points_st *
         return GT_RES_OK;
     }
     _gt_graphs_st * style = (_gt_graphs_st *)obj;
-    gt_size_t src_offset = 0;
+    uint16_t src_offset = 0, i = 0;
+    uint32_t seq = 0;
+    gt_res_t ret = GT_RES_OK;
     if (false == _is_series_valid(style, series)) {
         return GT_RES_FAIL;
     }
-    if (style->fifo_depth) {
-        _fifo_keep_latest_points(style);
-        if (GT_RES_OK != _resize_memory_for_series(series, style->fifo_depth)) {
-            return GT_RES_FAIL;
-        }
-        if (count > style->fifo_depth) {
-            _fifo_pop_item_by(series, style->fifo_depth);
-            src_offset = count - style->fifo_depth;
-            series->count_point = 0;
-        } else if (count + series->count_point > style->fifo_depth) {
-            _fifo_pop_item_by(series, count + series->count_point - style->fifo_depth);
-            series->count_point = style->fifo_depth - count;
-        }
+    seq = series->fifo_seq;
+    if (style->fifo_depth && count > style->fifo_depth) {
+        /** only the latest points can be kept */
+        src_offset = count - style->fifo_depth;
     }
-    else if (GT_RES_OK != _resize_memory_for_series(series, series->count_point + count)) {
+    if (GT_RES_OK != _series_reserve(style, series, count - src_offset)) {
         return GT_RES_FAIL;
     }
-    uint16_t len = 0;
-    for (gt_size_t i = 0, offset = series->count_point; i + src_offset < count; ++i) {
-        if (style->fifo_depth) {
-            series->x_series[offset + i] = _fifo_calc_average_x_pos(style, offset + i);
-        } else {
-            series->x_series[offset + i] = list[i + src_offset].x;
+    for (i = src_offset; i < count; ++i) {
+        ret = _series_push_point(style, series, &list[i], text_list ? text_list[i] : NULL);
+        if (GT_RES_OK != ret) {
+            break;
         }
-        series->y_series[offset + i] = list[i + src_offset].y;
-        if (text_list && text_list[i + src_offset]) {
-            len = strlen(text_list[i + src_offset]);
-            series->point_value_str[offset + i] = gt_mem_malloc(len + 1);
-            gt_memcpy(series->point_value_str[offset + i], text_list[i + src_offset], len);
-            series->point_value_str[offset + i][len] = '\0';
-        } else {
-            series->point_value_str[offset + i] = NULL;
-        }
-        ++series->count_point;
     }
+    _invalid_latest_points(obj, series, GT_MIN(i - src_offset, series->count_point), series->fifo_seq - seq);
 
-    return GT_RES_OK;
+    return ret;
 }
 
 gt_res_t gt_graphs_series_add_point_list_by(gt_obj_st * obj, uint16_t series_index,
@@ -100,6 +100,11 @@ void gt_graphs_set_axis(gt_obj_st * obj, gt_axis_st const * const axis);
  *          x-axis will be automatically calculated by hor, which was provided start and
  *      end value ignore the x-axis was provided by the user;
  *          y-axis was provided by the user.
+ *      When all of the series are full and appended one point each in turn, they are
+ *      scrolled together: the x-axis follows the series appended first, the latest
+ *      point of every series is shown at once, the oldest point of a series which is
+ *      not appended yet is out of the x-axis range. The display is moved by
+ *      GT_USE_DISP_COPY_AREA if supported.
  *
  * @param obj
  * @param fifo_depth 0[default]: not use fifo, unlimited points; 1~65535: fifo depth
@@ -20,6 +20,8 @@
 #include "../core/gt_draw.h"
 #include "../core/gt_disp.h"
 #include "../others/gt_anim.h"
+#include "../others/gt_area.h"
+#include "../others/gt_math.h"
 
 /* private define -------------------------------------------------------*/
 #define OBJ_TYPE    GT_TYPE_LAB
@@ -33,9 +35,26 @@ typedef struct _auto_scroll_s {
     uint32_t total_time;    // scroll total time [ms]
 }_auto_scroll_st;
 
+#if GT_LABEL_USE_PARTIAL_INVALID
+/**
+ * @brief The glyphs span of the changed text, offset from the line beginning
+ */
+typedef struct _text_span_s {
+    uint16_t x0;        /** The beginning of the changed glyphs */
+    uint16_t x1;        /** The end of the changed glyphs */
+    uint16_t w;         /** The sum of all glyphs width */
+    uint16_t line_w;    /** The line width which is used to align the text */
+}_text_span_st;
+#endif
+
 typedef struct _gt_label_s {
     gt_obj_st obj;
     char * text;
+    uint16_t text_cap;      /** The capacity of text buffer, include '\0' */
+#if GT_LABEL_USE_PARTIAL_INVALID
+    gt_area_st dirty;       /** The area of changed glyphs, valid when dirty_part is set */
+    uint8_t dirty_part;     /** Only dirty area is redrawn by the next update */
+#endif
 
     _auto_scroll_st * auto_scroll;
     gt_color_t  font_color;
@@ -152,6 +171,7 @@ static void _deinit_cb(gt_obj_st * obj) {
         gt_mem_free(style_p->text);
         style_p->text = NULL;
     }
+    style_p->text_cap = 0;
 }
 
 /**
@@ -167,6 +187,14 @@ static void _event_cb(struct gt_obj_s * obj, gt_event_st * e) {
         gt_disp_invalid_area(obj);
     }
     else if (GT_EVENT_TYPE_UPDATE_VALUE == code_val) {
+#if GT_LABEL_USE_PARTIAL_INVALID
+        _gt_label_st * style = (_gt_label_st * )obj;
+        if (style->dirty_part) {
+            style->dirty_part = 0;
+            gt_disp_invalid_sub_area(obj, &style->dirty);
+            return;
+        }
+#endif
         gt_event_send(obj, GT_EVENT_TYPE_DRAW_START, NULL);
     }
 }
@@ -252,6 +280,236 @@ static void _update_label_size(gt_obj_st * obj, uint16_t len) {
     obj->area.w = style->font_info.size * len;
 }
 
+/**
+ * @brief Make sure the text buffer can hold size bytes, the buffer is
+ *      reused when the capacity is enough, otherwise grows geometrically.
+ *
+ * @param style
+ * @param size include '\0'
+ * @return true The buffer is ready
+ */
+static bool _reserve_text(_gt_label_st * style, uint16_t size) {
+    uint32_t cap = style->text_cap;
+    char * text = NULL;
+
+    if (style->text && size <= cap) {
+        return true;
+    }
+    cap = style->text ? cap + (cap >> 1) : 0;
+    if (cap < size) {
+        cap = size;
+    }
+    if (cap > 0xFFFF) {
+        cap = 0xFFFF;
+    }
+    if (NULL == style->text) {
+        text = (char * )gt_mem_malloc(cap);
+    } else {
+        text = (char * )gt_mem_realloc(style->text, cap);
+    }
+    if (NULL == text) {
+        return false;
+    }
+    style->text = text;
+    style->text_cap = cap;
+    return true;
+}
+
+#if GT_LABEL_USE_PARTIAL_INVALID
+/**
+ * @brief Measure the glyphs the same as draw_text()
+ *
+ * @param font The font with res buffer
+ * @param space_x The space between glyphs, include the bold offset
+ * @param first The first byte which has been changed
+ * @param end The first byte of the unchanged suffix
+ * @return true single line text
+ */
+static bool _measure_span(gt_font_st * font, uint16_t res_len, uint8_t space_x,
+                          uint16_t first, uint16_t end, _text_span_st * span) {
+    uint32_t unicode = 0, line_w = 0;
+    uint16_t i = 0, x = 0;
+    uint8_t byte_len = 0, over_length = 0;
+    bool is_end = false;
+
+    span->x0 = 0;
+    for (i = 0; i < font->len; i += byte_len) {
+        if (i <= first) {
+            span->x0 = x;
+        }
+        if (i >= end && !is_end) {
+            span->x1 = x;
+            is_end = true;
+        }
+        if ('\n' == font->utf8[i]) {
+            return false;
+        }
+        byte_len = gt_font_one_char_code_len_get((uint8_t * )&font->utf8[i], &unicode, font->info.encoding);
+        if (0 == byte_len) {
+            return false;
+        }
+        gt_memset(font->res, 0, res_len);
+        x += gt_font_get_one_word_width(unicode, font) + space_x;
+    }
+    if (!is_end) {
+        span->x1 = x;
+    }
+    span->w = x;
+    if (font->len != gt_font_split_line_str(font, 0xFFFF, space_x, &line_w, NULL, NULL, NULL, &over_length, true)) {
+        return false;
+    }
+    span->line_w = line_w;
+    return true;
+}
+
+static gt_size_t _get_line_start_x(gt_align_et align, gt_area_st const * box, uint16_t line_w, uint16_t indent_w) {
+    switch (align) {
+        case GT_ALIGN_CENTER:
+        case GT_ALIGN_CENTER_MID:
+        case GT_ALIGN_CENTER_BOTTOM:
+            /** center single line do not indent */
+            return box->x + ((box->w - line_w) >> 1);
+        case GT_ALIGN_RIGHT:
+        case GT_ALIGN_RIGHT_MID:
+        case GT_ALIGN_RIGHT_BOTTOM:
+            return box->x + box->w - line_w;
+        default:
+            break;
+    }
+    return box->x + indent_w;
+}
+
+/**
+ * @brief Calculate the area of the glyphs which are changed by the new text,
+ *      only the single line text which is laid out simply is supported.
+ *
+ * @return true style->dirty is valid
+ */
+static bool _calc_dirty_area(gt_obj_st * label, const char * text, uint16_t len) {
+    _gt_label_st * style = (_gt_label_st * )label;
+    uint16_t old_len = strlen(style->text);
+    uint16_t first = 0, suffix = 0, limit = GT_MIN(old_len, len);
+    uint16_t indent_w = 0, res_len = 0;
+    uint8_t space_x = 0;
+    gt_size_t old_x = 0, new_x = 0, x0 = 0, x1 = 0;
+    _text_span_st old_span, new_span;
+    gt_area_st box;
+    bool ret = false;
+
+    if (style->text_style.omit_line || style->font_info.style.reg.italic ||
+        (style->font_align & GT_ALIGN_REVERSE)) {
+        return false;
+    }
+    if (style->auto_scroll) {
+        return false;
+    }
+    if (0 == label->area.w || 0 == label->area.h) {
+        return false;
+    }
+    while (first < limit && style->text[first] == text[first]) {
+        ++first;
+    }
+    while (suffix < limit - first && style->text[old_len - 1 - suffix] == text[len - 1 - suffix]) {
+        ++suffix;
+    }
+
+    gt_font_st font = {
+        .info = style->font_info,
+    };
+    gt_font_info_update_font_thick(&font.info);
+    font.info.gray = font.info.gray ? font.info.gray : 1;
+    space_x = style->space_x + (font.info.style.reg.bold ? 1 : 0);
+#if (defined(GT_FONT_FAMILY_OLD_ENABLE) && (GT_FONT_FAMILY_OLD_ENABLE == 1))
+    _gt_font_size_res_st font_size_res = gt_font_get_size_length_by_style(&font.info, 2, 0, 0);
+#else
+    _gt_font_size_res_st font_size_res = gt_font_get_size_length_by_style(&font.info, FONT_LAN_UNKNOWN, 0);
+#endif
+    res_len = font_size_res.font_per_size;
+    font.res = gt_mem_malloc(res_len);
+    GT_CHECK_BACK_VAL(font.res, false);
+
+    font.utf8 = style->text;
+    font.len = old_len;
+    if (!_measure_span(&font, res_len, space_x, first, old_len - suffix, &old_span)) {
+        goto _free_lb;
+    }
+    font.utf8 = (char * )text;
+    font.len = len;
+    if (!_measure_span(&font, res_len, space_x, first, len - suffix, &new_span)) {
+        goto _free_lb;
+    }
+
+    box = gt_area_reduce(label->area, gt_obj_get_reduce(label));
+    indent_w = gt_font_get_indent_width(&style->font_info, style->indent);
+    if (old_span.line_w + space_x + indent_w > box.w ||
+        new_span.line_w + space_x + indent_w > box.w) {
+        /** multi-line */
+        goto _free_lb;
+    }
+    old_x = _get_line_start_x(style->font_align, &box, old_span.line_w, indent_w);
+    new_x = _get_line_start_x(style->font_align, &box, new_span.line_w, indent_w);
+
+    /** The glyphs in front of first or behind the suffix may be shifted */
+    if (old_x == new_x) {
+        x0 = new_x + new_span.x0;
+    } else {
+        x0 = GT_MIN(old_x, new_x);
+    }
+    if (old_x + old_span.x1 == new_x + new_span.x1) {
+        x1 = GT_MAX(old_x + old_span.x1, new_x + new_span.x1);
+    } else {
+        x1 = GT_MAX(old_x + old_span.w, new_x + new_span.w);
+    }
+    style->dirty = label->area;
+    style->dirty.x = x0;
+    style->dirty.w = x1 > x0 ? x1 - x0 : 0;
+    ret = true;
+
+_free_lb:
+    gt_mem_free(font.res);
+    font.res = NULL;
+    return ret;
+}
+#endif  /** GT_LABEL_USE_PARTIAL_INVALID */
+
+/**
+ * @brief Replace the text if it has been changed, only the changed glyphs
+ *      are redrawn when the layout permits.
+ *
+ * @param label
+ * @param text May be a part of the label text
+ * @param len
+ * @return true The text has been changed
+ */
+static bool _update_text(gt_obj_st * label, const char * text, uint16_t len) {
+    _gt_label_st * style = (_gt_label_st * )label;
+
+    if (style->text && len == strlen(style->text) && 0 == memcmp(style->text, text, len)) {
+        return false;
+    }
+#if GT_LABEL_USE_PARTIAL_INVALID
+    style->dirty_part = style->text ? _calc_dirty_area(label, text, len) : 0;
+#endif
+    if (!_reserve_text(style, len + 1)) {
+#if GT_LABEL_USE_PARTIAL_INVALID
+        style->dirty_part = 0;
+#endif
+        return false;
+    }
+    gt_memmove(style->text, text, len);
+    style->text[len] = '\0';
+
+#if GT_LABEL_USE_PARTIAL_INVALID
+    if (!style->dirty_part)
+#endif
+    {
+        _reset_auto_scroll_st(style->auto_scroll);
+    }
+    _update_label_size(label, len + 1);
+    gt_event_send(label, GT_EVENT_TYPE_UPDATE_VALUE, NULL);
+    return true;
+}
+
 /* global functions / API interface -------------------------------------*/
 
 /**
@@ -268,8 +526,7 @@ gt_obj_st * gt_label_create(gt_obj_st * parent) {
     _gt_label_st * style = (_gt_label_st * )obj;
 
     uint16_t len = sizeof("label");
-    style->text = gt_mem_malloc(len);
-    if (style->text) {
+    if (_reserve_text(style, len)) {
         gt_memcpy(style->text, "label\0", len);
     }
 
@@ -288,92 +545,66 @@ gt_obj_st * gt_label_create(gt_obj_st * parent) {
 }
 
 
-void gt_label_set_text(gt_obj_st * label, const char * fmt, ...)
+bool gt_label_set_text(gt_obj_st * label, const char * fmt, ...)
 {
-    char buffer[8] = {0};
+    char buffer[GT_LABEL_FORMAT_BUFFER_SIZE] = {0};
     va_list args;
     va_list args2;
+    bool ret = false;
 
     if (false == gt_obj_is_type(label, OBJ_TYPE)) {
-        return;
+        return ret;
     }
     if (NULL == fmt) {
-        return;
+        return ret;
     }
 
     _gt_label_st * style = (_gt_label_st * )label;
-    _reset_auto_scroll_st(style->auto_scroll);
     va_start(args, fmt);
     va_copy(args2, args);
-    uint16_t size = (NULL == fmt) ? 0 : (vsnprintf(buffer, sizeof(buffer), fmt, args) + 1);
+    int size = vsnprintf(buffer, sizeof(buffer), fmt, args) + 1;
     va_end(args);
-    if (!size) {
+    if (size <= 0 || size > 0xFFFF) {
         goto free_lb;
     }
-
-    if (NULL == style->text) {
-        style->text = gt_mem_malloc(size);
-    } else if (size != strlen(style->text) + 1) {
-        style->text = gt_mem_realloc(style->text, size);
+    if (size <= (int)sizeof(buffer)) {
+        /** The whole text has been formatted, compared with the current text */
+        ret = _update_text(label, buffer, size - 1);
+        goto free_lb;
     }
-    if (NULL == style->text) {
+
+    /** The long text is formatted into the label buffer directly */
+    if (!_reserve_text(style, size)) {
         goto free_lb;
     }
-    gt_memset(style->text, 0, size);
-    va_start(args2, fmt);
     vsnprintf(style->text, size, fmt, args2);
-    va_end(args2);
-
+#if GT_LABEL_USE_PARTIAL_INVALID
+    style->dirty_part = 0;
+#endif
+    _reset_auto_scroll_st(style->auto_scroll);
     _update_label_size(label, size);
     gt_event_send(label, GT_EVENT_TYPE_UPDATE_VALUE, NULL);
-
-    return;
+    ret = true;
 
 free_lb:
     va_end(args2);
+    return ret;
 }
 
-void gt_label_set_text_by_len(gt_obj_st * label, const char * text, uint16_t len)
+bool gt_label_set_text_by_len(gt_obj_st * label, const char * text, uint16_t len)
 {
     if (false == gt_obj_is_type(label, OBJ_TYPE)) {
-        return;
+        return false;
     }
     if (NULL == text || 0 == len) {
-        return;
-    }
-
-    _gt_label_st * style = (_gt_label_st * )label;
-    char * ptr = (char * )text;
-    char * dst = NULL;
-    uint16_t i = 0;
-    uint16_t real_len = strlen(text);
-
-    if (real_len < len) {
-        len = real_len;
-    }
-
-    _reset_auto_scroll_st(style->auto_scroll);
-
-    if (NULL == style->text) {
-        style->text = gt_mem_malloc(len + 1);
-    } else if (len != strlen(style->text)) {
-        style->text = gt_mem_realloc(style->text, len + 1);
-    }
-    if (NULL == style->text) {
-        return;
+        return false;
     }
+    uint16_t real_len = 0;
 
-    dst = style->text;
-    while (i < len) {
-        *dst = *ptr;
-        ++dst;
-        ++ptr;
-        ++i;
+    while (real_len < len && text[real_len]) {
+        ++real_len;
     }
-    *dst = '\0';
-
-    _update_label_size(label, len);
-    gt_event_send(label, GT_EVENT_TYPE_UPDATE_VALUE, NULL);
+    return _update_text(label, text, real_len);
 }
 
 char * gt_label_get_text(gt_obj_st * label)
@@ -736,30 +967,57 @@ void gt_label_add_text(gt_obj_st * label, const char * fmt, ...)
         goto free_lb;
     }
 
-    uint16_t len = 0;
+    uint16_t len = style->text ? strlen(style->text) : 0;
 
-    if (NULL == style->text) {
-        style->text = gt_mem_malloc(size);
-    } else {
-        len = strlen(style->text);
-        style->text = gt_mem_realloc(style->text, size + len);
-    }
-    if (NULL == style->text) {
+    if (!_reserve_text(style, size + len)) {
         goto free_lb;
     }
 
-    gt_memset(&style->text[len], 0, size);
-    va_start(args2, fmt);
     vsnprintf(&style->text[len], size, fmt, args2);
-    va_end(args2);
+#if GT_LABEL_USE_PARTIAL_INVALID
+    style->dirty_part = 0;
+#endif
 
     _update_label_size(label, size + len);
     gt_event_send(label, GT_EVENT_TYPE_UPDATE_VALUE, NULL);
 
-    return;
-
 free_lb:
     va_end(args2);
 }
+
+void gt_label_append_text_by_len(gt_obj_st * label, const char * text, uint16_t len)
+{
+    if (false == gt_obj_is_type(label, OBJ_TYPE)) {
+        return;
+    }
+    if (NULL == text || 0 == len) {
+        return;
+    }
+
+    _gt_label_st * style = (_gt_label_st * )label;
+    uint16_t old_len = style->text ? strlen(style->text) : 0;
+    uint16_t i = 0;
+
+    while (i < len && text[i]) {
+        ++i;
+    }
+    len = i;
+    if (0 == len) {
+        return;
+    }
+    _reset_auto_scroll_st(style->auto_scroll);
+
+    if (!_reserve_text(style, old_len + len + 1)) {
+        return;
+    }
+    gt_memcpy(&style->text[old_len], text, len);
+    style->text[old_len + len] = '\0';
+#if GT_LABEL_USE_PARTIAL_INVALID
+    style->dirty_part = 0;
+#endif
+
+    _update_label_size(label, old_len + len);
+    gt_event_send(label, GT_EVENT_TYPE_UPDATE_VALUE, NULL);
+}
 #endif  /** GT_CFG_ENABLE_LABEL */
 /* end ------------------------------------------------------------------*/
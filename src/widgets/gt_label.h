@@ -27,7 +27,24 @@ extern "C" {
 
 
 /* define ---------------------------------------------------------------*/
+#ifndef GT_LABEL_FORMAT_BUFFER_SIZE
+    /**
+     * @brief The stack buffer size of gt_label_set_text(), the formatted text
+     *      which is shorter than it is compared with the current text without
+     *      any heap memory, the longer one is formatted into the label buffer.
+     *      [default: 64]
+     */
+    #define GT_LABEL_FORMAT_BUFFER_SIZE     64
+#endif
 
+#ifndef GT_LABEL_USE_PARTIAL_INVALID
+    /**
+     * @brief Only the glyphs which have been changed are redrawn when the
+     *      single line text is set, such as the numeric readouts.
+     *      1[default]: enabled; 0: redraw the whole label
+     */
+    #define GT_LABEL_USE_PARTIAL_INVALID    1
+#endif
 
 
 /* typedef --------------------------------------------------------------*/
@@ -49,21 +66,27 @@ extern "C" {
 gt_obj_st * gt_label_create(gt_obj_st * parent);
 
 /**
- * @brief set label obj text
+ * @brief set label obj text, the text is formatted into the label buffer,
+ *      nothing is redrawn when the text is not changed.
  *
  * @param label label obj
  * @param fmt text format
+ * @return true The text has been changed
+ * @return false The text is the same as before, or failed
  */
-void gt_label_set_text(gt_obj_st * label, const char * fmt, ...);
+bool gt_label_set_text(gt_obj_st * label, const char * fmt, ...);
 
 /**
- * @brief Set label text by content length
+ * @brief Set label text by content length, nothing is redrawn when
+ *      the text is not changed.
  *
  * @param label
  * @param text
  * @param len encoding byte count, such as: strlen(text).
+ * @return true The text has been changed
+ * @return false The text is the same as before, or failed
  */
-void gt_label_set_text_by_len(gt_obj_st * label, const char * text, uint16_t len);
+bool gt_label_set_text_by_len(gt_obj_st * label, const char * text, uint16_t len);
 
 /**
  * @brief get label text
@@ -163,6 +186,16 @@ bool gt_label_is_auto_scroll_single_line(gt_obj_st * label);
 
 void gt_label_add_text(gt_obj_st * label, const char * fmt, ...);
 
+/**
+ * @brief Append text to the end of the label text by content length,
+ *      the existing text is not copied again.
+ *
+ * @param label
+ * @param text
+ * @param len encoding byte count, such as: strlen(text).
+ */
+void gt_label_append_text_by_len(gt_obj_st * label, const char * text, uint16_t len);
+
 #endif  /** GT_CFG_ENABLE_LABEL */
 
 #ifdef __cplusplus
@@ -29,6 +29,7 @@
 typedef struct _gt_line_s {
     gt_obj_st obj;
     gt_attr_line_st line;
+    gt_point_st origin;     /** The area position when the points are set */
 }_gt_line_st;
 
 
@@ -58,10 +59,18 @@ static GT_ATTRIBUTE_RAM_DATA const gt_obj_class_st gt_line_class = {
 static void _init_cb(gt_obj_st * obj) {
     _gt_line_st * widget = (_gt_line_st * )obj;
     gt_attr_line_st * style = (gt_attr_line_st * )&widget->line;
+    gt_attr_line_st dsc;
     style->line.opa = obj->opa;
     style->line.type = GT_GRAPHS_TYPE_LINE;
     style->line.brush = GT_BRUSH_TYPE_ROUND;
-    gt_draw_line(obj->draw_ctx, style, &obj->area);
+
+    /** The points follow the area, which may be moved by gt_obj_set_pos() or parent scrolling */
+    dsc = *style;
+    dsc.start.x += obj->area.x - widget->origin.x;
+    dsc.start.y += obj->area.y - widget->origin.y;
+    dsc.end.x += obj->area.x - widget->origin.x;
+    dsc.end.y += obj->area.y - widget->origin.y;
+    gt_draw_line(obj->draw_ctx, &dsc, &obj->area);
 }
 
 /**
@@ -85,6 +94,8 @@ static void _resize_area(gt_obj_st * line, gt_attr_line_st * style) {
     line->area.y = GT_MIN(style->start.y, style->end.y) - (style->line.width >> 1);
     line->area.w = gt_abs(style->end.x - style->start.x) + style->line.width + 1;
     line->area.h = gt_abs(style->end.y - style->start.y) + style->line.width + 1;
+    ((_gt_line_st * )line)->origin.x = line->area.x;
+    ((_gt_line_st * )line)->origin.y = line->area.y;
 }
 
 /* global functions / API interface -------------------------------------*/
@@ -16,6 +16,8 @@
 #include "../core/gt_mem.h"
 #include "../core/gt_disp.h"
 #include "../core/gt_obj_scroll.h"
+#include "../core/gt_style.h"
+#include "../hal/gt_hal_tick.h"
 #include "../others/gt_log.h"
 #include "./gt_textarea.h"
 #include "../extra/md4c/md4c.h"
@@ -37,7 +39,29 @@
 
 #define _MARK_DOWN_LOG              0
 
+/** The source buffer and block list grow geometrically */
+#define _MARK_DOWN_SRC_MIN_CAP      (64)
+#define _MARK_DOWN_BLOCK_MIN_CAP    (8)
+/** The blocks within the overscan out of the view are kept materialized */
+#define _MARK_DOWN_OVERSCAN(h)      ((h) >> 2)
+
 /* private typedef ------------------------------------------------------*/
+/**
+ * @brief A top-level block of the source, which is parsed on its own.
+ *      The objects are only created while the block is within the view,
+ *      the height is cached after the first parsing.
+ */
+typedef struct _gt_markdown_block_s {
+    gt_obj_st ** objs;      /** The objects created by the block, NULL: not materialized */
+    uint32_t begin;         /** The offset of the block in the source text */
+    uint32_t len;
+    uint32_t top;           /** The offset of the block in the content */
+    uint32_t h;
+    uint16_t obj_cnt;
+    uint8_t materialized : 1;
+    uint8_t reserved     : 7;
+}_gt_markdown_block_st;
+
 typedef struct _gt_markdown_s {
     gt_obj_st obj;
     MD_PARSER md_parser;
@@ -45,6 +69,19 @@ typedef struct _gt_markdown_s {
     gt_font_info_st font_info_middle;
     gt_font_info_st font_info_small;
 
+    char * src;                         /** The copy of the whole source text */
+    uint32_t src_len;
+    uint32_t src_capacity;
+
+    _gt_markdown_block_st * blocks;
+    uint16_t block_cnt;
+    uint16_t block_capacity;
+    uint16_t mat_first;                 /** The materialized blocks are within [mat_first, mat_last) */
+    uint16_t mat_last;
+
+    int32_t scroll_y;                   /** The offset of the content, <= 0 */
+    gt_markdown_stat_st stat;
+
     gt_color_t color_border;
     uint8_t border_width;
 }_gt_markdown_st;
@@ -115,14 +152,34 @@ static void _markdown_init_cb(gt_obj_st * obj) {
 }
 
 static void _markdown_deinit_cb(gt_obj_st * obj) {
+    _gt_markdown_st * style = (_gt_markdown_st * )obj;
+
+    /** The objects are freed as children, only the records are released here */
+    for (uint16_t i = 0; i < style->block_cnt; ++i) {
+        if (style->blocks[i].objs) {
+            gt_mem_free(style->blocks[i].objs);
+        }
+    }
+    if (style->blocks) {
+        gt_mem_free(style->blocks);
+        style->blocks = NULL;
+    }
+    if (style->src) {
+        gt_mem_free(style->src);
+        style->src = NULL;
+    }
+    style->block_cnt = 0;
+    style->src_len = 0;
 }
 
+static GT_ATTRIBUTE_RAM_TEXT void _scrolling_handler(gt_obj_st * obj);
+
 static void _markdown_event_cb(struct gt_obj_s * obj, gt_event_st * e) {
     gt_event_type_et code_val = gt_event_get_code(e);
 
     switch(code_val) {
         case GT_EVENT_TYPE_INPUT_SCROLL: {
-            _gt_obj_scroll_internal(obj);
+            _scrolling_handler(obj);
             break;
         }
         case GT_EVENT_TYPE_DRAW_START: {
@@ -165,7 +222,7 @@ _enter_md_block_default(_gt_markdown_cb_params_st * pm) {
     ptr->prop.item_count = 0;
 
     ptr->act_p[ptr->act_idx] = gt_textarea_create(ptr->markdown_p);
-    gt_obj_set_pos(ptr->act_p[ptr->act_idx], 0, ptr->offset.y + ptr->markdown_p->area.y);
+    gt_obj_set_pos(ptr->act_p[ptr->act_idx], ptr->markdown_p->area.x, ptr->offset.y + ptr->markdown_p->area.y);
     gt_obj_set_size(ptr->act_p[ptr->act_idx], ptr->markdown_p->area.w, 16);
     gt_obj_show_bg(ptr->act_p[ptr->act_idx], false);
     gt_obj_set_reduce(ptr->act_p[ptr->act_idx], 0);
@@ -253,9 +310,11 @@ _enter_md_block_hr(_gt_markdown_cb_params_st * pm) {
 
     ptr->act_p[ptr->act_idx] = gt_line_create(ptr->markdown_p);
     gt_line_set_color(ptr->act_p[ptr->act_idx], gt_color_hex(0x7f7f7f));
-    gt_obj_set_pos(ptr->act_p[ptr->act_idx], padding, 0);
+    gt_obj_set_pos(ptr->act_p[ptr->act_idx], ptr->markdown_p->area.x + padding, ptr->offset.y + ptr->markdown_p->area.y);
     gt_line_set_line_width(ptr->act_p[ptr->act_idx], 2);
     gt_line_set_hor_line(ptr->act_p[ptr->act_idx], ptr->markdown_p->area.w - (padding << 1));
+
+    return 0;
 }
 
 static GT_ATTRIBUTE_RAM_TEXT int
@@ -352,7 +411,6 @@ static GT_ATTRIBUTE_RAM_TEXT int
 _leave_block_cb(MD_BLOCKTYPE type, void * detail, void * userdata) {
     int ret = 0;
     _gt_markdown_ptr_st * ptr = (_gt_markdown_ptr_st *)userdata;
-    gt_obj_st * child = NULL;
     _gt_markdown_cb_params_st params = {
         .type = (uint8_t)type,
         .detail = detail,
@@ -368,16 +426,7 @@ _leave_block_cb(MD_BLOCKTYPE type, void * detail, void * userdata) {
 #endif
         gt_obj_set_h(ptr->act_p[ptr->act_idx], height);
     }
-
-    if (MD_BLOCK_DOC == type) {
-        /** resize all widget offset and markdown height */
-        ptr->offset.y = ptr->markdown_p->area.y;
-        for (gt_size_t i = 0; i < ptr->markdown_p->cnt_child; ++i) {
-            child = ptr->markdown_p->child[i];
-            gt_obj_set_pos(child, 0, ptr->offset.y);
-            ptr->offset.y += gt_obj_get_h(child);
-        }
-    }
+    /** The objects of the block are stacked by _gt_block_parse() */
     ptr->act_p[ptr->act_idx] = NULL;
     --ptr->act_idx;
     return ret;
@@ -482,6 +531,394 @@ _set_font_info_by(gt_font_info_st * font_info, uint16_t font_size) {
 #endif
 }
 
+static GT_ATTRIBUTE_RAM_TEXT inline gt_size_t _clamp_pos(int32_t pos) {
+    /** Far away from the view, only keep the value within gt_size_t range */
+    return (gt_size_t)GT_MAX(GT_MIN(pos, 0x3FFF), -0x3FFF);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline uint32_t _get_content_h(_gt_markdown_st * style) {
+    if (0 == style->block_cnt) {
+        return 0;
+    }
+    return style->blocks[style->block_cnt - 1].top + style->blocks[style->block_cnt - 1].h;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline int32_t _get_scroll_bottom(gt_obj_st * obj) {
+    int32_t bottom = obj->area.h - (int32_t)_get_content_h((_gt_markdown_st * )obj);
+    return bottom < 0 ? bottom : 0;
+}
+
+/**
+ * @brief Keep the process scroll value as the content offset, which is
+ *      wrapped when the content is higher than gt_size_t range.
+ */
+static GT_ATTRIBUTE_RAM_TEXT inline void _sync_scroll(gt_obj_st * obj) {
+    obj->process_attr.scroll.x = 0;
+    obj->process_attr.scroll.y = (gt_size_t)((_gt_markdown_st * )obj)->scroll_y;
+    obj->process_attr.scroll_prev = obj->process_attr.scroll;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT bool _is_blank_line(const char * line, uint32_t len) {
+    for (uint32_t i = 0; i < len; ++i) {
+        if (' ' != line[i] && '\t' != line[i] && '\r' != line[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Get the code fence of the line, such as: "```c" or "~~~"
+ *
+ * @param line
+ * @param len
+ * @param cnt [out] The count of the fence chars
+ * @param end [out] The offset after the fence chars
+ * @return char 0: not a fence line; otherwise the fence char
+ */
+static GT_ATTRIBUTE_RAM_TEXT char _get_fence(const char * line, uint32_t len, uint32_t * cnt, uint32_t * end) {
+    uint32_t i = 0, n = 0;
+    char ch = 0;
+
+    while (i < len && i < 4 && ' ' == line[i]) { ++i; }
+    if (i > 3 || i >= len || ('`' != line[i] && '~' != line[i])) {
+        return 0;
+    }
+    ch = line[i];
+    while (i + n < len && ch == line[i + n]) { ++n; }
+    if (n < 3) {
+        return 0;
+    }
+    *cnt = n;
+    *end = i + n;
+    return ch;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline bool _is_space_or_end(const char * line, uint32_t len, uint32_t i) {
+    return i >= len || ' ' == line[i] || '\t' == line[i] || '\r' == line[i];
+}
+
+/**
+ * @brief The line which starts a new top-level block after a blank line:
+ *      no indentation and not a list item, which may continue the list above.
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _is_block_start_line(const char * line, uint32_t len) {
+    uint32_t i = 0;
+    if (0 == len || ' ' == line[0] || '\t' == line[0]) {
+        return false;
+    }
+    if (('-' == line[0] || '+' == line[0] || '*' == line[0]) && _is_space_or_end(line, len, 1)) {
+        return false;
+    }
+    while (i < len && i < 10 && line[i] >= '0' && line[i] <= '9') { ++i; }
+    if (i && i < len && ('.' == line[i] || ')' == line[i]) && _is_space_or_end(line, len, i + 1)) {
+        return false;
+    }
+    return true;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT gt_res_t _gt_block_push(_gt_markdown_st * style, uint32_t begin, uint32_t len) {
+    _gt_markdown_block_st * blocks = NULL;
+    uint16_t capacity = style->block_capacity;
+
+    if (style->block_cnt >= capacity) {
+        if (capacity >= 0x7FFF) {
+            return GT_RES_FAIL;
+        }
+        capacity = capacity ? GT_MIN(capacity << 1, 0x7FFF) : _MARK_DOWN_BLOCK_MIN_CAP;
+        blocks = (_gt_markdown_block_st * )gt_mem_realloc(style->blocks, sizeof(_gt_markdown_block_st) * capacity);
+        if (NULL == blocks) {
+            return GT_RES_FAIL;
+        }
+        style->blocks = blocks;
+        style->block_capacity = capacity;
+    }
+    blocks = &style->blocks[style->block_cnt++];
+    gt_memset_0(blocks, sizeof(_gt_markdown_block_st));
+    blocks->begin = begin;
+    blocks->len = len;
+    return GT_RES_OK;
+}
+
+/**
+ * @brief Split the source text into top-level blocks from the offset,
+ *      the boundary is a blank line out of code fence, which followed by
+ *      an unindented line that can not continue the block above. The last
+ *      block is kept open, it would be parsed again when text appended.
+ *
+ * @param style
+ * @param begin The offset of a stable boundary
+ * @return gt_res_t
+ */
+static GT_ATTRIBUTE_RAM_TEXT gt_res_t _gt_block_split_from(_gt_markdown_st * style, uint32_t begin) {
+    const char * src = style->src;
+    uint32_t pos = begin, eol = 0, len = 0;
+    uint32_t fence_cnt = 0, cnt = 0, end = 0;
+    char fence_ch = 0;
+    bool blank = false;
+
+    while (pos < style->src_len) {
+        for (eol = pos; eol < style->src_len && '\n' != src[eol]; ++eol) {}
+        if (eol >= style->src_len) {
+            /** The last line is incomplete, which can not be judged yet */
+            break;
+        }
+        len = eol - pos;
+        if (fence_ch) {
+            if (fence_ch == _get_fence(&src[pos], len, &cnt, &end) && cnt >= fence_cnt &&
+                _is_blank_line(&src[pos + end], len - end)) {
+                fence_ch = 0;
+            }
+        } else if (_is_blank_line(&src[pos], len)) {
+            blank = true;
+        } else {
+            if (blank && pos > begin && _is_block_start_line(&src[pos], len)) {
+                if (GT_RES_OK != _gt_block_push(style, begin, pos - begin)) {
+                    return GT_RES_FAIL;
+                }
+                begin = pos;
+            }
+            blank = false;
+            fence_ch = _get_fence(&src[pos], len, &fence_cnt, &end);
+        }
+        pos = eol + 1;
+    }
+    if (begin < style->src_len) {
+        return _gt_block_push(style, begin, style->src_len - begin);
+    }
+    return GT_RES_OK;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _gt_block_set_pos(gt_obj_st * obj, _gt_markdown_block_st * block) {
+    int32_t y = obj->area.y + ((_gt_markdown_st * )obj)->scroll_y + (int32_t)block->top;
+    for (uint16_t i = 0; i < block->obj_cnt; ++i) {
+        gt_obj_set_pos(block->objs[i], block->objs[i]->area.x, _clamp_pos(y));
+        y += gt_obj_get_h(block->objs[i]);
+    }
+}
+
+/**
+ * @brief Parse the block source and create the objects of block,
+ *      the objects are stacked from the top of block and the height
+ *      of block is updated.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_block_parse(gt_obj_st * obj, _gt_markdown_block_st * block) {
+    _gt_markdown_st * style = (_gt_markdown_st * )obj;
+    _gt_markdown_ptr_st root = {
+        .markdown_p = obj,
+    };
+    int32_t y = obj->area.y + style->scroll_y + (int32_t)block->top;
+    uint32_t start = gt_tick_get();
+    uint16_t first = obj->cnt_child;
+    gt_obj_st * child = NULL;
+
+    root.offset.y = _clamp_pos(y) - obj->area.y;
+    md_parse(&style->src[block->begin], block->len, &style->md_parser, &root);
+
+    block->materialized = true;
+    block->obj_cnt = obj->cnt_child > first ? obj->cnt_child - first : 0;
+    block->h = 0;
+    for (uint16_t i = 0; i < block->obj_cnt; ++i) {
+        child = obj->child[first + i];
+        gt_obj_set_pos(child, child->area.x, _clamp_pos(y + (int32_t)block->h));
+        block->h += gt_obj_get_h(child);
+    }
+    if (block->obj_cnt) {
+        block->objs = (gt_obj_st ** )gt_mem_malloc(sizeof(gt_obj_st * ) * block->obj_cnt);
+        if (NULL == block->objs) {
+            GT_LOGW(GT_LOG_TAG_GUI, "markdown block objs malloc failed, cnt: %d", block->obj_cnt);
+            while (obj->cnt_child > first) {
+                _gt_obj_class_destroy(obj->child[obj->cnt_child - 1]);
+            }
+            block->obj_cnt = 0;
+        } else {
+            gt_memcpy(block->objs, &obj->child[first], sizeof(gt_obj_st * ) * block->obj_cnt);
+        }
+    }
+
+    ++style->stat.parse_count;
+    style->stat.parse_bytes += block->len;
+    style->stat.parse_time += gt_tick_get() - start;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _gt_block_release(_gt_markdown_block_st * block) {
+    for (uint16_t i = block->obj_cnt; i > 0; --i) {
+        _gt_obj_class_destroy(block->objs[i - 1]);
+    }
+    if (block->objs) {
+        gt_mem_free(block->objs);
+        block->objs = NULL;
+    }
+    block->obj_cnt = 0;
+    block->materialized = false;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline bool _gt_block_is_visible(_gt_markdown_block_st * block, int32_t view_top, int32_t view_bottom) {
+    return block->h && (int32_t)block->top < view_bottom && (int32_t)(block->top + block->h) > view_top;
+}
+
+/**
+ * @brief Only the blocks within the view are materialized, the blocks
+ *      which scrolled out are released and parsed again when scrolled back.
+ *
+ * @param obj
+ * @param relayout true: the materialized objects need to be placed again
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_markdown_update_view(gt_obj_st * obj, bool relayout) {
+    _gt_markdown_st * style = (_gt_markdown_st * )obj;
+    int32_t view_top = -style->scroll_y - _MARK_DOWN_OVERSCAN(obj->area.h);
+    int32_t view_bottom = -style->scroll_y + obj->area.h + _MARK_DOWN_OVERSCAN(obj->area.h);
+    _gt_markdown_block_st * block = NULL;
+    uint16_t first = 0, last = style->block_cnt, mid = 0;
+
+    /** The first block which bottom is below the view top */
+    while (first < last) {
+        mid = first + ((last - first) >> 1);
+        block = &style->blocks[mid];
+        if ((int32_t)(block->top + block->h) > view_top) {
+            last = mid;
+        } else {
+            first = mid + 1;
+        }
+    }
+    for (last = first; last < style->block_cnt && (int32_t)style->blocks[last].top < view_bottom; ++last) {}
+
+    for (uint16_t i = style->mat_first; i < style->mat_last && i < style->block_cnt; ++i) {
+        if ((i < first || i >= last) && style->blocks[i].materialized) {
+            _gt_block_release(&style->blocks[i]);
+        }
+    }
+    for (uint16_t i = first; i < last; ++i) {
+        block = &style->blocks[i];
+        if (block->materialized) {
+            if (relayout) {
+                _gt_block_set_pos(obj, block);
+            }
+        } else if (_gt_block_is_visible(block, view_top, view_bottom)) {
+            _gt_block_parse(obj, block);
+        }
+    }
+    style->mat_first = first;
+    style->mat_last = last;
+}
+
+/**
+ * @brief Parse the source text again from the block, the blocks above are
+ *      unchanged and their objects are reused.
+ *
+ * @param obj
+ * @param idx The index of the first block to be parsed again
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _gt_markdown_rebuild_from(gt_obj_st * obj, uint16_t idx) {
+    _gt_markdown_st * style = (_gt_markdown_st * )obj;
+    _gt_markdown_block_st * block = NULL;
+    int32_t view_top = 0, view_bottom = 0;
+    uint32_t begin = idx < style->block_cnt ? style->blocks[idx].begin : 0;
+    uint32_t top = 0;
+
+    for (uint16_t i = idx; i < style->block_cnt; ++i) {
+        _gt_block_release(&style->blocks[i]);
+    }
+    style->block_cnt = idx;
+    if (idx) {
+        block = &style->blocks[idx - 1];
+        top = block->top + block->h;
+        begin = block->begin + block->len;
+    }
+    if (GT_RES_OK != _gt_block_split_from(style, begin)) {
+        GT_LOGW(GT_LOG_TAG_GUI, "markdown blocks realloc failed, cnt: %d", style->block_cnt);
+    }
+
+    view_top = -style->scroll_y - _MARK_DOWN_OVERSCAN(obj->area.h);
+    view_bottom = -style->scroll_y + obj->area.h + _MARK_DOWN_OVERSCAN(obj->area.h);
+    for (uint16_t i = idx; i < style->block_cnt; ++i) {
+        block = &style->blocks[i];
+        block->top = top;
+        /** Measure the height, the objects are kept only within the view */
+        _gt_block_parse(obj, block);
+        top += block->h;
+        if (false == _gt_block_is_visible(block, view_top, view_bottom)) {
+            _gt_block_release(block);
+        }
+    }
+    if (style->mat_first >= style->mat_last || style->mat_first > idx) {
+        style->mat_first = idx;
+    }
+    style->mat_last = style->block_cnt;
+
+    if (style->scroll_y < _get_scroll_bottom(obj)) {
+        style->scroll_y = _get_scroll_bottom(obj);
+    }
+    _sync_scroll(obj);
+    _gt_markdown_update_view(obj, true);
+}
+
+/**
+ * @brief Resize the buffer of source text, the text within is kept
+ *
+ * @param style
+ * @param capacity 0: free the buffer
+ * @return gt_res_t
+ */
+static GT_ATTRIBUTE_RAM_TEXT gt_res_t _gt_markdown_src_resize(_gt_markdown_st * style, uint32_t capacity) {
+    char * src = NULL;
+
+    if (capacity == style->src_capacity) {
+        return GT_RES_OK;
+    }
+    if (0 == capacity) {
+        if (style->src) {
+            gt_mem_free(style->src);
+            style->src = NULL;
+        }
+        style->src_capacity = 0;
+        return GT_RES_OK;
+    }
+    src = (char * )gt_mem_realloc(style->src, capacity);
+    if (NULL == src) {
+        GT_LOGW(GT_LOG_TAG_GUI, "markdown text realloc failed, size: %d", capacity);
+        return GT_RES_FAIL;
+    }
+    style->src = src;
+    style->src_capacity = capacity;
+    return GT_RES_OK;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _scrolling_handler(gt_obj_st * obj) {
+    _gt_markdown_st * style = (_gt_markdown_st * )obj;
+    int32_t bottom = _get_scroll_bottom(obj);
+    int32_t prev = style->scroll_y;
+    /** The distance scrolled since last time, gt_size_t wrapping is expected */
+    gt_size_t dist = (gt_size_t)(obj->process_attr.scroll.y - (gt_size_t)style->scroll_y);
+
+    style->scroll_y += dist;
+    if (style->scroll_y > 0) {
+        style->scroll_y = 0;
+    } else if (style->scroll_y < bottom) {
+        style->scroll_y = bottom;
+    }
+    _sync_scroll(obj);
+    if (prev == style->scroll_y) {
+        return;
+    }
+    if (style->scroll_y - prev <= -0x3FFF || style->scroll_y - prev >= 0x3FFF) {
+        _gt_markdown_update_view(obj, true);
+        gt_disp_invalid_area(obj);
+        return;
+    }
+
+    /** Move the displayed pixels before the new blocks are materialized */
+    _gt_obj_move_child_by(obj, 0, (gt_size_t)(style->scroll_y - prev));
+#if GT_USE_DISP_COPY_AREA
+    if (false == _gt_disp_scroll_blit(obj, 0, (gt_size_t)(style->scroll_y - prev))) {
+        gt_disp_invalid_area(obj);
+    }
+#else
+    gt_disp_invalid_area(obj);
+#endif
+    _gt_markdown_update_view(obj, false);
+}
+
 /* global functions / API interface -------------------------------------*/
 gt_obj_st * gt_markdown_create(gt_obj_st * parent)
 {
@@ -519,16 +956,68 @@ void gt_markdown_set_text(gt_obj_st * markdown, const char * text, uint32_t len)
         return;
     }
     _gt_markdown_st * style = (_gt_markdown_st *)markdown;
-    _gt_markdown_ptr_st root = {
-        .markdown_p = markdown,
-    };
+
+    for (uint16_t i = 0; i < style->block_cnt; ++i) {
+        _gt_block_release(&style->blocks[i]);
+    }
     if (markdown->cnt_child) {
         _gt_obj_class_destroy_children(markdown);
     }
-    md_parse(text, len, &style->md_parser, &root);
+    style->block_cnt = 0;
+    style->mat_first = 0;
+    style->mat_last = 0;
+    style->scroll_y = 0;
+    style->src_len = 0;
+    /** The whole text is known, no more space is reserved */
+    if (GT_RES_OK == _gt_markdown_src_resize(style, text ? len : 0) && text && len) {
+        gt_memcpy(style->src, text, len);
+        style->src_len = len;
+    }
+    _gt_markdown_rebuild_from(markdown, 0);
     gt_event_send(markdown, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 
+void gt_markdown_append_text(gt_obj_st * markdown, const char * text, uint32_t len)
+{
+    if (false == gt_obj_is_type(markdown, OBJ_TYPE)) {
+        return;
+    }
+    if (NULL == text || 0 == len) {
+        return;
+    }
+    _gt_markdown_st * style = (_gt_markdown_st *)markdown;
+    uint32_t capacity = style->src_capacity;
+    if (style->src_len + len > capacity) {
+        /** grows geometrically, the streaming text is appended piece by piece */
+        capacity = capacity ? capacity : _MARK_DOWN_SRC_MIN_CAP;
+        while (capacity < style->src_len + len) {
+            capacity <<= 1;
+        }
+        if (GT_RES_OK != _gt_markdown_src_resize(style, capacity)) {
+            return;
+        }
+    }
+    gt_memcpy(&style->src[style->src_len], text, len);
+    style->src_len += len;
+    /** Only the last block is open, the blocks above are kept */
+    _gt_markdown_rebuild_from(markdown, style->block_cnt ? style->block_cnt - 1 : 0);
+}
+
+void gt_markdown_get_stat(gt_obj_st * markdown, gt_markdown_stat_st * stat)
+{
+    if (NULL == stat) {
+        return;
+    }
+    if (false == gt_obj_is_type(markdown, OBJ_TYPE)) {
+        gt_memset_0(stat, sizeof(gt_markdown_stat_st));
+        return;
+    }
+    _gt_markdown_st * style = (_gt_markdown_st *)markdown;
+    *stat = style->stat;
+    stat->block_count = style->block_cnt;
+    stat->obj_count = markdown->cnt_child;
+}
+
 void gt_markdown_set_font_info_large(gt_obj_st * markdown, gt_font_info_st * font_info)
 {
     if (false == gt_obj_is_type(markdown, OBJ_TYPE)) {
@@ -539,6 +1028,11 @@ void gt_markdown_set_font_info_large(gt_obj_st * markdown, gt_font_info_st * fon
     }
     _gt_markdown_st * style = (_gt_markdown_st *)markdown;
     style->font_info_large = *font_info;
+    if (style->src_len) {
+        /** The heights of all blocks are changed */
+        _gt_markdown_rebuild_from(markdown, 0);
+        gt_event_send(markdown, GT_EVENT_TYPE_DRAW_START, NULL);
+    }
 }
 
 void gt_markdown_set_font_info_middle(gt_obj_st * markdown, gt_font_info_st * font_info)
@@ -551,6 +1045,11 @@ void gt_markdown_set_font_info_middle(gt_obj_st * markdown, gt_font_info_st * fo
     }
     _gt_markdown_st * style = (_gt_markdown_st *)markdown;
     style->font_info_middle = *font_info;
+    if (style->src_len) {
+        /** The heights of all blocks are changed */
+        _gt_markdown_rebuild_from(markdown, 0);
+        gt_event_send(markdown, GT_EVENT_TYPE_DRAW_START, NULL);
+    }
 }
 
 void gt_markdown_set_font_info_small(gt_obj_st * markdown, gt_font_info_st * font_info)
@@ -563,6 +1062,11 @@ void gt_markdown_set_font_info_small(gt_obj_st * markdown, gt_font_info_st * fon
     }
     _gt_markdown_st * style = (_gt_markdown_st *)markdown;
     style->font_info_small = *font_info;
+    if (style->src_len) {
+        /** The heights of all blocks are changed */
+        _gt_markdown_rebuild_from(markdown, 0);
+        gt_event_send(markdown, GT_EVENT_TYPE_DRAW_START, NULL);
+    }
 }
 
 gt_font_info_st * gt_markdown_get_font_info_large(gt_obj_st * markdown)
@@ -30,7 +30,16 @@ extern "C" {
 
 
 /* typedef --------------------------------------------------------------*/
-
+/**
+ * @brief The statistics of markdown parsing, which is accumulated since created.
+ */
+typedef struct gt_markdown_stat_s {
+    uint32_t parse_count;   /** The count of blocks parsed, include the blocks scrolled back into view */
+    uint32_t parse_bytes;   /** The total bytes of source text parsed */
+    uint32_t parse_time;    /** The total time of parsing and layout, unit: ms */
+    uint16_t block_count;   /** The count of top-level blocks of the document */
+    uint16_t obj_count;     /** The count of objects materialized within view */
+}gt_markdown_stat_st;
 
 
 /* macros ---------------------------------------------------------------*/
@@ -51,7 +60,7 @@ extern "C" {
 gt_obj_st * gt_markdown_create(gt_obj_st * parent);
 
 /**
- * @brief Set the markdown source text,
+ * @brief Set the markdown source text, the text is copied.
  *      [Warn] Must after gt_obj_set_size() be called.
  *
  * @param markdown
@@ -60,6 +69,25 @@ gt_obj_st * gt_markdown_create(gt_obj_st * parent);
  */
 void gt_markdown_set_text(gt_obj_st * markdown, const char * text, uint32_t len);
 
+/**
+ * @brief Append the markdown source text, such as the streaming response,
+ *      only the last block of document is parsed again, the objects of
+ *      the blocks above are reused.
+ *
+ * @param markdown
+ * @param text The source text to be appended
+ * @param len The length of the text
+ */
+void gt_markdown_append_text(gt_obj_st * markdown, const char * text, uint32_t len);
+
+/**
+ * @brief Get the statistics of markdown parsing
+ *
+ * @param markdown
+ * @param stat [out] The parse count, parse time and the count of objects
+ */
+void gt_markdown_get_stat(gt_obj_st * markdown, gt_markdown_stat_st * stat);
+
 void gt_markdown_set_font_info_large(gt_obj_st * markdown, gt_font_info_st * font_info);
 void gt_markdown_set_font_info_middle(gt_obj_st * markdown, gt_font_info_st * font_info);
 void gt_markdown_set_font_info_small(gt_obj_st * markdown, gt_font_info_st * font_info);
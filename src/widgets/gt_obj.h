@@ -85,6 +85,19 @@ typedef struct gt_obj_container_s {
 }gt_obj_container_st;
 #endif
 
+#if GT_USE_OBJ_HIT_GRID
+/**
+ * @brief The grid cells range which is indexed by the object
+ *      @ref gt_hit_grid.h
+ */
+typedef struct gt_hit_grid_range_s {
+    uint8_t x0;     /** 0xFF: not indexed */
+    uint8_t y0;
+    uint8_t x1;
+    uint8_t y1;
+}gt_hit_grid_range_st;
+#endif
+
 /**
  * @brief obj base struct
  */
@@ -105,11 +118,15 @@ typedef struct gt_obj_s {
      */
     gt_point_st touch_expand_size;
 #endif
+#if GT_USE_OBJ_HIT_GRID
+    gt_hit_grid_range_st hit_range; /* The grid cells which is covered by touch area */
+#endif
 
     gt_id_t id;                     /* obj id, register by user, default: [-1] invalid id, normal begin from 0. */
     gt_color_t bgcolor;
 
     uint16_t cnt_child;
+    uint16_t cap_child;     /* The capacity of the child array, grows geometrically */
     gt_radius_t radius;
     uint8_t opa;            /* @ref gt_color.h */
     uint8_t reduce;
@@ -21,8 +21,12 @@
 #include "../others/gt_log.h"
 #include "../others/gt_assert.h"
 #include "../core/gt_layout.h"
+#include "../core/gt_hit_grid.h"
+#include "../others/gt_anim.h"
 
 /* private define -------------------------------------------------------*/
+/** The initial capacity of the child / screens array */
+#define _GT_OBJ_ARRAY_CAP_MIN   4
 
 
 
@@ -43,6 +47,60 @@ static inline uint32_t get_style_size(const gt_obj_class_st * c) {
     return c->size_style;
 }
 
+/**
+ * @brief Make sure the array has room for one more object, the capacity
+ *      grows geometrically, so the array is not reallocated for every object.
+ *
+ * @param arr The child or screens array
+ * @param cap [in/out] The capacity of the array
+ * @param cnt The count of the objects in the array
+ * @return true success
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _obj_array_reserve(gt_obj_st *** arr, uint16_t * cap, uint16_t cnt) {
+    gt_obj_st ** ptr = NULL;
+    uint16_t new_cap = 0;
+
+    if (*arr && cnt < *cap) {
+        return true;
+    }
+    new_cap = (*arr && *cap) ? (*cap << 1) : _GT_OBJ_ARRAY_CAP_MIN;
+    if (new_cap <= cnt) {
+        new_cap = cnt + 1;
+    }
+    ptr = (gt_obj_st ** )gt_mem_realloc(*arr, new_cap * sizeof(gt_obj_st * ));
+    if (NULL == ptr) {
+        return false;
+    }
+    *arr = ptr;
+    *cap = new_cap;
+    return true;
+}
+
+/**
+ * @brief Release the array when it is empty, or halve the capacity when
+ *      the usage drops to a quarter, which avoids reallocating at the boundary.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _obj_array_trim(gt_obj_st *** arr, uint16_t * cap, uint16_t cnt) {
+    gt_obj_st ** ptr = NULL;
+
+    if (0 == cnt) {
+        if (*arr) {
+            gt_mem_free(*arr);
+            *arr = NULL;
+        }
+        *cap = 0;
+        return;
+    }
+    if (*cap <= _GT_OBJ_ARRAY_CAP_MIN || cnt > (*cap >> 2)) {
+        return;
+    }
+    ptr = (gt_obj_st ** )gt_mem_realloc(*arr, (*cap >> 1) * sizeof(gt_obj_st * ));
+    if (ptr) {
+        *arr = ptr;
+        *cap >>= 1;
+    }
+}
+
 static GT_ATTRIBUTE_RAM_TEXT gt_obj_st * _gt_obj_class_destroy_screen(gt_obj_st * self) {
     gt_size_t i = 0;
     gt_size_t idx = -1;
@@ -73,7 +131,7 @@ static GT_ATTRIBUTE_RAM_TEXT gt_obj_st * _gt_obj_class_destroy_screen(gt_obj_st
         gt_memmove(&disp->screens[idx], &disp->screens[idx + 1], (disp->cnt_scr - idx) * sizeof(gt_obj_st * ));
     }
     disp->screens[disp->cnt_scr] = NULL;
-    disp->screens = (gt_obj_st ** )gt_mem_realloc(disp->screens, disp->cnt_scr * sizeof(gt_obj_st * ));
+    _obj_array_trim(&disp->screens, &disp->cap_scr, disp->cnt_scr);
     return ret_p;
 }
 
@@ -111,12 +169,7 @@ static GT_ATTRIBUTE_RAM_TEXT gt_obj_st * _gt_obj_class_destroy_from_parent(gt_ob
         gt_memmove(&parent->child[idx], &parent->child[idx + 1], (parent->cnt_child - idx) * sizeof(gt_obj_st * ));
     }
     parent->child[parent->cnt_child] = NULL;
-    if (0 == parent->cnt_child && parent->child) {
-        gt_mem_free(parent->child);
-        parent->child = NULL;
-    } else {
-        parent->child = (gt_obj_st ** )gt_mem_realloc(parent->child, parent->cnt_child * sizeof(gt_obj_st * ));
-    }
+    _obj_array_trim(&parent->child, &parent->cap_child, parent->cnt_child);
     return ret_p;
 }
 
@@ -128,6 +181,14 @@ static GT_ATTRIBUTE_RAM_TEXT void _gt_obj_class_destroy_property(gt_obj_st * sel
     // free event attribute
     gt_obj_remove_all_event_cb(self);
 
+#if GT_USE_OBJ_HIT_GRID
+    _gt_hit_grid_remove(self);
+#endif
+#if GT_USE_EVENT_QUEUE
+    _gt_event_queue_remove_obj(self);
+#endif
+    _gt_anim_remove_target(self);
+
     // free obj custom style
     if (self->classes->_deinit_cb) {
         self->classes->_deinit_cb(self);
@@ -182,6 +243,7 @@ static GT_ATTRIBUTE_RAM_TEXT bool _destroy_and_free_children(struct gt_obj_s * s
         self->child = NULL;
     }
     self->cnt_child = 0;
+    self->cap_child = 0;
     if (!is_root) {
         _gt_obj_class_destroy_self(self);
         self = NULL;
@@ -190,20 +252,10 @@ static GT_ATTRIBUTE_RAM_TEXT bool _destroy_and_free_children(struct gt_obj_s * s
 }
 
 static inline bool _add_obj_to_parent(gt_obj_st * obj, gt_obj_st * parent) {
-    if (parent->child == NULL || parent->cnt_child == 0 ) {
-        parent->child = gt_mem_malloc(sizeof(gt_obj_st *));
-        if (!parent->child) {
-            return false;
-        }
-        parent->child[0] = obj;
-        parent->cnt_child = 1;
-    } else {
-        parent->child = gt_mem_realloc(parent->child, sizeof(gt_obj_st *) * (parent->cnt_child + 1));
-        if (!parent->child) {
-            return false;
-        }
-        parent->child[parent->cnt_child++] = obj;
+    if (false == _obj_array_reserve(&parent->child, &parent->cap_child, parent->cnt_child)) {
+        return false;
     }
+    parent->child[parent->cnt_child++] = obj;
     // GT_LOGV(GT_LOG_TAG_GUI, "create a normal obj: %p, parent: %p, parent child: %p, count: %d", parent->child[parent->cnt_child - 1], parent, parent->child, parent->cnt_child);
     if (parent->row_layout) {
         // row calc width
@@ -222,19 +274,10 @@ static GT_ATTRIBUTE_RAM_TEXT bool _create_new_screen_obj(gt_obj_st * obj) {
         return false;
     }
 
-    if (disp->screens == NULL || disp->cnt_scr == 0 ) {
-        disp->screens = gt_mem_malloc(sizeof(gt_obj_st *));
-        if (!disp->screens) {
-            return false;
-        }
-        disp->screens[disp->cnt_scr++] = obj;
-    } else {
-        disp->screens = gt_mem_realloc(disp->screens, sizeof(gt_obj_st *) * (disp->cnt_scr + 1));
-        if (!disp->screens) {
-            return false;
-        }
-        disp->screens[disp->cnt_scr++] = obj;
+    if (false == _obj_array_reserve(&disp->screens, &disp->cap_scr, disp->cnt_scr)) {
+        return false;
     }
+    disp->screens[disp->cnt_scr++] = obj;
     obj->area.x = 0;
     obj->area.y = 0;
     obj->area.w = gt_disp_get_res_hor(NULL);
@@ -248,6 +291,9 @@ static GT_ATTRIBUTE_RAM_TEXT bool _create_new_screen_obj(gt_obj_st * obj) {
 struct gt_obj_s * gt_obj_class_create(const gt_obj_class_st * c, struct gt_obj_s * parent)
 {
     uint32_t is = get_style_size(c);
+#if GT_USE_MEM_SLAB
+    _gt_mem_slab_add_class(is);
+#endif
     gt_obj_st * obj = gt_mem_malloc(is);
     if (!obj) {
         return NULL;
@@ -263,6 +309,9 @@ struct gt_obj_s * gt_obj_class_create(const gt_obj_class_st * c, struct gt_obj_s
     obj->bgcolor    = gt_color_white();
     obj->radius     = 4;
     obj->reduce     = REDUCE_DEFAULT;
+#if GT_USE_OBJ_HIT_GRID
+    obj->hit_range.x0 = _GT_HIT_GRID_RANGE_NONE;
+#endif
 
     /** Inherit from the parent class */
     if (parent) {
@@ -284,6 +333,9 @@ struct gt_obj_s * gt_obj_class_create(const gt_obj_class_st * c, struct gt_obj_s
     if (false == _add_obj_to_parent(obj, parent)) {
         goto obj_lb;
     }
+#if GT_USE_OBJ_HIT_GRID
+    _gt_hit_grid_insert(obj);
+#endif
 
     return obj;
 
@@ -385,6 +437,7 @@ void _gt_obj_class_destroy_children(struct gt_obj_s * self)
         _gt_obj_class_destroy(self->child[i]);
     }
     self->cnt_child = 0;
+    self->cap_child = 0;
     self->child = NULL;
 }
 
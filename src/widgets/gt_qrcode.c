@@ -14,12 +14,15 @@
 #include "../core/gt_mem.h"
 #include "../others/gt_log.h"
 #include "../core/gt_draw.h"
+#include "../core/gt_mask.h"
 #include "string.h"
 #include "../core/gt_graph_base.h"
 #include "../core/gt_obj_pos.h"
 #include "../core/gt_disp.h"
+#include "../core/gt_hit_grid.h"
 #include "../font/gt_font.h"
 #include "../others/gt_assert.h"
+#include "../hal/gt_hal_tick.h"
 
 /* private define -------------------------------------------------------*/
 #define OBJ_TYPE    GT_TYPE_QRCODE
@@ -39,6 +42,9 @@ typedef struct _gt_qr_code_s {
     uint8_t mask_patt;
     gt_family_t version;
     gt_color_t fg_color;
+    uint8_t * modules;          /** The dark modules bitset, row by row, MSB first; NULL: need to encode */
+    uint8_t modules_w;          /** The count of modules per side */
+    gt_qrcode_stat_st stat;
 }_gt_qr_code_st;
 
 
@@ -93,18 +99,59 @@ static void _Data_ReMap(unsigned char* getdate,unsigned char* putdata, unsigned
     }
 }
 
+static inline uint8_t _get_modules_width(_gt_qr_code_st * style) {
+    return 4 * style->version + 17;
+}
+
+static inline uint8_t _get_row_bytes(uint8_t width) {
+    return (width + 7) >> 3;
+}
+
+static void _update_size(gt_obj_st * obj) {
+    _gt_qr_code_st * style = (_gt_qr_code_st * )obj;
+    obj->area.w = _get_modules_width(style) + 8;
+    obj->area.h = obj->area.w;
+#if GT_USE_OBJ_HIT_GRID
+    _gt_hit_grid_update(obj);
+#endif
+}
+
+static void _free_modules(_gt_qr_code_st * style) {
+    if (NULL == style->modules) {
+        return;
+    }
+    gt_mem_free(style->modules);
+    style->modules = NULL;
+    style->modules_w = 0;
+}
+
 /**
- * @brief obj init obj widget call back
+ * @brief Encode the symbol into the modules bitset, only once until
+ *      the string or version is changed.
  *
- * @param obj
+ * @param style
+ * @return gt_res_t
  */
-static void _init_cb(gt_obj_st * obj) {
-    _gt_qr_code_st * style = (_gt_qr_code_st * )obj;
+static gt_res_t _encode_modules(_gt_qr_code_st * style) {
     uint8_t *qr_data_buff = NULL;
     uint8_t *qr_code_buff = NULL;
+    uint8_t width = _get_modules_width(style);
+    uint16_t high = _get_row_bytes(width) << 3;
+    uint16_t size = _get_row_bytes(width) * width;
+    gt_res_t ret = GT_RES_FAIL;
 
+    if (style->modules) {
+        return GT_RES_OK;
+    }
+    if (((high * high) >> 3) > _QRCodeDataBuf_SIZE) {
+        GT_LOGE(GT_LOG_TAG_GUI , "get qrcode buff size is small!");
+        return GT_RES_FAIL;
+    }
     qr_data_buff = gt_mem_malloc(_QRDataBuf_SIZE);
     qr_code_buff = gt_mem_malloc(_QRCodeDataBuf_SIZE);
+    if (NULL == qr_data_buff || NULL == qr_code_buff) {
+        goto err_ret;
+    }
     if(!gt_qrcode_init(style->version , qr_data_buff , qr_code_buff))
     {
         GT_LOGE(GT_LOG_TAG_GUI , "qrcode init err!");
@@ -119,6 +166,103 @@ static void _init_cb(gt_obj_st * obj) {
         GT_LOGE(GT_LOG_TAG_GUI , "get qrcode data err!");
         goto err_ret;
     }
+    ++style->stat.encode_count;
+
+    gt_memset_0(qr_code_buff , _QRCodeDataBuf_SIZE);
+    _Data_ReMap(qr_code_buff,qr_data_buff, width, high, 0 );
+
+    /** keep the rows of modules only */
+    style->modules = gt_mem_malloc(size);
+    if (NULL == style->modules) {
+        goto err_ret;
+    }
+    gt_memcpy(style->modules, qr_code_buff, size);
+    style->modules_w = width;
+    ret = GT_RES_OK;
+
+err_ret:
+    if(NULL != qr_data_buff)
+    {
+        gt_mem_free(qr_data_buff);
+        qr_data_buff = NULL;
+    }
+    if(NULL != qr_code_buff)
+    {
+        gt_mem_free(qr_code_buff);
+        qr_code_buff = NULL;
+    }
+    return ret;
+}
+
+/**
+ * @brief Fill the continuous dark modules of the rows within the band,
+ *      one rectangle per run instead of expanding the whole bitmap.
+ *
+ * @param obj
+ * @param rect_attr
+ * @param x The left of the modules
+ * @param y The top of the modules
+ */
+static void _draw_modules(gt_obj_st * obj, gt_attr_rect_st * rect_attr, gt_size_t x, gt_size_t y) {
+    _gt_qr_code_st * style = (_gt_qr_code_st * )obj;
+    gt_area_st const * band = &obj->draw_ctx->buf_area;
+    uint8_t row_bytes = _get_row_bytes(style->modules_w);
+    gt_size_t row = GT_MAX(0, band->y - y);
+    gt_size_t row_end = GT_MIN(style->modules_w, band->y + band->h - y);
+    gt_area_st area = { .h = 1 };
+    gt_area_st modules_area = { .x = x, .y = y, .w = style->modules_w, .h = style->modules_w };
+    uint8_t const * bits = NULL;
+    uint8_t i = 0, start = 0;
+    /** without any mask, runs can be filled directly as draw_bg() does */
+    bool mask_check = gt_mask_check(&modules_area);
+    gt_draw_blend_dsc_st blend_dsc = {
+        .dst_area = &area,
+        .color_fill = rect_attr->bg_color,
+        .view_area = rect_attr->limit_area,
+        .opa = rect_attr->bg_opa,
+    };
+
+    for (; row < row_end; ++row) {
+        bits = &style->modules[row * row_bytes];
+        area.y = y + row;
+        i = 0;
+        while (i < style->modules_w) {
+            /** skip light modules, byte by byte if possible */
+            if (0 == (i & 0x07) && 0x00 == bits[i >> 3]) {
+                i += 8;
+                continue;
+            }
+            if (0 == (bits[i >> 3] & (0x80 >> (i & 0x07)))) {
+                ++i;
+                continue;
+            }
+            start = i;
+            while (i < style->modules_w && (bits[i >> 3] & (0x80 >> (i & 0x07)))) {
+                ++i;
+            }
+            area.x = x + start;
+            area.w = i - start;
+            if (mask_check) {
+                draw_bg(obj->draw_ctx, rect_attr, &area);
+            } else {
+                gt_draw_blend(obj->draw_ctx, &blend_dsc);
+            }
+        }
+    }
+}
+
+/**
+ * @brief obj init obj widget call back
+ *
+ * @param obj
+ */
+static void _init_cb(gt_obj_st * obj) {
+    _gt_qr_code_st * style = (_gt_qr_code_st * )obj;
+    uint32_t start_tick = 0;
+
+    if (GT_RES_OK != _encode_modules(style)) {
+        return;
+    }
 
     /* base shape */
     gt_attr_rect_st rect_attr;
@@ -130,57 +274,23 @@ static void _init_cb(gt_obj_st * obj) {
     rect_attr.fg_color      = gt_color_white();
     rect_attr.border_color  = gt_color_black();
 
-    gt_area_st area;
-
-    area.w = 4 * style->version + 17;
-    area.h = ((area.w + 7) >> 3) << 3;
-    obj->area.w = area.w + 8;
-    obj->area.h = obj->area.w;
-
-    if(  ((area.h * area.h) >> 3 ) > _QRCodeDataBuf_SIZE )
-    {
-        GT_LOGE(GT_LOG_TAG_GUI , "get qrcode buff size is small!");
-        goto err_ret;
-    }
-
-    gt_memset_0(qr_code_buff , _QRCodeDataBuf_SIZE);
-    _Data_ReMap(qr_code_buff,qr_data_buff, area.w, area.h, 0 );
-
-    //
-    gt_mem_free(qr_data_buff);
-    qr_data_buff = NULL;
+    _update_size(obj);
 
     gt_area_st box_area = gt_area_reduce(obj->area , gt_obj_get_reduce(obj));
     // draw background
     rect_attr.bg_color      = obj->bgcolor;
     draw_bg(obj->draw_ctx, &rect_attr, &box_area);
 
-    area.w = ((area.w + 7) >> 3) << 3;
-    // GT_LOGD( GT_LOG_TAG_GUI,"qrcode w = %d , h = %d" , area.w , area.h);
     // draw the qr code
     rect_attr.bg_color      = style->fg_color;
-    rect_attr.gray = 1;
-    rect_attr.data_gray = qr_code_buff;
-    area.x = box_area.x+2;
-    area.y = box_area.y+2;
-    // GT_LOGD(GT_LOG_TAG_UI , "barcode gray = %d" , rect_attr.gray);
-    // 1:base shape
-    draw_bg(obj->draw_ctx, &rect_attr, &area);
+    start_tick = gt_tick_get();
+    _draw_modules(obj, &rect_attr, box_area.x + 2, box_area.y + 2);
+    style->stat.draw_time += gt_tick_get() - start_tick;
 
     // focus
     draw_focus(obj , obj->radius);
 
-err_ret:
-    if(NULL != qr_data_buff)
-    {
-        gt_mem_free(qr_data_buff);
-        qr_data_buff = NULL;
-    }
-    if(NULL != qr_code_buff)
-    {
-        gt_mem_free(qr_code_buff);
-        qr_code_buff = NULL;
-    }
+    ++style->stat.draw_count;
 }
 
 /**
@@ -190,7 +300,12 @@ err_ret:
  */
 static void _deinit_cb(gt_obj_st * obj) {
     GT_LOGV(GT_LOG_TAG_GUI, "start deinit_cb");
-    /* code */
+    _gt_qr_code_st * style = (_gt_qr_code_st * )obj;
+    _free_modules(style);
+    if (NULL != style->str) {
+        gt_mem_free(style->str);
+        style->str = NULL;
+    }
 }
 
 
@@ -237,6 +352,7 @@ gt_obj_st * gt_qrcode_create(gt_obj_st * parent)
     style->mask_patt = MaskPattern4;
     obj->bgcolor = gt_color_white();
     style->fg_color = gt_color_black();
+    _update_size(obj);
     return obj;
 }
 
@@ -247,7 +363,15 @@ void gt_qrcode_set_version(gt_obj_st * qr_code , gt_qr_code_version_em version)
         return ;
     }
     _gt_qr_code_st * style = (_gt_qr_code_st * )qr_code;
+    if (version == style->version) {
+        return;
+    }
+    /** The old area must be redrawn too */
+    gt_event_send(qr_code, GT_EVENT_TYPE_DRAW_START, NULL);
     style->version = version;
+    _free_modules(style);
+    _update_size(qr_code);
+    gt_event_send(qr_code, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 
 void gt_qrcode_set_str(gt_obj_st * qr_code , char* str)
@@ -256,16 +380,23 @@ void gt_qrcode_set_str(gt_obj_st * qr_code , char* str)
         return ;
     }
     _gt_qr_code_st * style = (_gt_qr_code_st * )qr_code;
+    uint16_t size = str == NULL ? 0 : strlen(str);
+    if (style->str && size == style->str_len && (0 == size || 0 == memcmp(style->str, str, size))) {
+        /** The same content, no need to encode again */
+        return;
+    }
     if( NULL != style->str) {
         gt_mem_free(style->str);
     }
-    uint16_t size = str == NULL ? 0 : strlen(str);
+    style->str_len = 0;
     style->str = gt_mem_malloc(size + 1);
     if (style->str) {
         gt_memcpy(style->str, str, size);
         style->str[size] = '\0';
+        style->str_len = size;
     }
-    // gt_event_send(barcode, GT_EVENT_TYPE_DRAW_START, NULL);
+    _free_modules(style);
+    gt_event_send(qr_code, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 
 void gt_qrcode_set_background(gt_obj_st * qr_code , gt_color_t color)
@@ -285,5 +416,18 @@ void gt_qrcode_set_forecolor(gt_obj_st * qr_code , gt_color_t color)
     style->fg_color = color;
 }
 
+void gt_qrcode_get_stat(gt_obj_st * qr_code, gt_qrcode_stat_st * stat)
+{
+    if (NULL == stat) {
+        return;
+    }
+    if (false == gt_obj_is_type(qr_code, OBJ_TYPE)) {
+        gt_memset_0(stat, sizeof(gt_qrcode_stat_st));
+        return;
+    }
+    _gt_qr_code_st * style = (_gt_qr_code_st * )qr_code;
+    gt_memcpy(stat, &style->stat, sizeof(gt_qrcode_stat_st));
+}
+
 #endif  /** GT_CFG_ENABLE_QRCODE */
 /* end ------------------------------------------------------------------*/
@@ -47,6 +47,15 @@ typedef enum qrcode_version_e {
     GT_FAMILY_QRCODE_VERSION_17
 }gt_qr_code_version_em;
 
+/**
+ * @brief The statistics of the QRCode widget
+ */
+typedef struct gt_qrcode_stat_s {
+    uint32_t encode_count;  /** The count of the symbol has been encoded */
+    uint32_t draw_count;    /** The count of the draw callback, once per band */
+    uint32_t draw_time;     /** The total time of drawing the modules, the ticks crossed by each band are summed, unit: ms */
+}gt_qrcode_stat_st;
+
 
 
 /* macros ---------------------------------------------------------------*/
@@ -69,6 +78,15 @@ void gt_qrcode_set_str(gt_obj_st * qr_code , char* str);
 void gt_qrcode_set_background(gt_obj_st * qr_code , gt_color_t color);
 void gt_qrcode_set_forecolor(gt_obj_st * qr_code , gt_color_t color);
 
+/**
+ * @brief Get the statistics of the QRCode, the symbol is encoded only
+ *      when the string or version is changed.
+ *
+ * @param qr_code
+ * @param stat [out] The statistics
+ */
+void gt_qrcode_get_stat(gt_obj_st * qr_code, gt_qrcode_stat_st * stat);
+
 
 #endif  /** GT_CFG_ENABLE_QRCODE */
 
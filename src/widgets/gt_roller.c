@@ -12,6 +12,7 @@
 #include "gt_roller.h"
 
 #if GT_CFG_ENABLE_ROLLER
+#include "stdio.h"
 #include "../others/gt_types.h"
 #include "../core/gt_style.h"
 #include "../core/gt_mem.h"
@@ -19,8 +20,9 @@
 #include "../core/gt_obj_scroll.h"
 #include "../core/gt_graph_base.h"
 #include "../core/gt_draw.h"
+#include "../core/gt_disp.h"
 #include "../others/gt_anim.h"
-#include "gt_label.h"
+#include "../others/gt_math.h"
 
 
 /* private define -------------------------------------------------------*/
@@ -30,6 +32,9 @@
 /** The width of redundancy */
 #define _REDUNDANCY_WIDTH   22
 
+/** The buffer size to format one item of the number options */
+#define _NUMB_ITEM_BUFFER_SIZE  32
+
 /* private typedef ------------------------------------------------------*/
 /**
  * @brief Adsorption alignment state after the end of rolling
@@ -46,7 +51,8 @@ typedef struct {
     uint8_t mode : 2;       //Roller running mode @ref gt_roller_mode_em
     uint8_t state : 2;      //Item scroll snap state @ref _gt_roller_state_em
     uint8_t show_background : 1;    /** 1[default]: show background;  */
-    uint8_t reserved : 3;
+    uint8_t width_valid : 1;        /** 1: The cached widths of items are up to date */
+    uint8_t reserved : 2;
 }_gt_roller_reg_st;
 
 /**
@@ -54,25 +60,31 @@ typedef struct {
  */
 typedef struct _gt_roller_s {
     gt_obj_st obj;
-    gt_obj_st * text;                   // Options text, free by class
+    char * options;                     // Options text stored once, items are separated by '\0'
+    uint16_t * offsets;                 // The start offset of each item within options, same block as options
+    uint16_t * widths;                  // The cached pixel width of each item, same block as options
     gt_anim_st * anim_snap;             // The anim object to scroll snap
+    gt_font_info_st font_info;
+    gt_color_t font_color;
     gt_color_t select_color;            // The color of selected item
-    uint16_t scroll_vertical_length;    // The length of vertical scroll
-    uint16_t selected;                  // The index of selected item, Infinite mode need to calculate the real index
-    uint16_t count_total;                // The total count of items
+    uint16_t max_width;                 // The width of the widest item
+    uint16_t selected;                  // The index of selected item [0, count_total)
+    uint16_t count_total;               // The total count of items
     uint8_t count_of_show;              // The count of items to show within area
     uint8_t line_space;                 // The space between lines
+    uint8_t font_align;                 // @ref gt_align_et
     _gt_roller_reg_st reg;
 }_gt_roller_st;
 
 
 /* static variables -----------------------------------------------------*/
 static void _init_cb(gt_obj_st * obj);
+static void _deinit_cb(gt_obj_st * obj);
 static void _event_cb(struct gt_obj_s * obj, gt_event_st * e);
 
 static GT_ATTRIBUTE_RAM_DATA const gt_obj_class_st gt_roller_class = {
     ._init_cb      = _init_cb,
-    ._deinit_cb    = (_gt_deinit_cb_t)NULL,
+    ._deinit_cb    = _deinit_cb,
     ._event_cb     = _event_cb,
     .type          = OBJ_TYPE,
     .size_style    = sizeof(_gt_roller_st)
@@ -87,6 +99,79 @@ static GT_ATTRIBUTE_RAM_DATA const gt_obj_class_st gt_roller_class = {
 
 
 /* static functions -----------------------------------------------------*/
+static GT_ATTRIBUTE_RAM_TEXT inline uint16_t _get_item_height(_gt_roller_st * style) {
+    return style->font_info.size + style->line_space;
+}
+
+/**
+ * @brief The scroll offset of the first item when it is selected,
+ *      which is the top of the selected bar.
+ */
+static GT_ATTRIBUTE_RAM_TEXT inline gt_size_t _get_top_y(_gt_roller_st * style) {
+    return (style->count_of_show >> 1) * _get_item_height(style);
+}
+
+static GT_ATTRIBUTE_RAM_TEXT inline char * _get_item(_gt_roller_st * style, uint16_t index) {
+    return &style->options[style->offsets[index]];
+}
+
+/**
+ * @brief Draw the visible items only, the first item is placed at the
+ *      scroll offset, the index of rows wraps around in infinite mode.
+ *
+ * @param obj
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _draw_items(gt_obj_st * obj) {
+    _gt_roller_st * style = (_gt_roller_st * )obj;
+    int32_t item_height = _get_item_height(style);
+    int32_t base_y = obj->area.y + obj->process_attr.scroll.y;
+    int32_t row = 0, row_end = 0, index = 0;
+
+    if (0 == style->count_total || 0 == item_height) {
+        return;
+    }
+    /** rows which intersect the widget area, floor division for negative value */
+    row = obj->area.y - base_y;
+    row = row >= 0 ? row / item_height : -((item_height - 1 - row) / item_height);
+    row_end = (obj->area.y + obj->area.h - base_y + item_height - 1) / item_height;
+
+    if (GT_ROLLER_MODE_NORMAL == style->reg.mode) {
+        row = GT_MAX(row, 0);
+        row_end = GT_MIN(row_end, (int32_t)style->count_total);
+    }
+
+    gt_font_st font = {
+        .info       = style->font_info,
+        .res        = NULL,
+    };
+    gt_font_info_update_font_thick(&font.info);
+
+    gt_attr_font_st font_attr = {
+        .font       = &font,
+        .font_color = style->font_color,
+        .space_x    = 0,
+        .space_y    = style->line_space,
+        .align      = style->font_align,
+        .opa        = obj->opa,
+        .logical_area = {
+            .x = obj->area.x,
+            .w = obj->area.w,
+            .h = item_height,
+        },
+    };
+
+    for (; row < row_end; row++) {
+        index = row % (int32_t)style->count_total;
+        if (index < 0) {
+            index += style->count_total;
+        }
+        font.utf8 = _get_item(style, index);
+        font.len = strlen(font.utf8);
+        font_attr.logical_area.y = base_y + row * item_height + (style->line_space >> 1);
+        draw_text(obj->draw_ctx, &font_attr, &obj->area);
+    }
+}
+
 static void _init_cb(gt_obj_st * obj) {
     _gt_roller_st * style = (_gt_roller_st * )obj;
     gt_attr_rect_st rect_attr;
@@ -117,91 +202,59 @@ static void _init_cb(gt_obj_st * obj) {
 
     draw_bg(obj->draw_ctx, &rect_attr, &selected);
 
-    draw_focus(obj, obj->radius);
-}
-
-/**
- * @brief The index is calculated according to the actual number of items
- *
- * @param index The index of selected item
- * @param total The total count of lines
- * @return uint8_t The index of selected item
- */
-static inline uint16_t _get_infinite_real_selected_index(gt_size_t index, uint16_t total) {
-    return index % (total / GT_ROLLER_INFINITE_PAGES_COUNT);
-}
+    _draw_items(obj);
 
-/**
- * @brief Reset the change increment in infinite scroll mode
- *
- * @param total_length Total rolling distance
- * @return uint16_t The increase in variation
- */
-static inline uint16_t _get_infinite_scroll_increment(uint16_t total_length) {
-    return ((GT_ROLLER_INFINITE_PAGES_COUNT >> 1) * total_length) / GT_ROLLER_INFINITE_PAGES_COUNT;
+    draw_focus(obj, obj->radius);
 }
 
-/**
- * @brief Calc total line count and total height value
- *
- * @param obj
- * @param options The text of items
- */
-static GT_ATTRIBUTE_RAM_TEXT void _calc_scroll_vertical_length(gt_obj_st * obj, char const * const options) {
+static void _deinit_cb(gt_obj_st * obj) {
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    gt_size_t len = strlen(options);
-    gt_size_t count = 1;
-    gt_size_t i = 0;
-    for (i = 0; i < len; i++) {
-        if ('\n' == options[i]) {
-            ++count;
-        }
-    }
-    style->count_total = count;
-    if (GT_ROLLER_MODE_INFINITE == style->reg.mode) {
-        style->scroll_vertical_length = count *
-            (gt_label_get_font_size(style->text) + gt_label_get_space_y(style->text));
-    } else {
-        style->scroll_vertical_length = (count - style->count_of_show) *
-            (gt_label_get_font_size(style->text) + gt_label_get_space_y(style->text));
+
+    if (style->offsets) {
+        /** offsets is the head of the items memory block */
+        gt_mem_free(style->offsets);
+        style->offsets = NULL;
     }
+    style->widths = NULL;
+    style->options = NULL;
+    style->count_total = 0;
 }
 
 /**
- * @brief limit label position y value
+ * @brief limit scroll offset value, normal mode is limited between the
+ *      first and the last item; infinite mode wraps around by the height
+ *      of all items, so the offset never grows with the scroll distance.
  *
  * @param obj
  * @param val The y value of current time.
- * @return gt_size_t The real value where label be set to.
+ * @return gt_size_t The real scroll offset.
  */
 static GT_ATTRIBUTE_RAM_TEXT gt_size_t _normal_limit_y(gt_obj_st * obj, gt_size_t val) {
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    gt_size_t ret_val = val;
-    gt_size_t top_y = (style->count_of_show >> 1) * (obj->area.h / style->count_of_show);
-    gt_size_t bottom_y = - style->scroll_vertical_length - top_y;
+    gt_size_t top_y = _get_top_y(style);
+    int32_t item_height = _get_item_height(style);
 
-    if (GT_ROLLER_MODE_NORMAL == style->reg.mode) {
-        if (val > top_y) {
-            /** limit top */
-            ret_val = top_y;
-        }
-        else if (val < bottom_y) {
-            ret_val = bottom_y;
+    if (0 == style->count_total || 0 == item_height) {
+        return top_y;
+    }
+    if (GT_ROLLER_MODE_INFINITE == style->reg.mode) {
+        int32_t period = item_height * style->count_total;
+        int32_t offset = (top_y - val) % period;
+        if (offset < 0) {
+            offset += period;
         }
+        return top_y - offset;
     }
-    else if (GT_ROLLER_MODE_INFINITE == style->reg.mode) {
-        top_y = -style->scroll_vertical_length / GT_ROLLER_INFINITE_PAGES_COUNT;
-        bottom_y = -style->scroll_vertical_length - top_y;
 
-        if (val > top_y) {
-            /** limit top, reset to bottom */
-            ret_val -= _get_infinite_scroll_increment(style->scroll_vertical_length);
-        }
-        else if (val < bottom_y) {
-            ret_val += _get_infinite_scroll_increment(style->scroll_vertical_length);
-        }
+    gt_size_t bottom_y = top_y - (style->count_total - 1) * item_height;
+    if (val > top_y) {
+        /** limit top */
+        return top_y;
     }
-    return ret_val;
+    else if (val < bottom_y) {
+        return bottom_y;
+    }
+    return val;
 }
 
 static GT_ATTRIBUTE_RAM_TEXT inline void _delay_scroll_snap_anim(_gt_roller_st * style) {
@@ -214,11 +267,12 @@ static GT_ATTRIBUTE_RAM_TEXT inline void _delay_scroll_snap_anim(_gt_roller_st *
 
 static GT_ATTRIBUTE_RAM_TEXT void _scroll_text_handler(gt_obj_st * obj) {
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    if (NULL == style->text) {
-        return;
-    }
+
     obj->process_attr.scroll.y = _normal_limit_y(obj, gt_obj_scroll_get_y(obj));
-    gt_obj_set_pos(style->text, obj->area.x, obj->area.y + obj->process_attr.scroll.y + (style->line_space >> 1));
+    if (obj->process_attr.scroll.y != obj->process_attr.scroll_prev.y) {
+        obj->process_attr.scroll_prev.y = obj->process_attr.scroll.y;
+        gt_disp_invalid_area(obj);
+    }
 
     if (_SCROLL_SNAP_READY == style->reg.state) {
         _delay_scroll_snap_anim(style);
@@ -236,10 +290,13 @@ static GT_ATTRIBUTE_RAM_TEXT void _notify_update_value_ready_cb(struct gt_anim_s
 
 static GT_ATTRIBUTE_RAM_TEXT void _select_target_item(gt_obj_st * obj) {
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    uint16_t item_height = style->text->area.h / style->count_total;
-    uint16_t item_offset = gt_abs(obj->process_attr.scroll.y - (style->count_of_show >> 1) * item_height);
+    uint16_t item_height = _get_item_height(style);
+    uint16_t item_offset = gt_abs(obj->process_attr.scroll.y - _get_top_y(style));
 
-    style->selected = item_offset / item_height;
+    if (0 == item_height || 0 == style->count_total) {
+        return;
+    }
+    style->selected = (item_offset / item_height) % style->count_total;
 
     gt_anim_st anim;
     gt_anim_init(&anim);
@@ -254,14 +311,12 @@ static GT_ATTRIBUTE_RAM_TEXT void _select_target_item(gt_obj_st * obj) {
 static GT_ATTRIBUTE_RAM_TEXT void _scroll_snap(gt_obj_st * obj) {
     _gt_roller_st * style = (_gt_roller_st * )obj;
     gt_size_t scroll_y = gt_obj_scroll_get_y(obj);
-
-    if (GT_ROLLER_MODE_INFINITE == style->reg.mode) {
-        scroll_y = _normal_limit_y(obj, scroll_y);
-    }
-
     gt_size_t target_y = scroll_y;
-    gt_size_t item_height = gt_label_get_font_size(style->text) + gt_label_get_space_y(style->text);
+    gt_size_t item_height = _get_item_height(style);
 
+    if (0 == item_height) {
+        return;
+    }
     if (gt_obj_is_scroll_up(obj)) {
         if (scroll_y < 0) {
             target_y -= (scroll_y % item_height) + item_height;
@@ -285,7 +340,10 @@ static GT_ATTRIBUTE_RAM_TEXT void _scroll_snap(gt_obj_st * obj) {
         /** Do not scroll by anim when target y equal to current scroll value */
         return;
     }
-    target_y = _normal_limit_y(obj, target_y);
+    if (GT_ROLLER_MODE_NORMAL == style->reg.mode) {
+        /** infinite mode keeps the distance, the offset is wrapped while scrolling */
+        target_y = _normal_limit_y(obj, target_y);
+    }
     gt_obj_scroll_to_y(obj, target_y - scroll_y, GT_ANIM_ON);
 }
 
@@ -351,68 +409,188 @@ static GT_ATTRIBUTE_RAM_TEXT inline bool _set_mode(_gt_roller_st * style, gt_rol
 }
 
 /**
- * @brief Resize roller height, include label widget
+ * @brief Resize roller height by the count of items to show
  *
  * @param obj
  */
 static GT_ATTRIBUTE_RAM_TEXT void _resize_display_area_height(gt_obj_st * obj) {
     _gt_roller_st * style = (_gt_roller_st * )obj;
 
-    if (NULL == style->text) {
+    if (NULL == style->options) {
         return;
     }
 
-    if (0 == gt_label_get_font_size(style->text)) {
+    if (0 == style->font_info.size) {
         return;
     }
 
-    gt_obj_set_size(obj, obj->area.w,
-        (gt_label_get_font_size(style->text) + gt_label_get_space_y(style->text)) * style->count_of_show);
-
-    gt_obj_set_size(style->text, obj->area.w,
-        style->count_total * (gt_label_get_font_size(style->text) + gt_label_get_space_y(style->text)));
+    gt_obj_set_size(obj, obj->area.w, _get_item_height(style) * style->count_of_show);
 }
 
+/**
+ * @brief Reset the height and keep the selected item within the selected bar
+ *
+ * @param obj
+ */
 static GT_ATTRIBUTE_RAM_TEXT void _reset_scroll_size(gt_obj_st * obj) {
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _calc_scroll_vertical_length(obj, gt_label_get_text(style->text));
 
     _resize_display_area_height(obj);
-    /** set position and scroll default position, top margin half of space y size */
 
-    obj->process_attr.scroll.y = (style->count_of_show >> 1) * (obj->area.h / style->count_of_show);
+    if (style->selected >= style->count_total) {
+        style->selected = 0;
+    }
+    obj->process_attr.scroll.y = _get_top_y(style) - style->selected * _get_item_height(style);
     _scroll_text_handler(obj);
+    gt_disp_invalid_area(obj);
 }
 
-static GT_ATTRIBUTE_RAM_TEXT gt_obj_st * _create_text(gt_obj_st * obj) {
-    _gt_roller_st * style = (_gt_roller_st * )obj;
-    if (style->text) {
-        return style->text;
+/**
+ * @brief Measure the width of all items, only when options or font changed
+ *
+ * @param style
+ * @return uint16_t The width of the widest item
+ */
+static GT_ATTRIBUTE_RAM_TEXT uint16_t _get_max_width(_gt_roller_st * style) {
+    if (style->reg.width_valid) {
+        return style->max_width;
+    }
+    style->max_width = 0;
+    for (uint16_t i = 0; i < style->count_total; i++) {
+        style->widths[i] = gt_font_get_longest_line_substring_width(&style->font_info, _get_item(style, i), 0);
+        if (style->widths[i] > style->max_width) {
+            style->max_width = style->widths[i];
+        }
     }
-
-    style->text = gt_label_create(obj);
-    gt_label_set_font_align(style->text, GT_ALIGN_CENTER);
-    gt_obj_set_focus_disabled(style->text, GT_DISABLED);
-    return style->text;
+    style->reg.width_valid = true;
+    return style->max_width;
 }
 
 static GT_ATTRIBUTE_RAM_TEXT void _resize_display_width(gt_obj_st * obj) {
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    if (NULL == style->text) {
+    if (0 == style->count_total) {
         return;
     }
-    char * options = gt_label_get_text(style->text);
-    if (NULL == options || 0 == strlen(options)) {
-        return;
-    }
-    uint16_t max_width = gt_label_get_longest_line_substring_width(style->text);
+    uint16_t max_width = _get_max_width(style);
     max_width += _REDUNDANCY_WIDTH;
 
     if (max_width <= obj->area.w) {
         return;
     }
     gt_obj_set_size(obj, max_width, obj->area.h);
-    gt_obj_set_size(style->text, max_width, obj->area.h);
+}
+
+/**
+ * @brief The font style has been changed, the cached widths need to be updated
+ *
+ * @param obj
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _update_font_style(gt_obj_st * obj) {
+    _gt_roller_st * style = (_gt_roller_st * )obj;
+
+    style->reg.width_valid = false;
+    _resize_display_width(obj);
+    gt_event_send(obj, GT_EVENT_TYPE_DRAW_START, NULL);
+}
+
+/**
+ * @brief Store the options once and index the items by offset,
+ *      items memory layout: [offsets][widths][options text]
+ *
+ * @param obj
+ * @param options "\n" is used to distinguish items
+ * @param len The byte length of options
+ * @return true success
+ */
+static GT_ATTRIBUTE_RAM_TEXT bool _set_options_text(gt_obj_st * obj, const char * options, uint32_t len) {
+    _gt_roller_st * style = (_gt_roller_st * )obj;
+    uint32_t count = 1, i = 0;
+
+    if (len >= 0xFFFF) {
+        GT_LOGW(GT_LOG_TAG_GUI, "roller options is too long: %lu", (unsigned long)len);
+        return false;
+    }
+    for (i = 0; i < len; i++) {
+        if ('\n' == options[i]) {
+            ++count;
+        }
+    }
+    uint32_t size = (count << 1) * sizeof(uint16_t) + len + 1;
+    uint16_t * block = (uint16_t * )(style->offsets ? gt_mem_realloc(style->offsets, size) : gt_mem_malloc(size));
+    if (NULL == block) {
+        return false;
+    }
+    style->offsets = block;
+    style->widths = &block[count];
+    style->options = (char * )&block[count << 1];
+    gt_memcpy(style->options, options, len);
+    style->options[len] = '\0';
+
+    style->offsets[0] = 0;
+    for (i = 0, count = 1; i < len; i++) {
+        if ('\n' == style->options[i]) {
+            style->options[i] = '\0';
+            style->offsets[count++] = i + 1;
+        }
+    }
+    style->count_total = count;
+    style->reg.width_valid = false;
+    return true;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT void _apply_options(gt_obj_st * obj) {
+    _resize_display_width(obj);
+    _reset_scroll_size(obj);
+    gt_obj_set_scroll_dir(obj, GT_SCROLL_VERTICAL);
+}
+
+/**
+ * @brief Format the number options into one text, the values are the same
+ *      as the items of infinite mode, which only be stored once.
+ *
+ * @param fmt The format of one item
+ * @param len [out] The byte length of the result
+ * @return char* The result text need to be free by caller, NULL: failed
+ */
+static GT_ATTRIBUTE_RAM_TEXT char * _format_numb_options(const char * fmt,
+    double min, double max, double step, uint32_t * len) {
+    char item[_NUMB_ITEM_BUFFER_SIZE];
+    char * text = NULL, * tmp = NULL;
+    uint32_t cap = 0;
+    int size = 0;
+    double v_max = max + (1e-9);
+
+    *len = 0;
+    for (double i = min; i <= v_max; i += step) {
+        if (i > -step && i < step) {
+            i = 0;
+        }
+        size = snprintf(item, sizeof(item), fmt, i);
+        if (size < 0) {
+            continue;
+        }
+        if (size > (int)sizeof(item) - 1) {
+            size = sizeof(item) - 1;
+        }
+        if (*len + size + 2 > cap) {
+            cap = (cap ? cap + (cap >> 1) : 64) + size + 2;
+            tmp = (char * )(text ? gt_mem_realloc(text, cap) : gt_mem_malloc(cap));
+            if (NULL == tmp) {
+                break;
+            }
+            text = tmp;
+        }
+        gt_memcpy(&text[*len], item, size);
+        *len += size;
+        text[(*len)++] = '\n';
+    }
+    if (NULL == text) {
+        return NULL;
+    }
+    /** remove the last separator */
+    *len = *len ? *len - 1 : 0;
+    text[*len] = '\0';
+    return text;
 }
 
 /* global functions / API interface -------------------------------------*/
@@ -427,6 +605,9 @@ gt_obj_st * gt_roller_create(gt_obj_st * parent)
     style->line_space = 10;
     style->reg.show_background = true;
     style->select_color = gt_color_hex(0x00a8ff);
+    style->font_color = gt_color_hex(0x00);
+    style->font_align = GT_ALIGN_CENTER;
+    gt_font_info_init(&style->font_info);
 
     obj->fixed = false;
     obj->area.w = 60;
@@ -460,7 +641,9 @@ void gt_roller_set_display_item_count(gt_obj_st * obj, uint8_t count)
         style->count_of_show = count - ((0 == (count & 0x1)) ? 1 : 0);
     }
 
-    _resize_display_area_height(obj);
+    if (style->options) {
+        _reset_scroll_size(obj);
+    }
 }
 
 void gt_roller_set_options(gt_obj_st * obj, char * options, gt_roller_mode_em mode)
@@ -472,44 +655,17 @@ void gt_roller_set_options(gt_obj_st * obj, char * options, gt_roller_mode_em mo
     if (NULL == options) {
         return;
     }
-    if (false == _set_mode(style, mode)) {
+    if (GT_ROLLER_MODE_NORMAL != mode && GT_ROLLER_MODE_INFINITE != mode) {
+        /** other unknown mode */
         return;
     }
-
-    if (GT_ROLLER_MODE_NORMAL == mode) {
-        _create_text(obj);
-        gt_label_set_text(style->text, options);
-    }
-    else if (GT_ROLLER_MODE_INFINITE == mode) {
-        _create_text(obj);
-        gt_size_t len = strlen(options) + 1;
-        char * infinite_options = gt_mem_malloc(len * GT_ROLLER_INFINITE_PAGES_COUNT);
-        if (NULL == infinite_options) {
-            return;
-        }
-        for (uint16_t i = 0; i < GT_ROLLER_INFINITE_PAGES_COUNT; i++) {
-            gt_memcpy(&infinite_options[i * len], options, len);
-            infinite_options[(i + 1) * len - 1] = '\n';
-        }
-        infinite_options[GT_ROLLER_INFINITE_PAGES_COUNT * len - 1] = '\0';
-        gt_label_set_text(style->text, infinite_options);
-
-        if (infinite_options) {
-            gt_mem_free(infinite_options);
-            infinite_options = NULL;
-        }
+    if (false == _set_mode(style, mode)) {
+        return;
     }
-    else {
-        /** other unknown mode */
+    if (false == _set_options_text(obj, options, strlen(options))) {
         return;
     }
-    _resize_display_width(obj);
-    gt_label_set_space(style->text, 0, style->line_space);
-
-    gt_obj_set_fixed(style->text, true);
-    _reset_scroll_size(obj);
-    gt_obj_set_inside(style->text, true);
-    gt_obj_set_scroll_dir(obj, GT_SCROLL_VERTICAL);
+    _apply_options(obj);
 }
 
 
@@ -521,61 +677,27 @@ void gt_roller_set_options_numb(gt_obj_st* obj, gt_roller_mode_em mode, \
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
 
+    if (GT_ROLLER_MODE_NORMAL != mode && GT_ROLLER_MODE_INFINITE != mode) {
+        return;
+    }
     if (false == _set_mode(style, mode)) {
         return;
     }
-
-    uint16_t len = fmt ? strlen(fmt) : 0;
-    char* buffer = gt_mem_malloc(len + 4);
-    gt_memset(buffer, 0, len + 2);
-
-    if(0 == len){
-        buffer[0] = '%';
-        buffer[1] = 'd';
-        len = 2;
-        buffer[2] = '\0';
-        buffer[3] = '\0';
-    }else{
-        gt_memcpy(buffer, fmt, len);
+    if (step <= 0) {
+        return;
     }
-
-    double v_max = max + (1e-9);
-    if (GT_ROLLER_MODE_NORMAL == mode) {
-        _create_text(obj);
-        gt_label_set_text(style->text, "");
-        for(double i = min; i <= v_max; i += step) {
-            if(i > v_max - step){
-                buffer[len] = '\0';
-            }
-            else{
-                buffer[len] = '\n';
-            }
-            if(i > -step && i < step){
-                i = 0;
-            }
-            gt_label_add_text(style->text, buffer, i);
-        }
-    }else if (GT_ROLLER_MODE_INFINITE == mode) {
-        _create_text(obj);
-        gt_label_set_text(style->text, "");
-        buffer[len] = '\n';
-        for(uint8_t n = 0; n < GT_ROLLER_INFINITE_PAGES_COUNT; n++){
-            for(double i = min; i <= v_max; i += step) {
-                if(i > -step && i < step){
-                    i = 0;
-                }
-                gt_label_add_text(style->text, buffer, i);
-            }
-        }
+    uint32_t len = 0;
+    char * text = _format_numb_options((NULL == fmt || 0 == strlen(fmt)) ? "%d" : fmt, min, max, step, &len);
+    if (NULL == text) {
+        return;
     }
+    bool ret = _set_options_text(obj, text, len);
+    gt_mem_free(text);
+    text = NULL;
 
-    _resize_display_width(obj);
-    gt_label_set_space(style->text, 0, style->line_space);
-
-    gt_obj_set_fixed(style->text, true);
-    _reset_scroll_size(obj);
-    gt_obj_set_inside(style->text, true);
-    gt_obj_set_scroll_dir(obj, GT_SCROLL_VERTICAL);
+    if (ret) {
+        _apply_options(obj);
+    }
 }
 void gt_roller_set_select_bgcolor(gt_obj_st * obj, gt_color_t color)
 {
@@ -597,7 +719,9 @@ gt_res_t gt_roller_set_selected(gt_obj_st * obj, gt_size_t index)
         /** Prevent intermediate animation events from being removed */
         return GT_RES_INV;
     }
-    gt_size_t diff_count = index - style->selected;
+    if (0 == style->count_total) {
+        return GT_RES_FAIL;
+    }
 
     if (GT_ROLLER_MODE_NORMAL == style->reg.mode) {
         if (index < 0) {
@@ -606,21 +730,20 @@ gt_res_t gt_roller_set_selected(gt_obj_st * obj, gt_size_t index)
             return GT_RES_FAIL;
         }
     } else if (GT_ROLLER_MODE_INFINITE == style->reg.mode) {
-        if (index > style->count_total / GT_ROLLER_INFINITE_PAGES_COUNT) {
+        if (index > style->count_total) {
             return GT_RES_FAIL;
         }
-        diff_count = index - _get_infinite_real_selected_index(style->selected, style->count_total);
     }
-    if (0 == diff_count || index == style->selected) {
+    gt_size_t diff_count = index - style->selected;
+    if (0 == diff_count) {
         /** avoid state can not change to done */
         return GT_RES_OK;
     }
-    uint16_t item_height = style->text->area.h / style->count_total;
 
-    obj->process_attr.scroll.y -= item_height * diff_count;
+    obj->process_attr.scroll.y -= _get_item_height(style) * diff_count;
     _scroll_text_handler(obj);
     if (GT_ROLLER_MODE_INFINITE == style->reg.mode) {
-        style->selected = _get_infinite_real_selected_index(index < 0 ? (style->count_total - 1) : index, style->count_total);
+        style->selected = index < 0 ? (style->count_total - 1) : (index % style->count_total);
     } else {
         style->selected = index;
     }
@@ -638,7 +761,9 @@ gt_res_t gt_roller_set_selected_anim(gt_obj_st * obj, gt_size_t index)
         /** Prevent intermediate animation events from being removed */
         return GT_RES_INV;
     }
-    gt_size_t diff_count = index - style->selected;
+    if (0 == style->count_total) {
+        return GT_RES_FAIL;
+    }
 
     if (GT_ROLLER_MODE_NORMAL == style->reg.mode) {
         if (index < 0) {
@@ -647,19 +772,18 @@ gt_res_t gt_roller_set_selected_anim(gt_obj_st * obj, gt_size_t index)
             return GT_RES_FAIL;
         }
     } else if (GT_ROLLER_MODE_INFINITE == style->reg.mode) {
-        if (index > style->count_total / GT_ROLLER_INFINITE_PAGES_COUNT) {
+        if (index > style->count_total) {
             return GT_RES_FAIL;
         }
-        diff_count = index - _get_infinite_real_selected_index(style->selected, style->count_total);
     }
-    if (0 == diff_count || index == style->selected) {
+    gt_size_t diff_count = index - style->selected;
+    if (0 == diff_count) {
         /** avoid state can not change to done */
         return GT_RES_OK;
     }
-    uint16_t item_height = style->text->area.h / style->count_total;
 
     style->reg.state = _SCROLL_SNAP_READY;
-    gt_obj_scroll_to_y(obj, -item_height * diff_count, GT_ANIM_ON);
+    gt_obj_scroll_to_y(obj, -_get_item_height(style) * diff_count, GT_ANIM_ON);
 
     return GT_RES_OK;
 }
@@ -670,41 +794,28 @@ gt_size_t gt_roller_get_selected(gt_obj_st * obj)
         return -1;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    if (GT_ROLLER_MODE_INFINITE == style->reg.mode) {
-        return _get_infinite_real_selected_index(style->selected, style->count_total);
-    }
     return style->selected;
 }
 
 bool gt_roller_get_selected_text(gt_obj_st * obj, char * result, uint16_t result_buffer_len)
 {
-    if (NULL == result) {
+    if (NULL == result || 0 == result_buffer_len) {
         return false;
     }
     if (false == gt_obj_is_type(obj, OBJ_TYPE)) {
         return false;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    char * text = gt_label_get_text(style->text);
-    uint16_t offset = 0;
-    uint16_t i = 0, len = strlen(text), count = 0;
-
-    for (i = 0; i < len; i++) {
-        if ('\n' == text[i]) {
-            ++count;
-            continue;
-        }
+    uint16_t len = 0;
 
-        if (count == style->selected && offset < result_buffer_len) {
-            result[offset++] = text[i];
-        }
-        else if (count > style->selected) {
-            break;
-        }
+    if (style->selected < style->count_total) {
+        char * item = _get_item(style, style->selected);
+        len = GT_MIN(strlen(item), result_buffer_len - 1);
+        gt_memcpy(result, item, len);
     }
-    result[offset] = '\0';
+    result[len] = '\0';
 
-    return offset ? true : false;
+    return len ? true : false;
 }
 
 gt_res_t gt_roller_set_selected_text(gt_obj_st * obj, const char * select)
@@ -715,36 +826,14 @@ gt_res_t gt_roller_set_selected_text(gt_obj_st * obj, const char * select)
     if (false == gt_obj_is_type(obj, OBJ_TYPE)) {
         return GT_RES_FAIL;
     }
-    uint16_t s_len = strlen(select);
-    if(s_len == 0){
+    if(0 == strlen(select)){
         return GT_RES_FAIL;
     }
 
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    char* text = gt_label_get_text(style->text);
-    uint16_t offset = 0, idx = 0;
-    uint16_t i = 0, len = strlen(text);
-
-    for(i = 0; i < len; ++i){
-        if('\n' == text[i]){
-
-            if (s_len == offset) {
-                if (0 == memcmp(text + i - offset, select, s_len)) {
-                    gt_roller_set_selected(obj, idx);
-                    return GT_RES_OK;
-                }
-            }
-
-            ++idx;
-            offset = 0;
-            continue;
-        }
-        ++offset;
-    }
-
-    if (s_len == offset) {
-        if (0 == memcmp(text + i - offset, select, s_len)) {
-            gt_roller_set_selected(obj, idx);
+    for (uint16_t i = 0; i < style->count_total; ++i) {
+        if (0 == strcmp(_get_item(style, i), select)) {
+            gt_roller_set_selected(obj, i);
             return GT_RES_OK;
         }
     }
@@ -770,9 +859,6 @@ uint8_t gt_roller_get_total_count(gt_obj_st * obj)
         return 0;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    if (GT_ROLLER_MODE_INFINITE == style->reg.mode) {
-        return style->count_total / GT_ROLLER_INFINITE_PAGES_COUNT;
-    }
     return style->count_total;
 }
 
@@ -784,8 +870,6 @@ void gt_roller_set_line_space(gt_obj_st * obj, uint8_t space)
     _gt_roller_st * style = (_gt_roller_st * )obj;
     style->line_space = space;
 
-    _create_text(obj);
-    gt_label_set_space(style->text, 0, style->line_space);
     _reset_scroll_size(obj);
     _resize_display_width(obj);
 }
@@ -796,8 +880,8 @@ void gt_roller_set_font_color(gt_obj_st * obj, gt_color_t color)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_color(style->text, color);
+    style->font_color = color;
+    gt_event_send(obj, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 
 void gt_roller_set_font_size(gt_obj_st * obj, uint8_t size)
@@ -806,9 +890,11 @@ void gt_roller_set_font_size(gt_obj_st * obj, uint8_t size)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_size(style->text, size);
-    _resize_display_width(obj);
+    style->font_info.size = size;
+    _update_font_style(obj);
+    if (style->options) {
+        _reset_scroll_size(obj);
+    }
 }
 
 void gt_roller_set_font_gray(gt_obj_st * obj, uint8_t gray)
@@ -817,9 +903,8 @@ void gt_roller_set_font_gray(gt_obj_st * obj, uint8_t gray)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_gray(style->text, gray);
-    _resize_display_width(obj);
+    style->font_info.gray = gray;
+    _update_font_style(obj);
 }
 
 void gt_roller_set_font_align(gt_obj_st * obj, gt_align_et align)
@@ -828,8 +913,8 @@ void gt_roller_set_font_align(gt_obj_st * obj, gt_align_et align)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_align(style->text, align);
+    style->font_align = align;
+    gt_event_send(obj, GT_EVENT_TYPE_DRAW_START, NULL);
 }
 #if (defined(GT_FONT_FAMILY_OLD_ENABLE) && (GT_FONT_FAMILY_OLD_ENABLE == 1))
 void gt_roller_set_font_family_cn(gt_obj_st * obj, gt_family_t family)
@@ -838,9 +923,8 @@ void gt_roller_set_font_family_cn(gt_obj_st * obj, gt_family_t family)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_family_cn(style->text, family);
-    _resize_display_width(obj);
+    style->font_info.style_cn = family;
+    _update_font_style(obj);
 }
 
 void gt_roller_set_font_family_en(gt_obj_st * obj, gt_family_t family)
@@ -849,9 +933,8 @@ void gt_roller_set_font_family_en(gt_obj_st * obj, gt_family_t family)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_family_en(style->text, family);
-    _resize_display_width(obj);
+    style->font_info.style_en = family;
+    _update_font_style(obj);
 }
 
 void gt_roller_set_font_family_fl(gt_obj_st * obj, gt_family_t family)
@@ -860,9 +943,8 @@ void gt_roller_set_font_family_fl(gt_obj_st * obj, gt_family_t family)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_family_fl(style->text, family);
-    _resize_display_width(obj);
+    style->font_info.style_fl = family;
+    _update_font_style(obj);
 }
 
 void gt_roller_set_font_family_numb(gt_obj_st * obj, gt_family_t family)
@@ -871,9 +953,8 @@ void gt_roller_set_font_family_numb(gt_obj_st * obj, gt_family_t family)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_family_numb(style->text, family);
-    _resize_display_width(obj);
+    style->font_info.style_numb = family;
+    _update_font_style(obj);
 }
 #else
 void gt_roller_set_font_family(gt_obj_st * obj, gt_family_t family)
@@ -882,9 +963,8 @@ void gt_roller_set_font_family(gt_obj_st * obj, gt_family_t family)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_family(style->text, family);
-    _resize_display_width(obj);
+    gt_font_set_family(&style->font_info, family);
+    _update_font_style(obj);
 }
 void gt_roller_set_font_cjk(gt_obj_st* obj, gt_font_cjk_et cjk)
 {
@@ -892,9 +972,8 @@ void gt_roller_set_font_cjk(gt_obj_st* obj, gt_font_cjk_et cjk)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_cjk(style->text, cjk);
-    _resize_display_width(obj);
+    style->font_info.cjk = cjk;
+    _update_font_style(obj);
 }
 #endif
 void gt_roller_set_font_thick_en(gt_obj_st * obj, uint8_t thick)
@@ -903,9 +982,8 @@ void gt_roller_set_font_thick_en(gt_obj_st * obj, uint8_t thick)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_thick_en(style->text, thick);
-    _resize_display_width(obj);
+    style->font_info.thick_en = thick;
+    _update_font_style(obj);
 }
 
 void gt_roller_set_font_thick_cn(gt_obj_st * obj, uint8_t thick)
@@ -914,9 +992,8 @@ void gt_roller_set_font_thick_cn(gt_obj_st * obj, uint8_t thick)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_thick_cn(style->text, thick);
-    _resize_display_width(obj);
+    style->font_info.thick_cn = thick;
+    _update_font_style(obj);
 }
 
 void gt_roller_set_font_style(gt_obj_st * obj, gt_font_style_et font_style)
@@ -925,9 +1002,8 @@ void gt_roller_set_font_style(gt_obj_st * obj, gt_font_style_et font_style)
         return ;
     }
     _gt_roller_st * style = (_gt_roller_st * )obj;
-    _create_text(obj);
-    gt_label_set_font_style(style->text, font_style);
-    _resize_display_width(obj);
+    style->font_info.style.all = font_style;
+    _update_font_style(obj);
 }
 
 #endif  /** GT_CFG_ENABLE_ROLLER */
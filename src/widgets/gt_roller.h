@@ -26,7 +26,9 @@ extern "C" {
 /* define ---------------------------------------------------------------*/
 
 /**
- * @brief The number of pages of the project template is used to cache infinite churn
+ * @brief [Deprecated] Infinite mode no longer repeats the options by pages,
+ *      the options are stored once and the visible items wrap around.
+ *      Kept for compatibility only.
  */
 #define GT_ROLLER_INFINITE_PAGES_COUNT  7
 
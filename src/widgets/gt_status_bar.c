@@ -18,6 +18,7 @@
 #include "../hal/gt_hal_disp.h"
 #include "../core/gt_disp.h"
 #include "../core/gt_draw.h"
+#include "../core/gt_hit_grid.h"
 #include "../core/gt_graph_base.h"
 #include "../widgets/gt_obj.h"
 #include "../widgets/gt_img.h"
@@ -353,6 +354,9 @@ gt_obj_st * gt_status_bar_create(bool have_background)
     GT_CHECK_BACK_VAL(obj, NULL);
     obj->area = disp->layer_top->area;
     obj->area.h = _DEFAULT_HEIGHT;
+#if GT_USE_OBJ_HIT_GRID
+    _gt_hit_grid_update(obj);
+#endif
 
     _gt_status_bar_st * style = (_gt_status_bar_st * )obj;
     gt_font_info_init(&style->font_info);
@@ -15,6 +15,7 @@
 #include "../core/gt_draw.h"
 #include "../core/gt_disp.h"
 #include "../utils/gt_vector.h"
+#include "../others/gt_area.h"
 
 
 /* private define -------------------------------------------------------*/
@@ -25,14 +26,11 @@
 /* private typedef ------------------------------------------------------*/
 typedef struct _gt_table_col_s {
     gt_align_et align;
-    uint16_t max_width;
+    uint16_t max_width;     /** The display width of the column */
+    uint16_t text_width;    /** The longest text width of the column, measured when the text is added */
+    uint8_t fixed : 1;      /** 1: text_width is set by user, the texts are not measured */
 }_gt_table_col_st;
 
-typedef struct {
-    uint16_t idx;           /** row index, begin from 1 */
-    uint16_t max_height;
-}_gt_table_row_item_st;
-
 typedef struct _gt_table_s {
     gt_obj_st obj;
 
@@ -45,13 +43,24 @@ typedef struct _gt_table_s {
     _gt_vector_st * header;
     _gt_vector_st * contents;
 
-    _gt_vector_st * row_el;
+    /**
+     * The top of each row relative to the top of the contents, row_count + 1 items,
+     * row_offset[i + 1] - row_offset[i] is the row height include the border.
+     */
+    uint16_t * row_offset;
+    uint16_t row_count;     /** The count of rows which are measured */
+    uint16_t row_cap;
 
+    gt_table_cell_cb_t cell_cb;     /** data-source mode, NULL: use contents */
+    void * cell_user_data;
+    uint16_t source_rows;
 
     uint16_t height_header;
     uint16_t height_contents;
 
-    uint8_t update_col : 1;
+    uint8_t update_col : 1;     /** The header is changed, all of texts width must be measured again */
+    uint8_t update_width : 1;   /** The column width is changed, all of rows must be measured again */
+    uint8_t update_row : 1;     /** Only the rows from the last measured one need to be measured */
 }_gt_table_st;
 
 
@@ -62,6 +71,7 @@ static void _table_event_cb(struct gt_obj_s * obj, gt_event_st * e);
 
 static GT_ATTRIBUTE_RAM_TEXT gt_res_t
 _calc_each_column_display_max_width(gt_obj_st * table);
+static GT_ATTRIBUTE_RAM_TEXT bool _is_need_refresh(_gt_table_st * style);
 
 /* macros ---------------------------------------------------------------*/
 
@@ -155,9 +165,61 @@ static GT_ATTRIBUTE_RAM_TEXT void _draw_header(gt_obj_st * obj) {
     _draw_line(obj, &line_area, style->color_border, style->border_width);
 }
 
+static inline uint16_t _get_source_row_pitch(_gt_table_st * style) {
+    /** data-source mode, each row is one line */
+    return (style->font_info.size << 1) + style->border_width;
+}
+
+static inline uint16_t _get_row_count(_gt_table_st * style) {
+    return style->cell_cb ? style->source_rows : style->row_count;
+}
+
+static inline uint32_t _get_row_offset(_gt_table_st * style, uint16_t row) {
+    if (style->cell_cb) {
+        return (uint32_t)row * _get_source_row_pitch(style);
+    }
+    return style->row_offset ? style->row_offset[row] : 0;
+}
+
+/**
+ * @brief Get the first row which bottom (include border) is below y.
+ *
+ * @param y The offset relative to the top of the contents
+ */
+static GT_ATTRIBUTE_RAM_TEXT uint16_t _find_first_row(_gt_table_st * style, int32_t y) {
+    uint16_t rows = _get_row_count(style);
+    uint16_t low = 0, high = rows, mid = 0;
+
+    if (y <= 0) {
+        return 0;
+    }
+    if (style->cell_cb) {
+        mid = y / _get_source_row_pitch(style);
+        return mid < rows ? mid : rows;
+    }
+    while (low < high) {
+        mid = (low + high) >> 1;
+        if (style->row_offset[mid + 1] <= y) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT char * _get_cell_text(gt_obj_st * obj, uint16_t row, uint16_t col, uint16_t col_count) {
+    _gt_table_st * style = (_gt_table_st * )obj;
+    if (style->cell_cb) {
+        return (char * )style->cell_cb(obj, row, col, style->cell_user_data);
+    }
+    return (char * )_gt_vector_get_item(style->contents, (gt_size_t)row * col_count + col);
+}
+
 static GT_ATTRIBUTE_RAM_TEXT void _draw_contents(gt_obj_st * obj) {
     _gt_table_st * style = (_gt_table_st * )obj;
     uint16_t count = _gt_vector_get_count(style->header);
+    uint16_t rows = _get_row_count(style);
     uint16_t reduce = gt_obj_get_reduce(obj);
     gt_font_st font = {
         .res = NULL,
@@ -168,15 +230,17 @@ static GT_ATTRIBUTE_RAM_TEXT void _draw_contents(gt_obj_st * obj) {
         .font_color = gt_color_black(),
         .opa = obj->opa,
     };
+    gt_size_t top = obj->area.y + style->height_header + style->border_width;
+    gt_size_t left = obj->area.x + reduce + _get_label_offset(style);
     gt_area_st line_area = {
-        .x = obj->area.x + reduce + _get_label_offset(style),
-        .y = obj->area.y + style->height_header + style->border_width,
+        .x = left,
+        .y = top,
         .w = style->border_width,
         .h = 0,
     };
     gt_area_st text_area = {
-        .x = line_area.x,
-        .y = line_area.y,
+        .x = left,
+        .y = top,
         .w = 0,
         .h = 0,
     };
@@ -185,38 +249,48 @@ static GT_ATTRIBUTE_RAM_TEXT void _draw_contents(gt_obj_st * obj) {
         .w = obj->area.w - (reduce << 1),
         .h = style->border_width,
     };
-    _gt_vector_iterator_st iter = _gt_vector_get_iterator(style->contents);
-    _gt_table_row_item_st * row_item = NULL;
+    /** Only the rows which intersect the display band are drawn */
+    int32_t band_y1 = obj->draw_ctx->buf_area.y - top;
+    int32_t band_y2 = band_y1 + obj->draw_ctx->buf_area.h;
+    uint16_t row = 0;
+    gt_size_t next_y = 0;
     gt_size_t i = 0;
 
-    while (iter.has_next(iter.dsc_t)) {
-        row_item = (_gt_table_row_item_st * )_gt_vector_get_item(style->row_el, iter.index(iter.dsc_t) / count);
+    if (0 == count || 0 == rows) {
+        return;
+    }
+    for (row = _find_first_row(style, band_y1); row < rows; ++row) {
+        if ((int32_t)_get_row_offset(style, row) >= band_y2) {
+            break;
+        }
+        next_y = top + _get_row_offset(style, row + 1);
+        text_area.x = left;
+        text_area.y = top + _get_row_offset(style, row);
+        text_area.h = next_y - text_area.y - style->border_width;
+        line_area.x = left;
+        line_area.y = text_area.y;
+        line_area.h = text_area.h + style->border_width;
+
         for (i = 0; i < count; ++i) {
             /** col item */
-            if (false == iter.has_next(iter.dsc_t)) {
-                break;
-            }
+            font.utf8 = _get_cell_text(obj, row, i, count);
             text_area.w = style->col_list[i].max_width;
-            text_area.h = row_item->max_height;
-            font_attr.align = style->col_list[i].align;
-            font_attr.logical_area = text_area;
-            font.utf8 = iter.next(iter.dsc_t);
-            font.len = strlen(font.utf8);
+            /** The cell without text is kept empty, the columns after it are still drawn */
+            if (font.utf8) {
+                font_attr.align = style->col_list[i].align;
+                font_attr.logical_area = text_area;
+                font.len = strlen(font.utf8);
 
-            draw_text(obj->draw_ctx, &font_attr, &text_area);
+                draw_text(obj->draw_ctx, &font_attr, &text_area);
+            }
             text_area.x += text_area.w;
             if (i + 1 < count) {
                 line_area.x += text_area.w;
-                line_area.h = text_area.h + style->border_width;
                 _draw_line(obj, &line_area, style->color_border, style->border_width);
             }
         }
-        text_area.x = obj->area.x + reduce + _get_label_offset(style);
-        text_area.y += row_item->max_height + style->border_width;
-        line_area.x = text_area.x;
-        line_area.y = text_area.y;
-        if (iter.has_next(iter.dsc_t)) {
-            hor_line_area.y = text_area.y;
+        if (row + 1 < rows) {
+            hor_line_area.y = next_y;
             _draw_line(obj, &hor_line_area, style->color_border, style->border_width);
         }
     }
@@ -228,10 +302,13 @@ static void _table_init_cb(gt_obj_st * obj) {
 
     gt_font_info_update_font_thick(&style->font_info);
 
-    if (style->update_col) {
+    if (_is_need_refresh(style)) {
+        gt_area_st prev = obj->area;
         gt_table_refresh(obj);
-        _gt_disp_reload_max_area(gt_disp_get_scr());
-        return;
+        if (prev.w != obj->area.w || prev.h != obj->area.h) {
+            _gt_disp_reload_max_area(gt_disp_get_scr());
+            return;
+        }
     }
 
     if (obj->show_bg) {
@@ -248,7 +325,15 @@ static void _table_init_cb(gt_obj_st * obj) {
         draw_bg(obj->draw_ctx, &rect_attr, &area);
     }
 
-    _draw_header(obj);
+    gt_area_st header_area = {
+        .x = obj->area.x,
+        .y = obj->area.y,
+        .w = obj->area.w,
+        .h = style->height_header + (style->border_width << 1) + gt_obj_get_reduce(obj),
+    };
+    if (gt_area_is_intersect_screen(&obj->draw_ctx->buf_area, &header_area)) {
+        _draw_header(obj);
+    }
     _draw_contents(obj);
 
     draw_focus(obj, obj->radius);
@@ -256,9 +341,9 @@ static void _table_init_cb(gt_obj_st * obj) {
 
 static void _table_deinit_cb(gt_obj_st * obj) {
     _gt_table_st * style = (_gt_table_st * )obj;
-    if (style->row_el) {
-        _gt_vector_free(style->row_el);
-        style->row_el = NULL;
+    if (style->row_offset) {
+        gt_mem_free(style->row_offset);
+        style->row_offset = NULL;
     }
     if (style->contents) {
         _gt_vector_free(style->contents);
@@ -294,14 +379,12 @@ static GT_ATTRIBUTE_RAM_TEXT bool _str_equal_cb(void * item, void * target) {
     return strcmp(item, target) ? false : true;
 }
 
-static GT_ATTRIBUTE_RAM_TEXT bool _row_free_item_cb(void * item) {
-    return _str_free_item_cb(item);
+static GT_ATTRIBUTE_RAM_TEXT bool _is_need_refresh(_gt_table_st * style) {
+    return (style->update_col || style->update_width || style->update_row) ? true : false;
 }
 
-static GT_ATTRIBUTE_RAM_TEXT bool _row_equal_cb(void * item, void * target) {
-    _gt_table_row_item_st * row = (_gt_table_row_item_st * )item;
-    _gt_table_row_item_st * tar = (_gt_table_row_item_st * )target;
-    return row->idx == tar->idx ? true : false;
+static inline uint16_t _get_text_width(_gt_table_st * style, char const * text) {
+    return gt_font_get_longest_line_substring_width(&style->font_info, (char * )text, 0);
 }
 
 static GT_ATTRIBUTE_RAM_TEXT uint16_t
@@ -331,36 +414,57 @@ _resize_max_width_by(_gt_table_st * style, uint16_t count, gt_size_t diff_width)
     return GT_RES_OK;
 }
 
-static GT_ATTRIBUTE_RAM_TEXT gt_res_t
-_calc_each_column_display_max_width(gt_obj_st * table) {
-    _gt_table_st * style = (_gt_table_st * )table;
+/**
+ * @brief Measure the longest text width of each column again, the column
+ *      which width is fixed by user is skipped.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _measure_text_width(_gt_table_st * style) {
     _gt_vector_iterator_st iter = _gt_vector_get_iterator(style->header);
     _gt_table_col_st * col = NULL;
     uint16_t count = _gt_vector_get_count(style->header);
     uint16_t str_width = 0;
     char * content = NULL;
     if (0 == count) {
-        return GT_RES_OK;
+        return;
     }
 
     /** header */
     while (iter.has_next(iter.dsc_t)) {
         col = &style->col_list[iter.index(iter.dsc_t) % count];
-        col->max_width = style->font_info.size;
         content = (char * )iter.next(iter.dsc_t);
-
-        col->max_width += gt_font_get_longest_line_substring_width(&style->font_info, content, 0);
+        if (col->fixed) {
+            continue;
+        }
+        col->text_width = style->font_info.size + _get_text_width(style, content);
+    }
+    if (style->cell_cb) {
+        /** data-source mode, the cells are supplied on demand, not measured */
+        return;
     }
 
     iter = _gt_vector_get_iterator(style->contents);
     while (iter.has_next(iter.dsc_t)) {
         col = &style->col_list[iter.index(iter.dsc_t) % count];
         content = (char * )iter.next(iter.dsc_t);
-
-        str_width = gt_font_get_longest_line_substring_width(&style->font_info, content, 0);
-        if (str_width > col->max_width) {
-            col->max_width = str_width;
+        if (col->fixed) {
+            continue;
         }
+        str_width = _get_text_width(style, content);
+        if (str_width > col->text_width) {
+            col->text_width = str_width;
+        }
+    }
+}
+
+static GT_ATTRIBUTE_RAM_TEXT gt_res_t
+_calc_each_column_display_max_width(gt_obj_st * table) {
+    _gt_table_st * style = (_gt_table_st * )table;
+    uint16_t count = _gt_vector_get_count(style->header);
+    if (0 == count) {
+        return GT_RES_OK;
+    }
+    for (uint16_t i = 0; i < count; ++i) {
+        style->col_list[i].max_width = style->col_list[i].text_width;
     }
 
     uint16_t total_width = _get_row_max_width(style, count) + style->font_info.size;
@@ -374,66 +478,139 @@ _calc_each_column_display_max_width(gt_obj_st * table) {
     return GT_RES_OK;
 }
 
-static GT_ATTRIBUTE_RAM_TEXT uint16_t
-_calc_vec_total_height_by(_gt_table_st * style, uint16_t col_count, _gt_vector_iterator_st iter, _gt_vector_st * row_vector) {
+/**
+ * @brief Get the height of the row by the max lines of its cells
+ *
+ * @param row The row index, -1: header
+ * @return uint16_t 0: the row has no cell
+ */
+static GT_ATTRIBUTE_RAM_TEXT uint16_t _calc_row_height(gt_obj_st * table, gt_size_t row, uint16_t col_count) {
+    _gt_table_st * style = (_gt_table_st * )table;
     uint32_t ret_w = 0;
-    uint16_t total_height = 0, line_height = 0, row_idx = 0;
-    gt_size_t i = 0, line_count;
+    uint16_t line_height = 0;
+    gt_size_t line_count = 0;
     gt_font_split_line_st sp_line = {
         .text = NULL,
         .space = 0,
         .indent = 0,
     };
-    gt_size_t row_count = row_vector ? _gt_vector_get_count(row_vector) : 0;
-    _gt_table_row_item_st * row_item = NULL;
 
-    while (iter.has_next(iter.dsc_t)) {
-        for (i = 0, line_height = 0; i < col_count; ++i) {
-            if (false == iter.has_next(iter.dsc_t)) {
-                break;
-            }
-            sp_line.max_w = style->col_list[iter.index(iter.dsc_t) % col_count].max_width;
-            sp_line.start_w = sp_line.max_w;
-            sp_line.text = (char * )iter.next(iter.dsc_t);
-            line_count = gt_font_split_line_numb(&style->font_info, &sp_line, &ret_w);
-            if (style->font_info.size * line_count > line_height) {
-                line_height = style->font_info.size * line_count;
-            }
+    for (uint16_t i = 0; i < col_count; ++i) {
+        if (row < 0) {
+            sp_line.text = (char * )_gt_vector_get_item(style->header, i);
+        } else {
+            sp_line.text = _get_cell_text(table, row, i, col_count);
         }
-        line_height += style->font_info.size;
-        total_height += line_height;
-
-        if (row_vector) {
-            row_idx = iter.index(iter.dsc_t) / col_count;
-            if (row_idx > _gt_vector_get_count(row_vector)) {
-                row_item = gt_mem_malloc(sizeof(_gt_table_row_item_st));
-                if (NULL == row_item) {
-                    GT_LOGD(GT_LOG_TAG_ASSERT, "malloc row item info failed");
-                    continue;
-                }
-                row_item->idx = row_idx;
-                row_item->max_height = line_height;
-                _gt_vector_add_item(row_vector, row_item);
-            } else {
-                row_item = (_gt_table_row_item_st * )_gt_vector_get_item(row_vector, row_idx - 1);
-                row_item->max_height = line_height;
+        if (NULL == sp_line.text) {
+            if (0 == i) {
+                return 0;
             }
+            break;
+        }
+        sp_line.max_w = style->col_list[i].max_width;
+        sp_line.start_w = sp_line.max_w;
+        line_count = gt_font_split_line_numb(&style->font_info, &sp_line, &ret_w);
+        if (style->font_info.size * line_count > line_height) {
+            line_height = style->font_info.size * line_count;
         }
     }
-    return total_height;
+    return line_height + style->font_info.size;
+}
+
+static GT_ATTRIBUTE_RAM_TEXT bool _reserve_row_offset(_gt_table_st * style, uint16_t rows) {
+    uint16_t cap = style->row_cap ? style->row_cap : 8;
+    uint16_t * list = NULL;
+
+    if (rows + 1 <= style->row_cap) {
+        return true;
+    }
+    while (cap < rows + 1) {
+        cap += (cap >> 1);
+    }
+    list = (uint16_t * )gt_mem_realloc(style->row_offset, cap * sizeof(uint16_t));
+    if (NULL == list) {
+        return false;
+    }
+    style->row_offset = list;
+    style->row_cap = cap;
+    return true;
+}
+
+/**
+ * @brief The height of the table except the contents
+ */
+static inline uint16_t _get_reserve_height(gt_obj_st * table) {
+    _gt_table_st * style = (_gt_table_st * )table;
+    return style->height_header + style->border_width + (table->reduce << 1);
+}
+
+/**
+ * @brief Measure the rows from the last measured one, the last row may be
+ *      not full filled before, so it is measured again.
+ */
+static GT_ATTRIBUTE_RAM_TEXT void _calc_rows_offset(gt_obj_st * table, uint16_t col_count) {
+    _gt_table_st * style = (_gt_table_st * )table;
+    uint16_t rows = 0, row = 0, height = 0;
+    uint32_t offset = 0;
+
+    if (0 == col_count) {
+        style->row_count = 0;
+        return;
+    }
+    rows = (_gt_vector_get_count(style->contents) + col_count - 1) / col_count;
+    if (false == _reserve_row_offset(style, rows)) {
+        GT_LOGW(GT_LOG_TAG_MEM, "table row offset malloc failed, rows: %d", rows);
+        if (NULL == style->row_offset) {
+            style->row_count = 0;
+            return;
+        }
+        rows = style->row_cap - 1;
+    }
+    row = style->row_count ? style->row_count - 1 : 0;
+    if (row > rows) {
+        row = rows;
+    }
+    style->row_offset[0] = 0;
+    offset = style->row_offset[row];
+    for (; row < rows; ++row) {
+        height = _calc_row_height(table, row, col_count);
+        offset += height + style->border_width;
+        if (offset + _get_reserve_height(table) > 0x7FFF) {
+            GT_LOGW(GT_LOG_TAG_ASSERT, "table is too high, rows: %d / %d", row, rows);
+            break;
+        }
+        style->row_offset[row + 1] = (uint16_t)offset;
+    }
+    style->row_count = row;
 }
 
 static GT_ATTRIBUTE_RAM_TEXT uint16_t
 _calc_total_height(gt_obj_st * table) {
     _gt_table_st * style = (_gt_table_st * )table;
     uint16_t col_count = _gt_vector_get_count(style->header);
+    uint16_t rows = 0;
+    uint32_t offset = 0;
+
+    if (style->update_width) {
+        style->height_header = _calc_row_height(table, -1, col_count);
+        style->row_count = 0;
+    }
+    if (style->cell_cb) {
+        rows = style->source_rows;
+        offset = (uint32_t)rows * _get_source_row_pitch(style) + _get_reserve_height(table);
+        if (offset > 0x7FFF) {
+            rows = (0x7FFF - _get_reserve_height(table)) / _get_source_row_pitch(style);
+            GT_LOGW(GT_LOG_TAG_ASSERT, "table is too high, rows: %d / %d", rows, style->source_rows);
+            style->source_rows = rows;
+        }
+    } else {
+        _calc_rows_offset(table, col_count);
+        rows = style->row_count;
+    }
+    offset = _get_row_offset(style, rows);
+    style->height_contents = rows ? offset - (uint32_t)rows * style->border_width : 0;
 
-    style->height_header += _calc_vec_total_height_by(style, col_count,
-        _gt_vector_get_iterator(style->header), NULL);
-    style->height_contents += _calc_vec_total_height_by(style, col_count,
-        _gt_vector_get_iterator(style->contents), style->row_el);
-
-    gt_size_t row_count = _gt_vector_get_count(style->row_el) - 1;
+    gt_size_t row_count = rows - 1;
     if (row_count > 0) {
         row_count *= style->border_width;
     } else {
@@ -461,7 +638,6 @@ gt_obj_st * gt_table_create(gt_obj_st * parent)
 
     style->header = _gt_vector_create(_str_free_item_cb, _str_equal_cb);
     style->contents = _gt_vector_create(_str_free_item_cb, _str_equal_cb);
-    style->row_el = _gt_vector_create(_row_free_item_cb, _row_equal_cb);
     return obj;
 }
 
@@ -495,6 +671,8 @@ gt_res_t gt_table_add_header_text_by_len(gt_obj_st * table, char * text, uint16_
     }
     style->col_list[count - 1].align = align;
     style->col_list[count - 1].max_width = 0;
+    style->col_list[count - 1].text_width = 0;
+    style->col_list[count - 1].fixed = false;
     style->update_col = true;
     return GT_RES_OK;
 
@@ -528,7 +706,23 @@ gt_res_t gt_table_add_content_text_by_len(gt_obj_st * table, char * text, uint16
     if (false == _gt_vector_add_item(style->contents, (void * )content)) {
         goto free_text_lb;
     }
-    style->update_col = true;
+    /** Only the new content is measured, the rows are re-measured when the column becomes wider */
+    uint16_t col_count = _gt_vector_get_count(style->header);
+    _gt_table_col_st * col = NULL;
+    uint16_t str_width = 0;
+    if (0 == col_count || style->update_col) {
+        style->update_col = true;
+        return GT_RES_OK;
+    }
+    col = &style->col_list[(_gt_vector_get_count(style->contents) - 1) % col_count];
+    if (false == col->fixed) {
+        str_width = _get_text_width(style, content);
+        if (str_width > col->text_width) {
+            col->text_width = str_width;
+            style->update_width = true;
+        }
+    }
+    style->update_row = true;
     return GT_RES_OK;
 
 free_text_lb:
@@ -543,17 +737,70 @@ gt_res_t gt_table_refresh(gt_obj_st * table)
         return GT_RES_FAIL;
     }
     _gt_table_st * style = (_gt_table_st * )table;
-    if (false == style->update_col) {
+    if (false == _is_need_refresh(style)) {
         return GT_RES_OK;
     }
-    style->update_col = false;
-    gt_disp_invalid_area(table);
-    _calc_each_column_display_max_width(table);
+    if (style->update_col) {
+        _measure_text_width(style);
+        style->update_width = true;
+    }
+    if (style->update_width) {
+        gt_disp_invalid_area(table);
+        _calc_each_column_display_max_width(table);
+    }
     gt_obj_set_h(table, _calc_total_height(table));
+    style->update_col = false;
+    style->update_width = false;
+    style->update_row = false;
     gt_event_send(table, GT_EVENT_TYPE_DRAW_START, NULL);
     return GT_RES_OK;
 }
 
+gt_res_t gt_table_set_data_source(gt_obj_st * table, uint16_t row_count, gt_table_cell_cb_t cell_cb, void * user_data)
+{
+    if (false == gt_obj_is_type(table, OBJ_TYPE)) {
+        return GT_RES_FAIL;
+    }
+    _gt_table_st * style = (_gt_table_st * )table;
+    style->cell_cb = cell_cb;
+    style->cell_user_data = user_data;
+    style->source_rows = cell_cb ? row_count : 0;
+    style->row_count = 0;
+    style->update_col = true;
+    return GT_RES_OK;
+}
+
+gt_res_t gt_table_set_column_width(gt_obj_st * table, uint16_t col, uint16_t width)
+{
+    if (false == gt_obj_is_type(table, OBJ_TYPE)) {
+        return GT_RES_FAIL;
+    }
+    _gt_table_st * style = (_gt_table_st * )table;
+    if (col >= _gt_vector_get_count(style->header)) {
+        return GT_RES_INV;
+    }
+    style->col_list[col].fixed = width ? true : false;
+    style->col_list[col].text_width = width;
+    style->update_col = true;
+    return GT_RES_OK;
+}
+
+uint16_t gt_table_get_row_count(gt_obj_st * table)
+{
+    if (false == gt_obj_is_type(table, OBJ_TYPE)) {
+        return 0;
+    }
+    _gt_table_st * style = (_gt_table_st * )table;
+    uint16_t col_count = _gt_vector_get_count(style->header);
+    if (style->cell_cb) {
+        return style->source_rows;
+    }
+    if (0 == col_count) {
+        return 0;
+    }
+    return (_gt_vector_get_count(style->contents) + col_count - 1) / col_count;
+}
+
 
 
 #endif  /** GT_CFG_ENABLE_TABLE */
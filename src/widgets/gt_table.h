@@ -27,6 +27,16 @@ extern "C" {
 
 
 /* typedef --------------------------------------------------------------*/
+/**
+ * @brief Supply the cell text on demand, data-source mode
+ *
+ * @param table
+ * @param row The row index, begin from 0
+ * @param col The column index, begin from 0
+ * @param user_data
+ * @return const char* The text must be valid until the draw is finished, NULL: empty cell
+ */
+typedef const char * ( * gt_table_cell_cb_t)(gt_obj_st * table, uint16_t row, uint16_t col, void * user_data);
 
 
 
@@ -71,8 +81,49 @@ gt_res_t gt_table_add_header_text_by_len(gt_obj_st * table, char * text, uint16_
  */
 gt_res_t gt_table_add_content_text_by_len(gt_obj_st * table, char * text, uint16_t len);
 
+/**
+ * @brief Measure the new contents and update the table size, the rows
+ *      which has been measured are not measured again unless the column
+ *      width is changed.
+ *
+ * @param table
+ * @return gt_res_t
+ */
 gt_res_t gt_table_refresh(gt_obj_st * table);
 
+/**
+ * @brief Data-source mode, the cell text is got by the callback when the
+ *      row is drawn, the contents added by gt_table_add_content_text_by_len()
+ *      are not shown. Each row is one line height, the column width is
+ *      measured by header text, or set by gt_table_set_column_width().
+ *
+ * @param table
+ * @param row_count The count of rows
+ * @param cell_cb NULL: exit the data-source mode
+ * @param user_data
+ * @return gt_res_t
+ */
+gt_res_t gt_table_set_data_source(gt_obj_st * table, uint16_t row_count, gt_table_cell_cb_t cell_cb, void * user_data);
+
+/**
+ * @brief Set the text width of the column, the texts of the column are
+ *      not measured any more.
+ *
+ * @param table
+ * @param col The column index, begin from 0
+ * @param width 0: measured by texts
+ * @return gt_res_t
+ */
+gt_res_t gt_table_set_column_width(gt_obj_st * table, uint16_t col, uint16_t width);
+
+/**
+ * @brief Get the count of rows
+ *
+ * @param table
+ * @return uint16_t
+ */
+uint16_t gt_table_get_row_count(gt_obj_st * table);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
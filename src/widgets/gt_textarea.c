@@ -35,22 +35,30 @@ typedef struct _textarea_reg_s {
     uint8_t reserved : 3;
 }_textarea_reg_st;
 
-#if GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
+#if GT_TEXTAREA_USE_LAYOUT_CACHE
+/**
+ * @brief The layout of the run, relative to the text area, the run begins
+ *      at the end position of the previous run.
+ */
 typedef struct {
-    gt_size_t idx;
-    gt_area_st offset_abs;
-}_scroll_cache_item_st;
+    gt_size_t end_x;    /** The pen position after the run */
+    gt_size_t end_y;
+    gt_size_t bottom;   /** The bottom of the last line of the run */
+}_textarea_run_box_st;
 
 typedef struct {
-    _scroll_cache_item_st * list;
-    uint16_t item_count;
-}_sub_string_scroll_cache_st;
+    _textarea_run_box_st * list;
+    uint16_t count;     /** The count of the runs which have been laid out */
+    uint16_t cap;
+    uint16_t width;     /** The width of the text area which the runs are laid out by */
+}_textarea_layout_st;
 #endif
 
 typedef struct _gt_textarea_s {
     gt_obj_st obj;
     gt_textarea_param_st * contents;
     uint16_t cnt_contents;
+    uint16_t cap_contents;  /** The capacity of the contents, grows geometrically */
     uint16_t max_height;
 
     gt_color_t color_background;
@@ -71,8 +79,8 @@ typedef struct _gt_textarea_s {
     gt_font_touch_word_st select_word;
 #endif
 
-#if GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
-    _sub_string_scroll_cache_st scroll_cache;
+#if GT_TEXTAREA_USE_LAYOUT_CACHE
+    _textarea_layout_st layout;
 #endif
 
     _textarea_reg_st reg;
@@ -105,82 +113,170 @@ static inline void _set_touch_word(_gt_textarea_st * style, char * word, uint16_
 }
 #endif
 
-#if GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
-static void _free_reset_scroll_cache(_gt_textarea_st * style) {
-    if (style->scroll_cache.list) {
-        gt_mem_free(style->scroll_cache.list);
-        style->scroll_cache.list = NULL;
-    }
-    style->scroll_cache.item_count = 0;
+static inline void _set_hold_on_contents_for_scroll(_gt_textarea_st * style, bool hold_on) {
+    style->reg.hold_on = hold_on;
 }
 
-static void _reset_scroll_list_offset(_gt_textarea_st * style, uint16_t count) {
-    if (NULL == style->scroll_cache.list) {
-        return;
-    }
-    gt_memset(style->scroll_cache.list, 0, count);
+static inline bool _is_hold_on_contents_for_scroll(_gt_textarea_st * style) {
+    return style->reg.hold_on;
 }
 
-static gt_res_t _resize_scroll_cache(_gt_textarea_st * style, uint16_t cnt) {
-    if (0 == cnt) {
-        _free_reset_scroll_cache(style);
-        return GT_RES_OK;
-    }
-    uint16_t count = cnt * sizeof(_scroll_cache_item_st);
-    if (style->scroll_cache.item_count == count) {
-        _reset_scroll_list_offset(style, count);
+static inline void _set_run_font(_gt_textarea_st * style, uint16_t idx, gt_font_st * font, gt_attr_font_st * font_attr) {
+    font->utf8 = style->contents[idx].text;
+    font->len = style->contents[idx].len;
+    font->info.style.all = style->contents[idx].mask_style;
+#if GT_TEXTAREA_CUSTOM_FONT_STYLE
+    font_attr->font_color = style->contents[idx].font_info.palette;
+    font->info = style->contents[idx].font_info;
+#else
+    font_attr->font_color = style->contents[idx].color;
+#endif
+}
+
+static inline uint16_t _get_base_height(gt_obj_st * obj) {
+    _gt_textarea_st * style = (_gt_textarea_st * )obj;
+    return obj->reduce + style->font_info.size + (style->space_y << 1);
+}
+
+/**
+ * @brief Make sure the contents array can store the count of runs
+ */
+static gt_res_t _reserve_contents(_gt_textarea_st * style, uint16_t count) {
+    uint16_t cap = style->cap_contents ? style->cap_contents : 4;
+    gt_textarea_param_st * list = NULL;
+
+    if (count <= style->cap_contents) {
         return GT_RES_OK;
     }
-    if (NULL == style->scroll_cache.list) {
-        style->scroll_cache.list = gt_mem_malloc(count);
-    } else {
-        style->scroll_cache.list = gt_mem_realloc(style->scroll_cache.list, count);
+    while (cap < count) {
+        cap += (cap >> 1);
     }
-    if (NULL == style->scroll_cache.list) {
-        style->scroll_cache.item_count = 0;
+    list = (gt_textarea_param_st * )gt_mem_realloc(style->contents, cap * sizeof(gt_textarea_param_st));
+    if (NULL == list) {
         return GT_RES_FAIL;
     }
-    style->scroll_cache.item_count = cnt;
-    _reset_scroll_list_offset(style, count);
+    style->contents = list;
+    style->cap_contents = cap;
     return GT_RES_OK;
 }
 
-static _scroll_cache_item_st * _scroll_cache_get_remark_item_by(_gt_textarea_st * style, gt_size_t offset) {
-    if (NULL == style->scroll_cache.list) {
-        return NULL;
-    }
-    uint8_t is_cur_half_display = 0;
-    offset = gt_abs(offset);
+/**
+ * @brief The font or spacing is changed, all of the runs must be laid out again
+ */
+static inline void _invalid_layout(_gt_textarea_st * style) {
+#if GT_TEXTAREA_USE_LAYOUT_CACHE
+    style->layout.count = 0;
+#endif
+}
 
-    /** [Warn] except the begin one */
-    for (gt_size_t i = 0, cnt = style->scroll_cache.item_count; i < cnt; ++i) {
-        if (style->scroll_cache.list[i].offset_abs.y + style->scroll_cache.list[i].offset_abs.h > offset) {
-            return &style->scroll_cache.list[i];
-        }
+#if GT_TEXTAREA_USE_LAYOUT_CACHE
+static void _layout_free(_gt_textarea_st * style) {
+    if (style->layout.list) {
+        gt_mem_free(style->layout.list);
+        style->layout.list = NULL;
     }
-    return NULL;
+    style->layout.count = 0;
+    style->layout.cap = 0;
 }
 
-static void _scroll_cache_remark_item(_gt_textarea_st * style, gt_size_t idx, gt_area_st * item_area) {
-    if (NULL == style->scroll_cache.list) {
-        return;
+static gt_res_t _layout_reserve(_gt_textarea_st * style, uint16_t count) {
+    _textarea_run_box_st * list = NULL;
+    if (count <= style->layout.cap) {
+        return GT_RES_OK;
     }
-    if (idx >= style->scroll_cache.item_count) {
-        return;
+    /** The same capacity as contents */
+    count = style->cap_contents > count ? style->cap_contents : count;
+    list = (_textarea_run_box_st * )gt_mem_realloc(style->layout.list, count * sizeof(_textarea_run_box_st));
+    if (NULL == list) {
+        return GT_RES_FAIL;
     }
-    style->scroll_cache.list[idx].idx = idx;
-    style->scroll_cache.list[idx].offset_abs = *item_area;
+    style->layout.list = list;
+    style->layout.cap = count;
+    return GT_RES_OK;
 }
-#endif  /** GT_TEXTAREA_SUB_STRING_SCROLL_CACHE */
 
-static inline void _set_hold_on_contents_for_scroll(_gt_textarea_st * style, bool hold_on) {
-    style->reg.hold_on = hold_on;
+static inline gt_size_t _layout_get_start_y(_gt_textarea_st * style, uint16_t idx) {
+    return idx ? style->layout.list[idx - 1].end_y : 0;
 }
 
-static inline bool _is_hold_on_contents_for_scroll(_gt_textarea_st * style) {
-    return style->reg.hold_on;
+/**
+ * @brief Lay out the runs which are added after the last time, the position
+ *      is relative to the text area, which is not changed by scrolling.
+ */
+static GT_ATTRIBUTE_RAM_TEXT gt_res_t _layout_update(gt_obj_st * obj, gt_area_st const * area_font) {
+    _gt_textarea_st * style = (_gt_textarea_st * )obj;
+    _textarea_layout_st * layout = &style->layout;
+    _textarea_run_box_st * box = NULL;
+    _gt_draw_font_res_st font_res = {0};
+    gt_font_st font = {
+        .info       = style->font_info,
+        .res        = NULL,
+    };
+    gt_attr_font_st font_attr = {
+        .font       = &font,
+        .space_x    = style->space_x,
+        .space_y    = style->space_y,
+        .align      = style->font_align,
+        .indent     = style->indent,
+        .opa        = GT_OPA_0,
+        .logical_area = {
+            .x = 0, .y = 0, .w = area_font->w, .h = 0xffff,
+        },
+    };
+    gt_area_st view = font_attr.logical_area;
+    uint16_t idx = 0;
+
+    if (layout->width != area_font->w) {
+        layout->width = area_font->w;
+        layout->count = 0;
+    }
+    if (layout->count >= style->cnt_contents) {
+        return GT_RES_OK;
+    }
+    if (GT_RES_OK != _layout_reserve(style, style->cnt_contents)) {
+        return GT_RES_FAIL;
+    }
+    for (idx = layout->count; idx < style->cnt_contents; ++idx) {
+        box = &layout->list[idx];
+        if (idx) {
+            font_attr.reg.enabled_start = true;
+            font_attr.start_x = layout->list[idx - 1].end_x;
+            font_attr.start_y = layout->list[idx - 1].end_y;
+        }
+        if (NULL == style->contents[idx].text) {
+            *box = idx ? layout->list[idx - 1] : (_textarea_run_box_st){0};
+            continue;
+        }
+        _set_run_font(style, idx, &font, &font_attr);
+        font_res = draw_text(obj->draw_ctx, &font_attr, &view);
+        box->end_x = font_res.area.x;
+        box->end_y = font_res.area.y;
+        box->bottom = _layout_get_start_y(style, idx) + font_res.size.y;
+    }
+    layout->count = style->cnt_contents;
+    style->max_height = _get_base_height(obj) + layout->list[layout->count - 1].end_y + font.info.size;
+    return GT_RES_OK;
 }
 
+/**
+ * @brief Get the first run which bottom is below the y
+ *
+ * @param y relative to the text area
+ */
+static GT_ATTRIBUTE_RAM_TEXT uint16_t _layout_find_run(_gt_textarea_st * style, int32_t y) {
+    uint16_t low = 0, high = style->layout.count, mid = 0;
+    while (low < high) {
+        mid = (low + high) >> 1;
+        if (style->layout.list[mid].bottom <= y) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+#endif  /** GT_TEXTAREA_USE_LAYOUT_CACHE */
+
 static GT_ATTRIBUTE_RAM_TEXT void
 _draw_content_or_get_words(gt_obj_st * obj, gt_point_st * touch_point_p, bool is_only_calc_height) {
     _gt_textarea_st * style = (_gt_textarea_st * )obj;
@@ -223,37 +319,56 @@ _draw_content_or_get_words(gt_obj_st * obj, gt_point_st * touch_point_p, bool is
     font_attr.logical_area.y += scroll_y;
     font_attr.logical_area.h = 0xffff;
 
-    uint16_t height = obj->reduce + font_attr.font->info.size + (font_attr.space_y << 1);
-
-#if GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
-    gt_area_st cur_offset = {0};
-    if (_is_hold_on_contents_for_scroll(style)) {
-        _scroll_cache_item_st * remark_item_p = _scroll_cache_get_remark_item_by(style, scroll_y);
-        if (remark_item_p) {
-            font_attr.reg.enabled_start = true;
-            idx = remark_item_p->idx;
-            font_attr.start_x = remark_item_p->offset_abs.x + font_attr.logical_area.x;
-            font_attr.start_y = remark_item_p->offset_abs.y + font_attr.logical_area.y;
+#if GT_TEXTAREA_USE_LAYOUT_CACHE
+    if (GT_RES_OK == _layout_update(obj, &area_font)) {
+        int32_t view_y1 = 0, view_y2 = 0;
+        if (is_only_calc_height) {
+            return;
+        }
+        if (touch_point_p) {
+            view_y1 = touch_point_p->y - font_attr.logical_area.y;
+            view_y2 = view_y1;
+        } else if (obj->draw_ctx) {
+            view_y1 = obj->draw_ctx->buf_area.y - font_attr.logical_area.y;
+            view_y2 = view_y1 + obj->draw_ctx->buf_area.h;
+        } else {
+            return;
+        }
+        /** Only the runs within the view are drawn or touched */
+        font_attr.reg.immediately_return = false;
+        for (idx = _layout_find_run(style, view_y1); idx < style->cnt_contents; ++idx) {
+            if (_layout_get_start_y(style, idx) > view_y2) {
+                break;
+            }
+            if (NULL == style->contents[idx].text) {
+                continue;
+            }
+            font_attr.reg.enabled_start = idx ? true : false;
+            if (idx) {
+                font_attr.start_x = style->layout.list[idx - 1].end_x + font_attr.logical_area.x;
+                font_attr.start_y = style->layout.list[idx - 1].end_y + font_attr.logical_area.y;
+            }
+            _set_run_font(style, idx, &font, &font_attr);
+            font_res = draw_text(obj->draw_ctx, &font_attr, &area_font);
+#if _GT_FONT_GET_WORD_BY_TOUCH_POINT
+            if (touch_point_p && font_res.touch_word.word_p) {
+                _set_touch_word(style, font_res.touch_word.word_p, font_res.touch_word.len);
+                break;
+            }
+#endif
         }
+        return;
     }
 #endif
 
+    uint16_t height = _get_base_height(obj);
+
     while (idx < style->cnt_contents) {
-        font.utf8               = style->contents[idx].text;
-        if (NULL == font.utf8) {
+        if (NULL == style->contents[idx].text) {
             ++idx;
             continue;
         }
-        font.len                = style->contents[idx].len;
-        // font_attr.reg.style     = style->contents[idx].mask_style;
-        font.info.style.all = style->contents[idx].mask_style;
-
-#if GT_TEXTAREA_CUSTOM_FONT_STYLE
-        font_attr.font_color    = style->contents[idx].font_info.palette;
-        font.info               = style->contents[idx].font_info;
-#else
-        font_attr.font_color    = style->contents[idx].color;
-#endif
+        _set_run_font(style, idx, &font, &font_attr);
         font_res = draw_text(obj->draw_ctx, &font_attr, &area_font);
 #if _GT_FONT_GET_WORD_BY_TOUCH_POINT
         if (touch_point_p && font_res.touch_word.word_p) {
@@ -264,20 +379,6 @@ _draw_content_or_get_words(gt_obj_st * obj, gt_point_st * touch_point_p, bool is
         if (_is_hold_on_contents_for_scroll(style) && GT_RES_INV == font_res.res) {
             break;
         }
-#if GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
-        if (false == _is_hold_on_contents_for_scroll(style)) {
-            if (idx) {
-                cur_offset.x = font_attr.start_x - font_attr.logical_area.x;
-                cur_offset.y = font_attr.start_y - font_attr.logical_area.y;
-            } else {
-                cur_offset.x = 0;
-                cur_offset.y = 0;
-            }
-            cur_offset.w = font_res.size.x;
-            cur_offset.h = font_res.size.y;
-            _scroll_cache_remark_item(style, idx, &cur_offset);
-        }
-#endif
         font_attr.start_x       = font_res.area.x;
         font_attr.start_y       = font_res.area.y;
         font_attr.reg.enabled_start = true;
@@ -333,8 +434,8 @@ static void _free_contents(gt_obj_st * obj) {
     _gt_textarea_st * style_p = (_gt_textarea_st * )obj;
     if (style_p->contents) {
         _set_hold_on_contents_for_scroll(style_p, false);
-#if GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
-        _free_reset_scroll_cache(style_p);
+#if GT_TEXTAREA_USE_LAYOUT_CACHE
+        _layout_free(style_p);
 #endif
 
         for (gt_size_t i = style_p->cnt_contents - 1; i >= 0; i--) {
@@ -350,6 +451,7 @@ static void _free_contents(gt_obj_st * obj) {
         style_p->contents = NULL;
         style_p->max_height = 0;
         style_p->cnt_contents = 0;
+        style_p->cap_contents = 0;
         _reset_scroll_value(&obj->process_attr);
     }
 }
@@ -532,8 +634,10 @@ void gt_textarea_set_text_by_len(gt_obj_st * textarea, char * text, uint16_t len
     if (NULL == text) {
         return;
     }
-    style->contents  = gt_mem_malloc( sizeof(gt_textarea_param_st) );
-    GT_CHECK_BACK(style->contents);
+    if (GT_RES_OK != _reserve_contents(style, 1)) {
+        GT_CHECK_PRINT(style->contents);
+        return;
+    }
     style->contents[0].len  = len;
     style->contents[0].text = gt_mem_malloc(style->contents[0].len + 1);
     if (NULL == style->contents[0].text) {
@@ -541,6 +645,7 @@ void gt_textarea_set_text_by_len(gt_obj_st * textarea, char * text, uint16_t len
         gt_mem_free(style->contents);
         style->contents = NULL;
         style->cnt_contents = 0;
+        style->cap_contents = 0;
         style->max_height = 0;
         return;
     }
@@ -560,9 +665,6 @@ void gt_textarea_set_text_by_len(gt_obj_st * textarea, char * text, uint16_t len
     gt_font_info_update_font_thick(&style->contents[0].font_info);
 #endif
 
-#if GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
-    _resize_scroll_cache(style, style->cnt_contents);
-#endif
     _set_hold_on_contents_for_scroll(style, false);
 
     gt_event_send(textarea, GT_EVENT_TYPE_DRAW_START, NULL);
@@ -608,21 +710,13 @@ void gt_textarea_add_str_by_len(gt_obj_st * textarea, char * str, uint32_t len,
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
     uint16_t idx = style->cnt_contents;
 
-    if (idx) {
-        style->contents = gt_mem_realloc(style->contents, (style->cnt_contents + 1) * sizeof(gt_textarea_param_st));
-    } else {
-        style->contents = gt_mem_malloc(sizeof(gt_textarea_param_st));
-    }
-    if (NULL == style->contents) {
+    if (GT_RES_OK != _reserve_contents(style, idx + 1)) {
         GT_CHECK_PRINT(style->contents);
-        style->cnt_contents = 0;
         return;
     }
     style->contents[idx].len  = len;
     style->contents[idx].text = gt_mem_malloc(style->contents[idx].len + 1);
     if (NULL == style->contents[idx].text) {
-        /** Reset to before */
-        style->contents = gt_mem_realloc(style->contents, (style->cnt_contents) * sizeof(gt_textarea_param_st));
         return;
     }
     gt_memcpy(style->contents[idx].text, str, style->contents[idx].len);
@@ -638,9 +732,6 @@ void gt_textarea_add_str_by_len(gt_obj_st * textarea, char * str, uint32_t len,
 #endif
 
     ++style->cnt_contents;
-#if GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
-    _resize_scroll_cache(style, style->cnt_contents);
-#endif
     _set_hold_on_contents_for_scroll(style, false);
 }
 
@@ -668,14 +759,8 @@ void gt_textarea_add_str_by_param(gt_obj_st * textarea, gt_textarea_param_st * p
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
     uint16_t idx = style->cnt_contents;
 
-    if (idx) {
-        style->contents = gt_mem_realloc(style->contents, (style->cnt_contents + 1) * sizeof(gt_textarea_param_st));
-    } else {
-        style->contents = gt_mem_malloc(sizeof(gt_textarea_param_st));
-    }
-    if (NULL == style->contents) {
+    if (GT_RES_OK != _reserve_contents(style, idx + 1)) {
         GT_CHECK_PRINT(style->contents);
-        style->cnt_contents = 0;
         return;
     }
 
@@ -684,8 +769,6 @@ void gt_textarea_add_str_by_param(gt_obj_st * textarea, gt_textarea_param_st * p
     style->contents[idx].len = param->len + new_line_len;
     style->contents[idx].text = gt_mem_malloc(style->contents[idx].len + 1);
     if (NULL == style->contents[idx].text) {
-        /** Reset to before */
-        style->contents = gt_mem_realloc(style->contents, (style->cnt_contents) * sizeof(gt_textarea_param_st));
         return;
     }
     gt_memcpy(style->contents[idx].text, param->text, param->len);
@@ -697,9 +780,6 @@ void gt_textarea_add_str_by_param(gt_obj_st * textarea, gt_textarea_param_st * p
     style->contents[idx].font_info = param->font_info;
     gt_font_info_update_font_thick(&style->contents[idx].font_info);
     ++style->cnt_contents;
-#if GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
-    _resize_scroll_cache(style, style->cnt_contents);
-#endif
     _set_hold_on_contents_for_scroll(style, false);
 }
 #endif
@@ -710,6 +790,7 @@ void gt_textarea_set_space(gt_obj_st * textarea, uint8_t space_x, uint8_t space_
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->space_x = space_x;
     style->space_y = space_y;
 
@@ -722,6 +803,7 @@ void gt_textarea_set_font_size(gt_obj_st * textarea, uint8_t size)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->font_info.size = size;
     gt_font_info_update_font_thick(&style->font_info);
     gt_event_send(textarea, GT_EVENT_TYPE_DRAW_START, NULL);
@@ -741,6 +823,7 @@ void gt_textarea_set_indent(gt_obj_st * textarea, uint16_t indent)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->indent = indent;
     gt_event_send(textarea, GT_EVENT_TYPE_DRAW_START, NULL);
 }
@@ -751,6 +834,7 @@ void gt_textarea_set_font_align(gt_obj_st * textarea, gt_align_et align)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
 
     // NOTE : textarea only support left align
     align = GT_ALIGN_LEFT;
@@ -803,6 +887,7 @@ void gt_textarea_set_border_width(gt_obj_st * textarea, uint8_t width)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->border_width = width;
     gt_event_send(textarea, GT_EVENT_TYPE_DRAW_START, NULL);
 }
@@ -832,6 +917,7 @@ void gt_textarea_set_font_family_cn(gt_obj_st * textarea, gt_family_t family)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->font_info.style_cn = family;
 }
 
@@ -841,6 +927,7 @@ void gt_textarea_set_font_family_en(gt_obj_st * textarea, gt_family_t family)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->font_info.style_en = family;
 }
 void gt_textarea_set_font_family_fl(gt_obj_st * textarea, gt_family_t family)
@@ -849,6 +936,7 @@ void gt_textarea_set_font_family_fl(gt_obj_st * textarea, gt_family_t family)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->font_info.style_fl = family;
 }
 void gt_textarea_set_font_family_numb(gt_obj_st * textarea, gt_family_t family)
@@ -857,6 +945,7 @@ void gt_textarea_set_font_family_numb(gt_obj_st * textarea, gt_family_t family)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->font_info.style_numb = family;
 }
 #else
@@ -866,6 +955,7 @@ void gt_textarea_set_font_family(gt_obj_st * textarea, gt_family_t family)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     gt_font_set_family(&style->font_info, family);
 }
 void gt_textarea_set_font_cjk(gt_obj_st* textarea, gt_font_cjk_et cjk)
@@ -874,6 +964,7 @@ void gt_textarea_set_font_cjk(gt_obj_st* textarea, gt_font_cjk_et cjk)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->font_info.cjk = cjk;
 }
 
@@ -884,6 +975,7 @@ void gt_textarea_set_font_thick_en(gt_obj_st * textarea, uint8_t thick)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->font_info.thick_en = thick;
     gt_font_info_update_font_thick(&style->font_info);
 }
@@ -894,6 +986,7 @@ void gt_textarea_set_font_thick_cn(gt_obj_st * textarea, uint8_t thick)
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->font_info.thick_cn = thick;
     gt_font_info_update_font_thick(&style->font_info);
 }
@@ -904,6 +997,7 @@ void gt_textarea_set_font_encoding(gt_obj_st * textarea, gt_encoding_et encoding
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     style->font_info.encoding = encoding;
 }
 
@@ -916,6 +1010,7 @@ void gt_textarea_set_font_info(gt_obj_st * textarea, gt_font_info_st * font_info
         return ;
     }
     _gt_textarea_st * style = (_gt_textarea_st * )textarea;
+    _invalid_layout(style);
     gt_memcpy(&style->font_info, font_info, sizeof(gt_font_info_st));
 }
 
@@ -32,12 +32,26 @@ extern "C" {
     #define GT_TEXTAREA_CUSTOM_FONT_STYLE   0
 #endif
 
+#if !defined(GT_TEXTAREA_USE_LAYOUT_CACHE) && defined(GT_TEXTAREA_SUB_STRING_SCROLL_CACHE)
+    /** The old name of the cache configuration, kept for compatibility */
+    #define GT_TEXTAREA_USE_LAYOUT_CACHE    GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
+#endif
+
+#ifndef GT_TEXTAREA_USE_LAYOUT_CACHE
+    /**
+     * @brief Keep the layout (end position and bottom) of each text run, the runs are
+     *      laid out once when they are added, drawing and touching only visit the runs
+     *      within the view, takes up 6 bytes per run.
+     *      1[defalut]: enabled; 0: lay out all of the runs every time
+     */
+    #define GT_TEXTAREA_USE_LAYOUT_CACHE    1
+#endif
+
 #ifndef GT_TEXTAREA_SUB_STRING_SCROLL_CACHE
     /**
-     * @brief Use sub string scroll cache, improve scrolling performance and takes up some memory
-     *      0[defalut]: disable
+     * @brief [Deprecated] Alias of GT_TEXTAREA_USE_LAYOUT_CACHE
      */
-    #define GT_TEXTAREA_SUB_STRING_SCROLL_CACHE    0
+    #define GT_TEXTAREA_SUB_STRING_SCROLL_CACHE     GT_TEXTAREA_USE_LAYOUT_CACHE
 #endif
 
 
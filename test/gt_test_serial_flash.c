@@ -0,0 +1,154 @@
+/**
+ * @file gt_test_serial_flash.c
+ * @author Feyoung
+ * @brief Test the serial flash stream against the RAM NOR flash model
+ * @version 0.1
+ * @date 2026-10-19 10:12:36
+ * @copyright Copyright (c) 2014-present, Company Genitop. Co., Ltd.
+ */
+
+/* include --------------------------------------------------------------*/
+#include "./gt_test_serial_flash.h"
+#if _GT_USE_TEST
+#if _GT_TEST_SERIAL_FLASH
+#include "string.h"
+#include "../src/hal/gt_hal_fs.h"
+#include "../src/others/gt_log.h"
+#include "../src/others/gt_crc.h"
+#include "../src/extra/serial/gt_serial_system.h"
+
+
+/* private define -------------------------------------------------------*/
+/** The size of the flash model */
+#define _TEST_FLASH_SIZE        (GT_HAL_FLASH_SECTOR_SIZE * 2)
+/** The stream starts at an unaligned address, which is crossed pages */
+#define _TEST_STREAM_ADDR       (GT_HAL_FLASH_PAGE_SIZE - 0x10)
+/** The stream length */
+#define _TEST_STREAM_LEN        (GT_HAL_FLASH_PAGE_SIZE * 4 + 0x31)
+/** The length of each serial frame */
+#define _TEST_FRAME_LEN         100
+
+#define _TEST_CHECK(_cond)  \
+    if (!(_cond)) { \
+        GT_LOG_A(GT_LOG_TAG_TEST, "flash stream test failed at line: %d", __LINE__);   \
+        ret = GT_RES_FAIL;  \
+        goto _exit;   \
+    }
+
+
+/* private typedef ------------------------------------------------------*/
+
+
+
+/* static variables -----------------------------------------------------*/
+static uint8_t _flash_mem[_TEST_FLASH_SIZE];
+static uint8_t _stream_data[_TEST_STREAM_LEN];
+/** The page program is failed while it is set */
+static bool _program_fail = false;
+
+
+/* macros ---------------------------------------------------------------*/
+
+
+
+/* class ----------------------------------------------------------------*/
+
+
+
+/* static functions -----------------------------------------------------*/
+/**
+ * @brief The page program is dropped and the flash keeps busy, until the busy timeout
+ */
+static uint32_t _flash_rw_cb(uint8_t * data_write, uint32_t len_write, uint8_t * data_read, uint32_t len_read) {
+    if (_program_fail && data_write && len_write) {
+        if (GT_HAL_FLASH_PAGE_PROGRAM_CMD == data_write[0]) {
+            return 0;
+        }
+        if (GT_HAL_FLASH_READ_STATUS_CMD == data_write[0] && data_read && len_read) {
+            data_read[0] = 0x01;
+            return 1;
+        }
+    }
+    return gt_vf_flash_model_rw(data_write, len_write, data_read, len_read);
+}
+
+static uint32_t _stream_crc(uint32_t len) {
+    return gt_crc32_update_buf(GT_CRC_START_32, _stream_data, len) ^ 0xFFFFFFFFul;
+}
+
+/**
+ * @brief Send the stream data [from, to) frame by frame, as the host does
+ */
+static gt_res_t _send_frames(uint32_t from, uint32_t to) {
+    uint32_t len = 0;
+    while (from < to) {
+        len = to - from > _TEST_FRAME_LEN ? _TEST_FRAME_LEN : to - from;
+        if (GT_RES_OK != gt_serial_flash_write(_TEST_STREAM_ADDR + from, &_stream_data[from], len)) {
+            return GT_RES_FAIL;
+        }
+        from += len;
+    }
+    return GT_RES_OK;
+}
+
+
+/* global functions / API interface -------------------------------------*/
+gt_res_t _gt_test_serial_flash(void)
+{
+    gt_fs_drv_st * drv = gt_vf_get_drv();
+    rw_cb_t rw_cb_bak = drv->rw_cb;
+    gt_serial_flash_stream_st info = {0};
+    gt_res_t ret = GT_RES_OK;
+    uint32_t i = 0, half = _TEST_STREAM_LEN / 2;
+
+    for (i = 0; i < _TEST_STREAM_LEN; ++i) {
+        _stream_data[i] = (uint8_t)(i * 7 + (i >> 8));
+    }
+    gt_vf_flash_model_init(_flash_mem, sizeof(_flash_mem));
+    gt_vf_drv_register(_flash_rw_cb);
+    _program_fail = false;
+
+    /** write and flush */
+    _TEST_CHECK(GT_RES_OK == gt_serial_flash_erase(0, _TEST_FLASH_SIZE));
+    _TEST_CHECK(GT_RES_OK == _send_frames(0, half));
+    /** The link is broken, the host resends the frames which have been accepted */
+    _TEST_CHECK(GT_RES_OK == _send_frames(half - _TEST_FRAME_LEN - 3, _TEST_STREAM_LEN));
+    _TEST_CHECK(GT_RES_OK == gt_serial_flash_flush());
+    gt_serial_flash_get_stream(&info);
+    _TEST_CHECK(_TEST_STREAM_ADDR == info.start);
+    _TEST_CHECK(_TEST_STREAM_ADDR + _TEST_STREAM_LEN == info.offset);
+    _TEST_CHECK(_TEST_STREAM_LEN == info.programmed);
+    _TEST_CHECK(_stream_crc(_TEST_STREAM_LEN) == info.crc);
+    _TEST_CHECK(0 == memcmp(&_flash_mem[_TEST_STREAM_ADDR], _stream_data, _TEST_STREAM_LEN));
+
+    /** verify */
+    _TEST_CHECK(GT_RES_OK == gt_serial_flash_verify(_TEST_STREAM_ADDR, _TEST_STREAM_LEN, info.crc));
+    _TEST_CHECK(GT_RES_OK != gt_serial_flash_verify(_TEST_STREAM_ADDR, _TEST_STREAM_LEN, info.crc ^ 0x1));
+
+    /** resume: the page program is failed, the host resumes from the offset */
+    _TEST_CHECK(GT_RES_OK == gt_serial_flash_erase(0, _TEST_FLASH_SIZE));
+    _TEST_CHECK(GT_RES_OK == _send_frames(0, half));
+    _program_fail = true;
+    _TEST_CHECK(GT_RES_OK != _send_frames(half, _TEST_STREAM_LEN));
+    _program_fail = false;
+    gt_serial_flash_get_stream(&info);
+    _TEST_CHECK(info.offset > _TEST_STREAM_ADDR && info.offset <= _TEST_STREAM_ADDR + half);
+    _TEST_CHECK(_stream_crc(info.offset - _TEST_STREAM_ADDR) == info.crc);
+    _TEST_CHECK(GT_RES_OK == _send_frames(info.offset - _TEST_STREAM_ADDR, _TEST_STREAM_LEN));
+    _TEST_CHECK(GT_RES_OK == gt_serial_flash_flush());
+    gt_serial_flash_get_stream(&info);
+    _TEST_CHECK(_TEST_STREAM_ADDR + _TEST_STREAM_LEN == info.offset);
+    _TEST_CHECK(_stream_crc(_TEST_STREAM_LEN) == info.crc);
+    _TEST_CHECK(GT_RES_OK == gt_serial_flash_verify(_TEST_STREAM_ADDR, _TEST_STREAM_LEN, info.crc));
+
+    GT_LOG_A(GT_LOG_TAG_TEST, "flash stream test passed, pages: %d", info.pages);
+_exit:
+    _program_fail = false;
+    gt_vf_drv_register(rw_cb_bak);
+    gt_vf_flash_model_init(NULL, 0);
+    return ret;
+}
+
+#endif  /** _GT_TEST_SERIAL_FLASH */
+#endif  /** _GT_USE_TEST */
+/* end ------------------------------------------------------------------*/
@@ -0,0 +1,70 @@
+/**
+ * @file gt_test_serial_flash.h
+ * @author Feyoung
+ * @brief Test the serial flash stream against the RAM NOR flash model
+ * @version 0.1
+ * @date 2026-10-19 10:12:36
+ * @copyright Copyright (c) 2014-present, Company Genitop. Co., Ltd.
+ */
+#ifndef _GT_TEST_SERIAL_FLASH_H_
+#define _GT_TEST_SERIAL_FLASH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* include --------------------------------------------------------------*/
+#include "../src/gt_conf.h"
+#if _GT_USE_TEST
+
+#ifndef _GT_TEST_SERIAL_FLASH
+    /**
+     * @brief Control the flash stream test, which is run once after gt_init(),
+     *      the vf driver is replaced by the RAM model during the test.
+     *      Must be used with GT_SERIAL_SYS_USE_FLASH_STREAM and GT_HAL_FLASH_USE_RAM_MODEL.
+     *      [default: 0]
+     */
+    #define _GT_TEST_SERIAL_FLASH       0
+#endif
+
+#if _GT_TEST_SERIAL_FLASH
+#include "../src/hal/gt_hal_vf.h"
+#include "../src/others/gt_types.h"
+
+#if !GT_USE_SERIAL || !GT_SERIAL_SYS_USE_FLASH_STREAM || !GT_HAL_FLASH_USE_RAM_MODEL
+    #error "_GT_TEST_SERIAL_FLASH must be used with GT_SERIAL_SYS_USE_FLASH_STREAM and GT_HAL_FLASH_USE_RAM_MODEL"
+#endif
+
+/* define ---------------------------------------------------------------*/
+
+
+
+/* typedef --------------------------------------------------------------*/
+
+
+
+/* macros ---------------------------------------------------------------*/
+
+
+
+/* class ----------------------------------------------------------------*/
+
+
+
+/* global functions / API interface -------------------------------------*/
+/**
+ * @brief Write, flush, verify and resume the flash stream by the RAM model
+ *
+ * @return gt_res_t GT_RES_OK: all passed
+ */
+gt_res_t _gt_test_serial_flash(void);
+
+
+#endif  /** _GT_TEST_SERIAL_FLASH */
+#endif  /** _GT_USE_TEST */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif //!_GT_TEST_SERIAL_FLASH_H_
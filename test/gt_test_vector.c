@@ -0,0 +1,164 @@
+/**
+ * @file gt_test_vector.c
+ * @author Feyoung
+ * @brief Benchmark the contiguous _gt_vector against the linked list which was used before
+ * @version 0.1
+ * @date 2026-10-19 14:05:21
+ * @copyright Copyright (c) 2014-present, Company Genitop. Co., Ltd.
+ */
+
+/* include --------------------------------------------------------------*/
+#include "./gt_test_vector.h"
+#if _GT_USE_TEST
+#if _GT_TEST_VECTOR_BENCH
+#include "../src/hal/gt_hal_tick.h"
+#include "../src/others/gt_log.h"
+#include "../src/others/gt_list.h"
+#include "../src/core/gt_mem.h"
+#include "../src/utils/gt_vector.h"
+
+
+/* private define -------------------------------------------------------*/
+#ifndef _TEST_ACCESS_TOTAL
+    /** The total count of the access by index for each size */
+    #define _TEST_ACCESS_TOTAL  500000
+#endif
+
+
+/* private typedef ------------------------------------------------------*/
+/**
+ * @brief The linked list which _gt_vector was, the items are
+ *      allocated one by one and found by walking from the head.
+ */
+typedef struct _list_item_s {
+    struct _gt_list_head node;
+    void * val;
+}_list_item_st;
+
+typedef struct _list_s {
+    struct _gt_list_head list_head;
+    gt_size_t count;
+}_list_st;
+
+
+/* static variables -----------------------------------------------------*/
+static const gt_size_t _sizes[] = { 16, 64, 256, 1024 };
+
+
+/* macros ---------------------------------------------------------------*/
+
+
+
+/* class ----------------------------------------------------------------*/
+
+
+
+/* static functions -----------------------------------------------------*/
+static bool _list_add_item(_list_st * list, void * item) {
+    _list_item_st * new_item = (_list_item_st * )gt_mem_malloc(sizeof(_list_item_st));
+    if (NULL == new_item) {
+        return false;
+    }
+    _GT_INIT_LIST_HEAD(&new_item->node);
+    new_item->val = item;
+    _gt_list_add_tail(&new_item->node, &list->list_head);
+    ++list->count;
+    return true;
+}
+
+static void * _list_get_item(_list_st const * list, gt_size_t index) {
+    _list_item_st * item_p = NULL;
+    gt_size_t i = 0;
+    _gt_list_for_each_entry(item_p, &list->list_head, _list_item_st, node) {
+        if (i++ == index) {
+            return item_p->val;
+        }
+    }
+    return NULL;
+}
+
+static void _list_clear(_list_st * list) {
+    _list_item_st * item_p = NULL, * backup_p = NULL;
+    _gt_list_for_each_entry_safe(item_p, backup_p, &list->list_head, _list_item_st, node) {
+        _gt_list_del(&item_p->node);
+        gt_mem_free(item_p);
+    }
+    list->count = 0;
+}
+
+
+/* global functions / API interface -------------------------------------*/
+gt_res_t _gt_test_vector_bench(void)
+{
+    _gt_vector_st * vector = _gt_vector_create(NULL, NULL);
+    _list_st list = {0};
+    gt_res_t ret = GT_RES_OK;
+    volatile gt_uintptr_t sum = 0;
+    uint32_t tick = 0, vec_add = 0, list_add = 0, vec_get = 0, list_get = 0;
+    uint32_t rep = 0, reps = 0;
+    gt_size_t s = 0, i = 0, n = 0;
+
+    GT_CHECK_BACK_VAL(vector, GT_RES_FAIL);
+    _GT_INIT_LIST_HEAD(&list.list_head);
+
+    for (s = 0; s < (gt_size_t)(sizeof(_sizes) / sizeof(_sizes[0])); ++s) {
+        n = _sizes[s];
+        reps = _TEST_ACCESS_TOTAL / n;
+        _gt_vector_clear_all_items(vector);
+        _list_clear(&list);
+
+        tick = gt_tick_get();
+        for (i = 0; i < n; ++i) {
+            _gt_vector_add_item(vector, (void * )(gt_uintptr_t)(i + 1));
+        }
+        vec_add = gt_tick_elapse(tick);
+
+        tick = gt_tick_get();
+        for (i = 0; i < n; ++i) {
+            _list_add_item(&list, (void * )(gt_uintptr_t)(i + 1));
+        }
+        list_add = gt_tick_elapse(tick);
+
+        if (_gt_vector_get_count(vector) != n || list.count != n) {
+            GT_LOG_A(GT_LOG_TAG_TEST, "vector n: %d, out of memory, vector: %d list: %d",
+                n, _gt_vector_get_count(vector), list.count);
+            break;
+        }
+        for (i = 0; i < n; ++i) {
+            if (_gt_vector_get_item(vector, i) != _list_get_item(&list, i)) {
+                ret = GT_RES_FAIL;
+            }
+        }
+
+        /** As gt_table draws: each cell is got by index */
+        tick = gt_tick_get();
+        for (rep = 0; rep < reps; ++rep) {
+            for (i = 0; i < n; ++i) {
+                sum += (gt_uintptr_t)_gt_vector_get_item(vector, i);
+            }
+        }
+        vec_get = gt_tick_elapse(tick);
+
+        tick = gt_tick_get();
+        for (rep = 0; rep < reps; ++rep) {
+            for (i = 0; i < n; ++i) {
+                sum += (gt_uintptr_t)_list_get_item(&list, i);
+            }
+        }
+        list_get = gt_tick_elapse(tick);
+
+        GT_LOG_A(GT_LOG_TAG_TEST, "vector n: %d, append: %d / %d ms, %lu get_item: %d / %d ms (vector / list)",
+            n, vec_add, list_add, (unsigned long)reps * n, vec_get, list_get);
+    }
+    _list_clear(&list);
+    _gt_vector_free(vector);
+
+    if (GT_RES_OK != ret) {
+        GT_LOG_A(GT_LOG_TAG_TEST, "vector test failed, the items are different from the list");
+    }
+    return ret;
+}
+
+#endif  /** _GT_TEST_VECTOR_BENCH */
+#endif  /** _GT_USE_TEST */
+/* end ------------------------------------------------------------------*/
@@ -0,0 +1,64 @@
+/**
+ * @file gt_test_vector.h
+ * @author Feyoung
+ * @brief Benchmark the contiguous _gt_vector against the linked list which was used before
+ * @version 0.1
+ * @date 2026-10-19 14:05:21
+ * @copyright Copyright (c) 2014-present, Company Genitop. Co., Ltd.
+ */
+#ifndef _GT_TEST_VECTOR_H_
+#define _GT_TEST_VECTOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* include --------------------------------------------------------------*/
+#include "../src/gt_conf.h"
+#if _GT_USE_TEST
+
+#ifndef _GT_TEST_VECTOR_BENCH
+    /**
+     * @brief Control the vector benchmark, which is run once after gt_init()
+     *      [default: 0]
+     */
+    #define _GT_TEST_VECTOR_BENCH       0
+#endif
+
+#if _GT_TEST_VECTOR_BENCH
+#include "../src/others/gt_types.h"
+
+/* define ---------------------------------------------------------------*/
+
+
+
+/* typedef --------------------------------------------------------------*/
+
+
+
+/* macros ---------------------------------------------------------------*/
+
+
+
+/* class ----------------------------------------------------------------*/
+
+
+
+/* global functions / API interface -------------------------------------*/
+/**
+ * @brief Check the items of the vector against the linked list, then print
+ *      the time of append and of the table-like access by index.
+ *
+ * @return gt_res_t GT_RES_OK: the items are the same
+ */
+gt_res_t _gt_test_vector_bench(void);
+
+
+#endif  /** _GT_TEST_VECTOR_BENCH */
+#endif  /** _GT_USE_TEST */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif //!_GT_TEST_VECTOR_H_